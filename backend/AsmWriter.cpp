@@ -0,0 +1,327 @@
+///
+/// @file AsmWriter.cpp
+/// @brief 带缓冲的汇编文本输出的实现
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，带缓冲的汇编文本输出，替代逐条拼接字符串
+/// </table>
+///
+#include <algorithm>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "AsmWriter.h"
+
+/// @brief 每次申请空间的最小字节数，避免频繁提交
+static const size_t minAcquireSize = 4096;
+
+///
+/// @brief 构造函数
+/// @param _file 文件指针，由调用者负责打开与关闭
+/// @param bufferSize 缓冲区大小
+///
+AsmFileSink::AsmFileSink(FILE * _file, size_t bufferSize) : file(_file), buffer(bufferSize)
+{}
+
+char * AsmFileSink::acquire(size_t minSize, size_t & size)
+{
+    if (buffer.size() < minSize) {
+        buffer.resize(minSize);
+    }
+
+    size = buffer.size();
+    return buffer.data();
+}
+
+bool AsmFileSink::commit(size_t used)
+{
+    return fwrite(buffer.data(), 1, used, file) == used;
+}
+
+bool AsmFileSink::finish()
+{
+    return fflush(file) == 0;
+}
+
+///
+/// @brief 构造函数
+/// @param _out 输出的字符串，内容追加到末尾
+///
+AsmMemorySink::AsmMemorySink(std::string & _out) : out(_out), length(_out.size())
+{}
+
+char * AsmMemorySink::acquire(size_t minSize, size_t & size)
+{
+    // 按容量扩大字符串，提交时再截断为实际长度
+    if (out.capacity() < length + minSize) {
+        out.reserve(std::max(out.capacity() * 2, length + minSize));
+    }
+    out.resize(out.capacity());
+
+    size = out.size() - length;
+    return &out[length];
+}
+
+bool AsmMemorySink::commit(size_t used)
+{
+    length += used;
+    out.resize(length);
+
+    return true;
+}
+
+AsmMmapSink::~AsmMmapSink()
+{
+    finish();
+}
+
+#ifndef _WIN32
+
+///
+/// @brief 创建并映射文件
+/// @param fileName 文件名
+/// @return true 成功 false 失败
+///
+bool AsmMmapSink::open(const std::string & fileName)
+{
+    // 管道、字符设备等不能扩大与映射，提前判断以免截断已有的输出
+    struct stat st;
+    if ((stat(fileName.c_str(), &st) == 0) && !S_ISREG(st.st_mode)) {
+        return false;
+    }
+
+    fd = ::open(fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    length = 0;
+    if (!remap(1024 * 1024)) {
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+
+    return true;
+}
+
+///
+/// @brief 把文件扩大到至少指定的大小并重新映射
+/// @param minCapacity 至少需要的大小
+/// @return true 成功 false 失败
+///
+bool AsmMmapSink::remap(size_t minCapacity)
+{
+    if (mapped) {
+        munmap(mapped, capacity);
+        mapped = nullptr;
+    }
+
+    capacity = std::max(capacity * 2, minCapacity);
+    if (ftruncate(fd, (off_t) capacity) != 0) {
+        return false;
+    }
+
+    void * addr = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+
+    mapped = static_cast<char *>(addr);
+    return true;
+}
+
+char * AsmMmapSink::acquire(size_t minSize, size_t & size)
+{
+    if ((fd < 0) || ((length + minSize > capacity) && !remap(length + minSize))) {
+        size = 0;
+        return nullptr;
+    }
+
+    size = capacity - length;
+    return mapped + length;
+}
+
+bool AsmMmapSink::commit(size_t used)
+{
+    length += used;
+    return true;
+}
+
+bool AsmMmapSink::finish()
+{
+    if (fd < 0) {
+        return true;
+    }
+
+    if (mapped) {
+        munmap(mapped, capacity);
+        mapped = nullptr;
+    }
+
+    // 截断为实际写入的长度
+    bool result = ftruncate(fd, (off_t) length) == 0;
+    result = (::close(fd) == 0) && result;
+    fd = -1;
+
+    return result;
+}
+
+#else
+
+bool AsmMmapSink::open(const std::string & fileName)
+{
+    // 暂不支持Windows的文件映射
+    (void) fileName;
+    return false;
+}
+
+bool AsmMmapSink::remap(size_t minCapacity)
+{
+    (void) minCapacity;
+    return false;
+}
+
+char * AsmMmapSink::acquire(size_t minSize, size_t & size)
+{
+    (void) minSize;
+    size = 0;
+    return nullptr;
+}
+
+bool AsmMmapSink::commit(size_t used)
+{
+    (void) used;
+    return false;
+}
+
+bool AsmMmapSink::finish()
+{
+    return true;
+}
+
+#endif
+
+///
+/// @brief 构造函数
+/// @param _sink 输出目标
+///
+AsmWriter::AsmWriter(AsmSink & _sink) : sink(_sink)
+{}
+
+///
+/// @brief 析构函数，提交未提交的内容
+///
+AsmWriter::~AsmWriter()
+{
+    flush();
+}
+
+///
+/// @brief 提交当前空间并申请新的空间
+/// @param minSize 至少需要的字节数
+///
+void AsmWriter::refill(size_t minSize)
+{
+    flush();
+
+    size_t size = 0;
+    begin = sink.acquire(std::max(minSize, minAcquireSize), size);
+    if (begin == nullptr) {
+        failed = true;
+        size = 0;
+    }
+
+    cur = begin;
+    end = begin + size;
+}
+
+///
+/// @brief 输出指定长度的字节
+/// @param data 内容
+/// @param len 字节数
+/// @return AsmWriter& 自身
+///
+AsmWriter & AsmWriter::write(const char * data, size_t len)
+{
+    if ((size_t) (end - cur) < len) {
+        refill(len);
+        if ((size_t) (end - cur) < len) {
+            return *this;
+        }
+    }
+
+    std::memcpy(cur, data, len);
+    cur += len;
+
+    return *this;
+}
+
+AsmWriter & AsmWriter::operator<<(const char * str)
+{
+    return write(str, std::strlen(str));
+}
+
+AsmWriter & AsmWriter::operator<<(int64_t num)
+{
+    // 从低位到高位逆序生成，最小负数取绝对值时按无符号处理
+    char digits[24];
+    char * pos = digits + sizeof(digits);
+
+    uint64_t absVal = (num < 0) ? (0ull - (uint64_t) num) : (uint64_t) num;
+    do {
+        *--pos = (char) ('0' + absVal % 10);
+        absVal /= 10;
+    } while (absVal != 0);
+
+    if (num < 0) {
+        *--pos = '-';
+    }
+
+    return write(pos, (size_t) (digits + sizeof(digits) - pos));
+}
+
+///
+/// @brief 提交已写入的内容
+/// @return true 成功 false 失败
+///
+bool AsmWriter::flush()
+{
+    if (begin != nullptr) {
+        if (!sink.commit((size_t) (cur - begin))) {
+            failed = true;
+        }
+    }
+
+    begin = cur = end = nullptr;
+
+    return !failed;
+}
+
+///
+/// @brief 提交已写入的内容并结束输出目标
+/// @return true 成功 false 输出过程中出现过错误
+///
+bool AsmWriter::finish()
+{
+    flush();
+
+    if (!sink.finish()) {
+        failed = true;
+    }
+
+    return !failed;
+}
@@ -0,0 +1,251 @@
+///
+/// @file AsmWriter.h
+/// @brief 带缓冲的汇编文本输出，格式化直接写入缓冲区，不产生临时字符串
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，带缓冲的汇编文本输出，替代逐条拼接字符串
+/// </table>
+///
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+///
+/// @brief 汇编文本的输出目标
+///
+/// AsmWriter向输出目标申请一段可写的空间，写满或结束时提交实际写入的字节数。
+/// 输出目标可以是带缓冲的文件、内存映射的文件或者调用者提供的内存。
+///
+class AsmSink {
+
+public:
+    virtual ~AsmSink() = default;
+
+    ///
+    /// @brief 申请可写入的空间
+    /// @param minSize 至少需要的字节数
+    /// @param size 实际可写入的字节数
+    /// @return char* 空间的开始位置，失败时为nullptr
+    ///
+    virtual char * acquire(size_t minSize, size_t & size) = 0;
+
+    ///
+    /// @brief 提交最近一次申请的空间中写入的字节数，之后该空间失效
+    /// @param used 写入的字节数
+    /// @return true 成功 false 失败
+    ///
+    virtual bool commit(size_t used) = 0;
+
+    ///
+    /// @brief 结束输出
+    /// @return true 成功 false 失败
+    ///
+    virtual bool finish()
+    {
+        return true;
+    }
+};
+
+///
+/// @brief 输出到文件指针，采用可重复使用的大缓冲区，写满时一次fwrite
+///
+class AsmFileSink : public AsmSink {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _file 文件指针，由调用者负责打开与关闭
+    /// @param bufferSize 缓冲区大小
+    ///
+    explicit AsmFileSink(FILE * _file, size_t bufferSize = 256 * 1024);
+
+    char * acquire(size_t minSize, size_t & size) override;
+
+    bool commit(size_t used) override;
+
+    bool finish() override;
+
+private:
+    /// @brief 文件指针
+    FILE * file;
+
+    /// @brief 缓冲区
+    std::vector<char> buffer;
+};
+
+///
+/// @brief 输出到调用者提供的字符串
+///
+class AsmMemorySink : public AsmSink {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _out 输出的字符串，内容追加到末尾
+    ///
+    explicit AsmMemorySink(std::string & _out);
+
+    char * acquire(size_t minSize, size_t & size) override;
+
+    bool commit(size_t used) override;
+
+private:
+    /// @brief 输出的字符串
+    std::string & out;
+
+    /// @brief 已提交的长度
+    size_t length;
+};
+
+///
+/// @brief 输出到内存映射的文件，直接写入映射的内存，不经过缓冲区复制
+///
+/// 文件按需扩大并重新映射，结束时截断为实际写入的长度。
+/// 不支持内存映射的平台或者不是普通文件（如管道、/dev/stdout）时open失败，可改用AsmFileSink。
+///
+class AsmMmapSink : public AsmSink {
+
+public:
+    AsmMmapSink() = default;
+
+    ~AsmMmapSink() override;
+
+    ///
+    /// @brief 创建并映射文件
+    /// @param fileName 文件名
+    /// @return true 成功 false 失败
+    ///
+    bool open(const std::string & fileName);
+
+    char * acquire(size_t minSize, size_t & size) override;
+
+    bool commit(size_t used) override;
+
+    bool finish() override;
+
+private:
+    ///
+    /// @brief 把文件扩大到至少指定的大小并重新映射
+    /// @param minCapacity 至少需要的大小
+    /// @return true 成功 false 失败
+    ///
+    bool remap(size_t minCapacity);
+
+    /// @brief 文件描述符
+    int fd = -1;
+
+    /// @brief 映射的内存
+    char * mapped = nullptr;
+
+    /// @brief 映射的大小，即当前文件的大小
+    size_t capacity = 0;
+
+    /// @brief 已写入的长度
+    size_t length = 0;
+};
+
+///
+/// @brief 带缓冲的汇编文本输出
+///
+/// 字符串、寄存器名与整数都直接格式化到输出目标提供的空间中，不产生临时的std::string。
+///
+class AsmWriter {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _sink 输出目标
+    ///
+    explicit AsmWriter(AsmSink & _sink);
+
+    ///
+    /// @brief 析构函数，提交未提交的内容
+    ///
+    ~AsmWriter();
+
+    AsmWriter(const AsmWriter &) = delete;
+    AsmWriter & operator=(const AsmWriter &) = delete;
+
+    ///
+    /// @brief 输出指定长度的字节
+    /// @param data 内容
+    /// @param len 字节数
+    /// @return AsmWriter& 自身
+    ///
+    AsmWriter & write(const char * data, size_t len);
+
+    AsmWriter & operator<<(char ch)
+    {
+        if (cur == end) {
+            refill(1);
+        }
+        if (cur != end) {
+            *cur++ = ch;
+        }
+        return *this;
+    }
+
+    AsmWriter & operator<<(const char * str);
+
+    AsmWriter & operator<<(const std::string & str)
+    {
+        return write(str.data(), str.size());
+    }
+
+    AsmWriter & operator<<(int32_t num)
+    {
+        return *this << (int64_t) num;
+    }
+
+    AsmWriter & operator<<(int64_t num);
+
+    AsmWriter & operator<<(uint32_t num)
+    {
+        return *this << (int64_t) num;
+    }
+
+    ///
+    /// @brief 提交已写入的内容
+    /// @return true 成功 false 失败
+    ///
+    bool flush();
+
+    ///
+    /// @brief 提交已写入的内容并结束输出目标
+    /// @return true 成功 false 输出过程中出现过错误
+    ///
+    bool finish();
+
+private:
+    ///
+    /// @brief 提交当前空间并申请新的空间
+    /// @param minSize 至少需要的字节数
+    ///
+    void refill(size_t minSize);
+
+    /// @brief 输出目标
+    AsmSink & sink;
+
+    /// @brief 当前空间的开始位置
+    char * begin = nullptr;
+
+    /// @brief 当前写入位置
+    char * cur = nullptr;
+
+    /// @brief 当前空间的结束位置
+    char * end = nullptr;
+
+    /// @brief 是否出现过错误
+    bool failed = false;
+};
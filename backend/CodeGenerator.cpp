@@ -25,30 +25,52 @@ CodeGenerator::CodeGenerator(Module * _module) : module(_module)
 {}
 
 /// @brief 代码产生器运行，结果保存到指定的文件中
-/// @param outFileName 输出内容所在文件
+/// @param outFileName 输出内容所在文件，为空时输出到标准输出
 /// @return true：成功，false：失败
 bool CodeGenerator::run(std::string outFileName)
 {
-    // 打开文件，也可以以C++的方式打开文件进行操作
-    // 这里主要便于C语言学习的学生
-    if (!outFileName.empty()) {
-        // 指定文件非空时，则创建文件
-        fp = fopen(outFileName.c_str(), "w");
-        if (nullptr == fp) {
-            printf("open file(%s) failed", outFileName.c_str());
-            return false;
-        }
-    } else {
-        fp = nullptr;
+    if (outFileName.empty()) {
+        AsmFileSink sink(stdout);
+        return run(sink);
     }
 
+    // 普通文件直接写入映射的内存，管道等不能映射的文件采用带缓冲的文件输出
+    AsmMmapSink mmapSink;
+    if (mmapSink.open(outFileName)) {
+        return run(mmapSink);
+    }
+
+    // 目标文件是二进制内容，按二进制方式打开，避免Windows下转换换行符
+    FILE * fp = fopen(outFileName.c_str(), "wb");
+    if (nullptr == fp) {
+        printf("open file(%s) failed", outFileName.c_str());
+        return false;
+    }
+
+    AsmFileSink sink(fp);
+    bool result = run(sink);
+
+    fclose(fp);
+
+    return result;
+}
+
+/// @brief 代码产生器运行，结果输出到指定的输出目标，如调用者提供的内存
+/// @param sink 输出目标
+/// @return true：成功，false：失败
+bool CodeGenerator::run(AsmSink & sink)
+{
+    AsmWriter asmWriter(sink);
+    writer = &asmWriter;
+
     // 执行真正的代码
-    const bool result = run();
+    bool result = run();
+
+    writer = nullptr;
 
-    // 关闭文件
-    if (fp) {
-        fclose(fp);
-        fp = nullptr;
+    if (!asmWriter.finish()) {
+        printf("write assembly failed");
+        return false;
     }
 
     return result;
@@ -18,6 +18,7 @@
 #include <cstdio>
 #include <string>
 
+#include "AsmWriter.h"
 #include "Module.h"
 
 /// @brief 代码生成的一般类
@@ -32,10 +33,15 @@ public:
     virtual ~CodeGenerator() = default;
 
     /// @brief 代码产生器运行，结果保存到指定的文件中
-    /// @param outFileName 输出内容所在文件
+    /// @param outFileName 输出内容所在文件，为空时输出到标准输出
     /// @return true：成功，false：失败
     bool run(std::string outFileName);
 
+    /// @brief 代码产生器运行，结果输出到指定的输出目标，如调用者提供的内存
+    /// @param sink 输出目标
+    /// @return true：成功，false：失败
+    bool run(AsmSink & sink);
+
     ///
     /// @brief 设置是否显示IR指令内容
     /// @param show true：显示，false：不显示
@@ -45,9 +51,17 @@ public:
         this->showLinearIR = show;
     }
 
+    ///
+    /// @brief 设置优化级别
+    /// @param level 优化级别，即-O后面的数字
+    ///
+    void setOptLevel(int level)
+    {
+        this->optLevel = level;
+    }
+
 protected:
-    /// @brief 代码产生器运行，结果保存到指定的文件中
-    /// @param fp 输出内容所在文件的指针
+    /// @brief 代码产生器运行，结果通过writer输出
     /// @return true：成功，false：失败
     virtual bool run() = 0;
 
@@ -56,11 +70,16 @@ protected:
     ///
     Module * module;
 
-    /// @brief 输出文件指针
-    FILE * fp = nullptr;
+    /// @brief 汇编文本输出
+    AsmWriter * writer = nullptr;
 
     ///
     /// @brief 显示IR指令内容
     ///
     bool showLinearIR = false;
+
+    ///
+    /// @brief 优化级别，-O2及以上时寄存器分配采用图着色算法
+    ///
+    int optLevel = 0;
 };
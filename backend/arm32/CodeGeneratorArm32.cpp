@@ -15,6 +15,7 @@
 ///
 #include <cstdint>
 #include <cstdio>
+#include <set>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -25,7 +26,11 @@
 #include "CodeGeneratorArm32.h"
 #include "InstSelectorArm32.h"
 #include "SimpleRegisterAllocator.h"
+#include "LinearScanRegisterAllocator.h"
+#include "GraphColoringRegisterAllocator.h"
 #include "ILocArm32.h"
+#include "IfConverterArm32.h"
+#include "PeepholeArm32.h"
 #include "RegVariable.h"
 #include "FuncCallInstruction.h"
 #include "ArgInstruction.h"
@@ -43,18 +48,16 @@ CodeGeneratorArm32::~CodeGeneratorArm32()
 /// @brief 产生汇编头部分
 void CodeGeneratorArm32::genHeader()
 {
-    fprintf(fp, "%s\n", ".arch armv7ve");
-    fprintf(fp, "%s\n", ".arm");
-    fprintf(fp, "%s\n", ".fpu vfpv4");
+    *writer << ".arch armv7ve\n";
+    *writer << ".arm\n";
+    *writer << ".fpu vfpv4\n";
 }
 
 /// @brief 全局变量Section，主要包含初始化的和未初始化过的
 void CodeGeneratorArm32::genDataSection()
 {
     // 生成代码段
-    fprintf(fp, ".text\n");
-
-    // 可直接操作文件指针fp进行写操作
+    *writer << ".text\n";
 
     // 目前不支持全局变量和静态变量，以及字符串常量
     // 全局变量分两种情况：初始化的全局变量和未初始化的全局变量
@@ -64,15 +67,16 @@ void CodeGeneratorArm32::genDataSection()
         if (var->isInBSSSection()) {
 
             // 在BSS段的全局变量，可以包含初值全是0的变量
-            fprintf(fp, ".comm %s, %d, %d\n", var->getName().c_str(), var->getType()->getSize(), var->getAlignment());
+            *writer << ".comm " << var->getName() << ", " << var->getType()->getSize() << ", " << var->getAlignment()
+                    << '\n';
         } else {
 
             // 有初值的全局变量
-            fprintf(fp, ".global %s\n", var->getName().c_str());
-            fprintf(fp, ".data\n");
-            fprintf(fp, ".align %d\n", var->getAlignment());
-            fprintf(fp, ".type %s, %%object\n", var->getName().c_str());
-            fprintf(fp, "%s\n", var->getName().c_str());
+            *writer << ".global " << var->getName() << '\n';
+            *writer << ".data\n";
+            *writer << ".align " << var->getAlignment() << '\n';
+            *writer << ".type " << var->getName() << ", %object\n";
+            *writer << var->getName() << '\n';
             // TODO 后面设置初始化的值，具体请参考ARM的汇编
         }
     }
@@ -110,15 +114,16 @@ void CodeGeneratorArm32::getIRValueStr(Value * val, std::string & str)
     }
 }
 
-/// @brief 针对函数进行汇编指令生成，放到.text代码段中
+/// @brief 寄存器分配、指令选择以及机器指令级的优化，产生函数的ARM32指令序列
 /// @param func 要处理的函数
-void CodeGeneratorArm32::genCodeSection(Function * func)
+/// @param iloc 产生的指令序列
+void CodeGeneratorArm32::lowerFunction(Function * func, ILocArm32 & iloc)
 {
     // 寄存器分配以及栈内局部变量的站内地址重新分配
     registerAllocation(func);
 
     // 获取函数的指令列表
-    std::vector<Instruction *> & IrInsts = func->getInterCode().getInsts();
+    InterCode & IrInsts = func->getInterCode();
 
     // 汇编指令输出前要确保Label的名字有效，必须是程序级别的唯一，而不是函数内的唯一。要全局编号。
     for (auto inst: IrInsts) {
@@ -127,22 +132,48 @@ void CodeGeneratorArm32::genCodeSection(Function * func)
         }
     }
 
-    // ILOC代码序列
-    ILocArm32 iloc(module);
+    // 全局分配占用的寄存器不能再作为指令选择时的临时寄存器
+    simpleRegisterAllocator.clearReserved();
+    for (auto regno: func->getProtectedReg()) {
+        simpleRegisterAllocator.reserve(regno);
+    }
 
     // 指令选择生成汇编指令
     InstSelectorArm32 instSelector(IrInsts, iloc, func, simpleRegisterAllocator);
     instSelector.setShowLinearIR(this->showLinearIR);
     instSelector.run();
 
+    // 小的if/else结构改为条件执行的指令，去掉跳转
+    if (optLevel >= 1) {
+        IfConverterArm32 ifConverter(iloc);
+        ifConverter.run();
+    }
+
     // 删除无用的Label指令
     iloc.deleteUnusedLabel();
 
+    // 窥孔优化，删除跳转后可能产生新的无用Label，删除Label后又可能产生新的匹配
+    if (optLevel >= 1) {
+        PeepholeArm32 peephole(iloc);
+        while (peephole.run()) {
+            iloc.deleteUnusedLabel();
+        }
+    }
+}
+
+/// @brief 针对函数进行汇编指令生成，放到.text代码段中
+/// @param func 要处理的函数
+void CodeGeneratorArm32::genCodeSection(Function * func)
+{
+    // ILOC代码序列
+    ILocArm32 iloc(module);
+    lowerFunction(func, iloc);
+
     // ILOC代码输出为汇编代码
-    fprintf(fp, ".align %d\n", func->getAlignment());
-    fprintf(fp, ".global %s\n", func->getName().c_str());
-    fprintf(fp, ".type %s, %%function\n", func->getName().c_str());
-    fprintf(fp, "%s:\n", func->getName().c_str());
+    *writer << ".align " << func->getAlignment() << '\n';
+    *writer << ".global " << func->getName() << '\n';
+    *writer << ".type " << func->getName() << ", %function\n";
+    *writer << func->getName() << ":\n";
 
     // 开启时输出IR指令作为注释
     if (this->showLinearIR) {
@@ -152,23 +183,23 @@ void CodeGeneratorArm32::genCodeSection(Function * func)
             std::string str;
             getIRValueStr(localVar, str);
             if (!str.empty()) {
-                fprintf(fp, "%s\n", str.c_str());
+                *writer << str << '\n';
             }
         }
 
         // 输出指令关联的临时变量信息
-        for (auto inst: func->getInterCode().getInsts()) {
+        for (auto inst: func->getInterCode()) {
             if (inst->hasResultValue()) {
                 std::string str;
                 getIRValueStr(inst, str);
                 if (!str.empty()) {
-                    fprintf(fp, "%s\n", str.c_str());
+                    *writer << str << '\n';
                 }
             }
         }
     }
 
-    iloc.outPut(fp);
+    iloc.outPut(*writer);
 }
 
 /// @brief 寄存器分配
@@ -180,10 +211,10 @@ void CodeGeneratorArm32::registerAllocation(Function * func)
         return;
     }
 
-    // 最简单/朴素的寄存器分配简单，但性能差，具体如下：
-    // (1) 局部变量都保存在内存栈中（含简单变量、下标变量等）
+    // 寄存器分配默认采用线性扫描的方法，-O2时采用图着色的方法，具体如下：
+    // (1) 局部变量与指令类的临时变量分配r4-r10寄存器，寄存器不够时溢出到内存栈中
     // (2) 全局变量在静态存储.data区中
-    // (3) 指令类的临时变量也保存在内存栈中，但是性能很差
+    // (3) 没有分配到寄存器的变量在内存栈中，指令选择时借助r0-r3临时寄存器进行运算
 
     // ARM32的函数调用约定：
     // R0,R1,R2和R3寄存器不需要保护，可直接使用
@@ -192,29 +223,40 @@ void CodeGeneratorArm32::registerAllocation(Function * func)
     // 被保留的寄存器主要有：
     //  (1) FP寄存器用于栈寻址，即R11
     //  (2) LX寄存器用于函数调用，即R14。没有函数调用的函数可不用保护lx寄存器
-    //  (3) R10寄存器用于立即数过大时要通过寄存器寻址，这里简化处理进行预留
+    //  (3) IP寄存器用于立即数过大时要通过寄存器寻址，不需要保护
 
-    // 至少有FP和LX寄存器需要保护
-    std::vector<int32_t> & protectedRegNo = func->getProtectedReg();
-    protectedRegNo.clear();
-    protectedRegNo.push_back(ARM32_TMP_REG_NO);
-    protectedRegNo.push_back(ARM32_FP_REG_NO);
-    if (func->getExistFuncCall()) {
-        protectedRegNo.push_back(ARM32_LX_REG_NO);
-    }
+    // 函数形参要求前四个寄存器分配，后面的参数采用栈传递，实现实参的值传递给形参
+    // r0-r3会被函数调用以及指令选择的临时寄存器改写，寄存器传值的形参需要在入口拷贝到变量中
+    // 这一步是必须的，并且要在函数调用指令调整之前，这样实参就不会直接使用形参
+    adjustFormalParamInsts(func);
 
     // 调整函数调用指令，主要是前四个寄存器传值，后面用栈传递
     // 为了更好的进行寄存器分配，可以进行对函数调用的指令进行预处理
     // 当然也可以不做处理，不过性能更差。这个处理是可选的。
     adjustFuncCallInsts(func);
 
+    // 全局寄存器分配，默认采用线性扫描，-O2时采用图着色
+    // 分配到寄存器的局部变量和临时变量不再需要栈内空间
+    GlobalRegisterAllocator * allocator;
+    if (optLevel >= 2) {
+        allocator = new GraphColoringRegisterAllocator(func);
+    } else {
+        allocator = new LinearScanRegisterAllocator(func);
+    }
+    allocator->run();
+
+    // 分配使用的寄存器、FP和LX寄存器需要保护，push/pop要求寄存器从小到大排列
+    std::vector<int32_t> & protectedRegNo = func->getProtectedReg();
+    protectedRegNo = allocator->getUsedRegs();
+    delete allocator;
+    protectedRegNo.push_back(ARM32_FP_REG_NO);
+    if (func->getExistFuncCall()) {
+        protectedRegNo.push_back(ARM32_LX_REG_NO);
+    }
+
     // 为局部变量和临时变量在栈内分配空间，指定偏移，进行栈空间的分配
     stackAlloc(func);
 
-    // 函数形参要求前四个寄存器分配，后面的参数采用栈传递，实现实参的值传递给形参
-    // 这一步是必须的
-    adjustFormalParamInsts(func);
-
 #if 0
     // 临时输出调整后的IR指令，用于查看当前的寄存器分配、栈内变量分配、实参入栈等信息的正确性
     std::string irCodeStr;
@@ -224,40 +266,67 @@ void CodeGeneratorArm32::registerAllocation(Function * func)
 #endif
 }
 
-/// @brief 寄存器分配前对函数内的指令进行调整，以便方便寄存器分配
+/// @brief 寄存器分配前对形参指令调整，寄存器传值的形参在入口处拷贝到局部变量
 /// @param func 要处理的函数
 void CodeGeneratorArm32::adjustFormalParamInsts(Function * func)
 {
-    // 函数形参的前四个实参值采用的是寄存器传值，后面栈传递
+    // 函数形参的前四个实参值采用的是寄存器传值，后面栈传递，栈传递的形参偏移在栈空间分配时设置
 
     auto & params = func->getParams();
+    InterCode & insts = func->getInterCode();
+
+    // 入口处由形参拷贝到局部变量的赋值指令，指令选择时这些指令翻译完毕之前r0-r3保持为形参的值
+    std::set<Instruction *> entryCopies;
+    auto pIter = insts.begin();
+    if ((pIter != insts.end()) && ((*pIter)->getOp() == IRInstOperator::IRINST_OP_ENTRY)) {
+        for (++pIter; pIter != insts.end(); ++pIter) {
+            Instruction * inst = *pIter;
+            if ((inst->getOp() != IRInstOperator::IRINST_OP_ASSIGN) ||
+                !dynamic_cast<FormalParam *>(inst->getOperand(1))) {
+                break;
+            }
+            entryCopies.insert(inst);
+        }
+    }
 
     // 形参的前四个通过寄存器来传值R0-R3
     for (int k = 0; k < (int) params.size() && k <= 3; k++) {
 
+        FormalParam * param = params[k];
+
         // 前四个设置分配寄存器
-        params[k]->setRegId(k);
-    }
+        param->setRegId(k);
+
+        // 入口拷贝之外还有使用时，形参的值会被改写，改为使用入口处拷贝的局部变量
+        bool usedLater = false;
+        for (auto use: param->getUses()) {
+            Instanceof(user, Instruction *, use->getUser());
+            if (!user || !entryCopies.count(user)) {
+                usedLater = true;
+                break;
+            }
+        }
 
-    // 根据ARM版C语言的调用约定，除前4个外的实参进行值传递，逆序入栈
-    int64_t fp_esp = func->getProtectedReg().size() * 4;
-    for (int k = 4; k < (int) params.size(); k++) {
+        if (usedLater) {
 
-        params[k]->setMemoryAddr(ARM32_FP_REG_NO, fp_esp);
+            LocalVariable * var = func->newLocalVarValue(param->getType());
+            param->replaceAllUseWith(var);
 
-        // 增加4字节，目前只支持int类型
-        fp_esp += params[k]->getType()->getSize();
+            // 拷贝指令放在入口拷贝的最前面，也就是Entry指令的后面
+            insts.insertAfter(insts.front(), new MoveInstruction(func, var, param));
+        }
     }
+
+    // 插入了指令，控制流图需要重新构建
+    func->invalidateCFG();
 }
 
 /// @brief 寄存器分配前对函数内的指令进行调整，以便方便寄存器分配
 /// @param func 要处理的函数
 void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
 {
-    std::vector<Instruction *> newInsts;
-
     // 当前函数的指令列表
-    auto & insts = func->getInterCode().getInsts();
+    InterCode & insts = func->getInterCode();
 
     // 函数返回值用R0寄存器，若函数调用有返回值，则赋值R0到对应寄存器
     // 通过栈传递的实参，采用SP + 偏移的方式殉职，偏移肯定非负。
@@ -299,8 +368,7 @@ void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
 
                 // 赋值指令插入到函数调用指令的前面
                 // 函数调用指令前插入后，pIter仍指向函数调用指令
-                pIter = insts.insert(pIter, assignInst);
-                pIter++;
+                insts.insert(pIter, assignInst);
             }
 
             // ARM32的函数调用约定，前四个参数通过寄存器传递
@@ -315,8 +383,7 @@ void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
                 callInst->setOperand(k, PlatformArm32::intRegVal[k]);
 
                 // 函数调用指令前插入后，pIter仍指向函数调用指令
-                pIter = insts.insert(pIter, assignInst);
-                pIter++;
+                insts.insert(pIter, assignInst);
             }
 
 #if 0
@@ -325,8 +392,7 @@ void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
                 auto arg = callInst->getOperand(k);
 
                 // 产生ARG指令
-                pIter = insts.insert(pIter, new ArgInstruction(func, arg));
-                pIter++;
+                insts.insert(pIter, new ArgInstruction(func, arg));
             }
 #endif
 
@@ -344,12 +410,15 @@ void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
                     // 新建一个赋值操作
                     Instruction * assignInst = new MoveInstruction(func, callInst, PlatformArm32::intRegVal[0]);
 
-                    // 函数调用指令的下一个指令的前面插入指令，因为有Exit指令，+1肯定有效
-                    pIter = insts.insert(pIter + 1, assignInst);
+                    // 函数调用指令的下一个指令的前面插入指令，因为有Exit指令，下一个指令肯定有效
+                    pIter = insts.insert(std::next(pIter), assignInst);
                 }
             }
         }
     }
+
+    // 插入了指令，控制流图需要重新构建
+    func->invalidateCFG();
 }
 
 /// @brief 栈空间分配
@@ -409,7 +478,7 @@ void CodeGeneratorArm32::stackAlloc(Function * func)
     }
 
     // 遍历包含有值的指令，也就是临时变量
-    for (auto inst: func->getInterCode().getInsts()) {
+    for (auto inst: func->getInterCode()) {
 
         if (inst->hasResultValue() && (inst->getRegId() == -1)) {
             // 有值，并且没有分配寄存器
@@ -438,6 +507,17 @@ void CodeGeneratorArm32::stackAlloc(Function * func)
         sp_esp += (maxFuncCallArgCnt - 4) * 4;
     }
 
+    // 根据ARM版C语言的调用约定，除前4个外的实参进行值传递，逆序入栈，形参在保护寄存器的空间之上
+    auto & params = func->getParams();
+    int64_t fp_esp = func->getProtectedReg().size() * 4;
+    for (int k = 4; k < (int) params.size(); k++) {
+
+        params[k]->setMemoryAddr(ARM32_FP_REG_NO, fp_esp);
+
+        // 增加4字节，目前只支持int类型
+        fp_esp += params[k]->getType()->getSize();
+    }
+
     // 只有int类型时可以4字节对齐，支持浮点或者向量运算时要16字节对齐
     // sp_esp = (sp_esp + 15) & ~15;
 
@@ -13,9 +13,13 @@
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// </table>
 ///
+#pragma once
+
 #include "CodeGeneratorAsm.h"
 #include "SimpleRegisterAllocator.h"
 
+class ILocArm32;
+
 class CodeGeneratorArm32 : public CodeGeneratorAsm {
 
 public:
@@ -41,6 +45,11 @@ protected:
     /// @param func 要处理的函数
     void registerAllocation(Function * func) override;
 
+    /// @brief 寄存器分配、指令选择以及机器指令级的优化，产生函数的ARM32指令序列
+    /// @param func 要处理的函数
+    /// @param iloc 产生的指令序列
+    void lowerFunction(Function * func, ILocArm32 & iloc);
+
     /// @brief 栈空间分配
     /// @param func 要处理的函数
     void stackAlloc(Function * func);
@@ -49,7 +58,7 @@ protected:
     /// @param func 要处理的函数
     void adjustFuncCallInsts(Function * func);
 
-    /// @brief 寄存器分配前对形参指令调整，便于栈内空间分配以及寄存器分配
+    /// @brief 寄存器分配前对形参指令调整，寄存器传值的形参在入口处拷贝到局部变量
     /// @param func 要处理的函数
     void adjustFormalParamInsts(Function * func);
 
@@ -0,0 +1,96 @@
+///
+/// @file CodeGeneratorElfArm32.cpp
+/// @brief ARM32的目标文件生成器的实现
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，不经过外部汇编器直接输出ELF目标文件
+/// </table>
+///
+#include "CodeGeneratorElfArm32.h"
+#include "EncoderArm32.h"
+#include "Function.h"
+#include "ILocArm32.h"
+#include "Module.h"
+
+/// @brief 构造函数
+/// @param _module 符号表
+CodeGeneratorElfArm32::CodeGeneratorElfArm32(Module * _module)
+    : CodeGeneratorArm32(_module), elf(ELF_EM_ARM, ELF_EF_ARM_EABI_VER5)
+{
+    textSection = elf.addSection(".text", ELF_SHT_PROGBITS, ELF_SHF_ALLOC | ELF_SHF_EXECINSTR, 4);
+    dataSection = elf.addSection(".data", ELF_SHT_PROGBITS, ELF_SHF_ALLOC | ELF_SHF_WRITE, 4);
+    bssSection = elf.addSection(".bss", ELF_SHT_NOBITS, ELF_SHF_ALLOC | ELF_SHF_WRITE, 4);
+
+    // 映射符号$a标识.text节从开始都是A32指令，反汇编与链接时需要
+    elf.addLocalSymbol("$a", textSection, 0);
+}
+
+/// @brief 产生目标文件
+/// @return true:成功，false:失败
+bool CodeGeneratorElfArm32::run()
+{
+    // 数据段与代码段按汇编输出的流程产生，最后一次性写出
+    bool result = CodeGeneratorArm32::run();
+    if (!result || encodeFailed) {
+        return false;
+    }
+
+    elf.write(*writer);
+
+    return true;
+}
+
+/// @brief 目标文件没有汇编头
+void CodeGeneratorElfArm32::genHeader()
+{}
+
+/// @brief 全局变量分配到.data或.bss节中，并定义对应的符号
+void CodeGeneratorElfArm32::genDataSection()
+{
+    for (auto var: module->getGlobalVariables()) {
+
+        uint32_t size = (uint32_t) var->getType()->getSize();
+        int32_t section = var->isInBSSSection() ? bssSection : dataSection;
+
+        uint32_t offset = elf.alignSection(section, (uint32_t) var->getAlignment());
+        elf.defineSymbol(var->getName(), ELF_STT_OBJECT, section, offset, size);
+
+        if (section == bssSection) {
+            elf.growSection(section, size);
+        } else {
+            // TODO 与汇编输出一样，IR中还没有全局变量的初值，先填0
+            elf.getContent(section).resize(offset + size, 0);
+        }
+    }
+}
+
+/// @brief 针对函数产生指令并编码到.text节中
+/// @param func 要处理的函数
+void CodeGeneratorElfArm32::genCodeSection(Function * func)
+{
+    ILocArm32 iloc(module);
+    lowerFunction(func, iloc);
+
+    // A32指令要求4字节对齐
+    uint32_t start = elf.alignSection(textSection, 4);
+
+    EncoderArm32 encoder(elf.getContent(textSection));
+    if (!encoder.encode(iloc.getCode())) {
+        encodeFailed = true;
+    }
+
+    uint32_t size = (uint32_t) elf.getContent(textSection).size() - start;
+    elf.defineSymbol(func->getName(), ELF_STT_FUNC, textSection, start, size);
+
+    // 函数调用与全局变量的地址由链接器确定，符号名随iloc释放，这里即时转换为重定位
+    for (auto & fixup: encoder.getFixups()) {
+        elf.addRelocation(textSection, fixup.offset, elf.getSymbol(fixup.sym), fixup.type);
+    }
+}
@@ -0,0 +1,67 @@
+///
+/// @file CodeGeneratorElfArm32.h
+/// @brief ARM32的目标文件生成器，直接产生ELF32可重定位目标文件，不需要外部汇编器
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，不经过外部汇编器直接输出ELF目标文件
+/// </table>
+///
+#pragma once
+
+#include "CodeGeneratorArm32.h"
+#include "ElfWriter.h"
+
+///
+/// @brief ARM32的目标文件生成器
+///
+/// 寄存器分配、指令选择与优化和汇编输出完全相同，只是最后把指令序列编码为A32指令，
+/// 与全局变量一起写出为含.text/.data/.bss节、符号表与重定位的ELF32目标文件。
+///
+class CodeGeneratorElfArm32 : public CodeGeneratorArm32 {
+
+public:
+    /// @brief 构造函数
+    /// @param module 符号表
+    CodeGeneratorElfArm32(Module * module);
+
+    /// @brief 析构函数
+    ~CodeGeneratorElfArm32() override = default;
+
+protected:
+    /// @brief 产生目标文件
+    /// @return true:成功，false:失败
+    bool run() override;
+
+    /// @brief 目标文件没有汇编头
+    void genHeader() override;
+
+    /// @brief 全局变量分配到.data或.bss节中，并定义对应的符号
+    void genDataSection() override;
+
+    /// @brief 针对函数产生指令并编码到.text节中
+    /// @param func 要处理的函数
+    void genCodeSection(Function * func) override;
+
+private:
+    /// @brief ELF目标文件
+    ElfWriter elf;
+
+    /// @brief .text节的编号
+    int32_t textSection;
+
+    /// @brief .data节的编号
+    int32_t dataSection;
+
+    /// @brief .bss节的编号
+    int32_t bssSection;
+
+    /// @brief 是否存在不能编码的指令
+    bool encodeFailed = false;
+};
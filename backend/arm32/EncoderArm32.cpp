@@ -0,0 +1,420 @@
+///
+/// @file EncoderArm32.cpp
+/// @brief ARM32机器指令的二进制编码的实现
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，ARM32机器指令的二进制编码
+/// </table>
+///
+#include "EncoderArm32.h"
+#include "Common.h"
+#include "ElfWriter.h"
+
+/// @brief 数据处理指令的opcode域，不是数据处理指令时为-1
+static int32_t dataProcessingOpcode(ArmOp op)
+{
+    switch (op) {
+        case ArmOp::AND:
+            return 0;
+        case ArmOp::EOR:
+            return 1;
+        case ArmOp::SUB:
+            return 2;
+        case ArmOp::RSB:
+            return 3;
+        case ArmOp::ADD:
+            return 4;
+        case ArmOp::CMP:
+            return 10;
+        case ArmOp::CMN:
+            return 11;
+        case ArmOp::ORR:
+            return 12;
+        case ArmOp::MOV:
+            return 13;
+        case ArmOp::BIC:
+            return 14;
+        case ArmOp::MVN:
+            return 15;
+        default:
+            return -1;
+    }
+}
+
+///
+/// @brief 编码数据处理指令的立即数，即8位立即数循环右移偶数位
+/// @param value 立即数
+/// @param bits 编码结果，含I位
+/// @return true 成功 false 不能编码
+///
+static bool encodeImm(uint32_t value, uint32_t & bits)
+{
+    for (uint32_t rot = 0; rot < 16; ++rot) {
+        // 循环左移2*rot位后不超过8位，则原值为其循环右移2*rot位
+        uint32_t imm8 = (rot == 0) ? value : ((value << (2 * rot)) | (value >> (32 - 2 * rot)));
+        if (imm8 <= 0xFF) {
+            bits = (1u << 25) | (rot << 8) | imm8;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///
+/// @brief 编码移位位数，lsr与asr的32位编码为0
+/// @param shift 移位操作
+/// @param amount 移位位数
+/// @param bits 编码结果
+/// @return true 成功 false 位数超出范围
+///
+static bool encodeShift(ArmShift shift, int32_t amount, uint32_t & bits)
+{
+    if ((amount == 32) && ((shift == ArmShift::LSR) || (shift == ArmShift::ASR))) {
+        amount = 0;
+    } else if ((amount < 0) || (amount > 31)) {
+        return false;
+    }
+
+    bits = ((uint32_t) amount << 7) | ((uint32_t) shift << 5);
+    return true;
+}
+
+///
+/// @brief 编码数据处理指令的第二个操作数
+/// @param operand 操作数，可以是立即数、寄存器或移位的寄存器
+/// @param bits 编码结果
+/// @return true 成功 false 不能编码
+///
+static bool encodeOperand2(const MachineOperand & operand, uint32_t & bits)
+{
+    switch (operand.kind) {
+        case MachineOperand::Imm:
+            return encodeImm((uint32_t) operand.imm, bits);
+        case MachineOperand::Reg:
+            bits = operand.regNo;
+            return true;
+        case MachineOperand::ShiftedReg:
+            if (!encodeShift(operand.shift, operand.imm, bits)) {
+                return false;
+            }
+            bits |= operand.regNo;
+            return true;
+        default:
+            return false;
+    }
+}
+
+///
+/// @brief 立即数不能编码时，换为对偶的指令与变换后的立即数，如add r0,r1,#-4变为sub r0,r1,#4
+/// @param op 操作码，成功时替换为对偶的操作码
+/// @param value 立即数，成功时替换为变换后的立即数
+/// @return true 存在对偶的指令 false 不存在
+///
+static bool dualImmOpcode(ArmOp & op, uint32_t & value)
+{
+    switch (op) {
+        case ArmOp::ADD:
+            op = ArmOp::SUB;
+            value = 0u - value;
+            return true;
+        case ArmOp::SUB:
+            op = ArmOp::ADD;
+            value = 0u - value;
+            return true;
+        case ArmOp::CMP:
+            op = ArmOp::CMN;
+            value = 0u - value;
+            return true;
+        case ArmOp::CMN:
+            op = ArmOp::CMP;
+            value = 0u - value;
+            return true;
+        case ArmOp::MOV:
+            op = ArmOp::MVN;
+            value = ~value;
+            return true;
+        case ArmOp::MVN:
+            op = ArmOp::MOV;
+            value = ~value;
+            return true;
+        case ArmOp::AND:
+            op = ArmOp::BIC;
+            value = ~value;
+            return true;
+        case ArmOp::BIC:
+            op = ArmOp::AND;
+            value = ~value;
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// @brief 寄存器列表中只有一个寄存器时返回其编号，否则为-1
+static int32_t singleReg(uint32_t mask)
+{
+    if ((mask == 0) || (mask & (mask - 1))) {
+        return -1;
+    }
+
+    int32_t regNo = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        regNo++;
+    }
+
+    return regNo;
+}
+
+///
+/// @brief 构造函数
+/// @param _text 代码段的内容，编码结果追加到末尾
+///
+EncoderArm32::EncoderArm32(std::vector<uint8_t> & _text) : text(_text)
+{}
+
+///
+/// @brief 编码一个函数的指令序列，无效指令、NOP、注释不编码
+///
+/// 先计算函数内各Label的偏移，再逐条编码，这样向后跳转也可以直接计算偏移。
+///
+/// @param code 指令序列
+/// @return true 成功 false 存在不能编码的指令
+///
+bool EncoderArm32::encode(const std::vector<MachineInstr *> & code)
+{
+    labels.clear();
+
+    uint32_t offset = (uint32_t) text.size();
+    for (MachineInstr * inst: code) {
+        if (inst->dead || (inst->opcode == ArmOp::NOP) || (inst->opcode == ArmOp::COMMENT)) {
+            continue;
+        }
+        if (inst->isLabel()) {
+            labels[inst->operands[0].sym] = offset;
+        } else {
+            offset += 4;
+        }
+    }
+
+    bool result = true;
+
+    for (MachineInstr * inst: code) {
+        if (inst->dead || inst->isLabel() || (inst->opcode == ArmOp::NOP) || (inst->opcode == ArmOp::COMMENT)) {
+            continue;
+        }
+
+        uint32_t word = 0;
+        if (!encodeInst(inst, (uint32_t) text.size(), word)) {
+            std::string str;
+            AsmMemorySink sink(str);
+            AsmWriter writer(sink);
+            inst->print(writer);
+            writer.finish();
+            minic_log(LOG_ERROR, "ARM32指令(%s)不能编码", str.c_str());
+            result = false;
+        }
+
+        // 小端存放
+        text.push_back((uint8_t) word);
+        text.push_back((uint8_t) (word >> 8));
+        text.push_back((uint8_t) (word >> 16));
+        text.push_back((uint8_t) (word >> 24));
+    }
+
+    return result;
+}
+
+///
+/// @brief 编码数据处理指令，如add、mov、cmp，立即数不能编码时尝试对偶的指令
+/// @param inst 指令
+/// @param word 编码结果
+/// @return true 成功 false 不能编码
+///
+bool EncoderArm32::encodeDataProcessing(const MachineInstr * inst, uint32_t & word)
+{
+    ArmOp op = inst->opcode;
+    const MachineOperand * operands = inst->operands;
+
+    // lsl r0,r1,#2 即 mov r0,r1,lsl #2；lsl r0,r1,r2 即 mov r0,r1,lsl r2
+    if ((op == ArmOp::LSL) || (op == ArmOp::LSR) || (op == ArmOp::ASR)) {
+        ArmShift shift = (op == ArmOp::LSL) ? ArmShift::LSL : ((op == ArmOp::LSR) ? ArmShift::LSR : ArmShift::ASR);
+        uint32_t bits = 0;
+        if (operands[2].kind == MachineOperand::Reg) {
+            bits = (operands[2].regNo << 8) | ((uint32_t) shift << 5) | (1u << 4);
+        } else if ((operands[2].kind != MachineOperand::Imm) || !encodeShift(shift, operands[2].imm, bits)) {
+            return false;
+        }
+        word = 0x01A00000 | (operands[0].regNo << 12) | bits | operands[1].regNo;
+        return true;
+    }
+
+    // 目的寄存器、第一个源寄存器与第二个操作数的位置
+    int32_t rd = -1, rn = -1, op2 = 2;
+    uint32_t setFlags = 0;
+    switch (op) {
+        case ArmOp::MOV:
+        case ArmOp::MVN:
+            rd = 0;
+            op2 = 1;
+            break;
+        case ArmOp::CMP:
+        case ArmOp::CMN:
+            rn = 0;
+            op2 = 1;
+            setFlags = 1;
+            break;
+        default:
+            rd = 0;
+            rn = 1;
+            break;
+    }
+
+    uint32_t bits = 0;
+    if (!encodeOperand2(operands[op2], bits)) {
+        uint32_t value = (uint32_t) operands[op2].imm;
+        if ((operands[op2].kind != MachineOperand::Imm) || !dualImmOpcode(op, value) || !encodeImm(value, bits)) {
+            return false;
+        }
+    }
+
+    word = ((uint32_t) dataProcessingOpcode(op) << 21) | (setFlags << 20) | bits;
+    if (rd >= 0) {
+        word |= operands[rd].regNo << 12;
+    }
+    if (rn >= 0) {
+        word |= operands[rn].regNo << 16;
+    }
+
+    return true;
+}
+
+///
+/// @brief 编码一条指令
+/// @param inst 指令
+/// @param offset 指令在代码段内的偏移
+/// @param word 编码结果
+/// @return true 成功 false 不能编码
+///
+bool EncoderArm32::encodeInst(const MachineInstr * inst, uint32_t offset, uint32_t & word)
+{
+    const MachineOperand * operands = inst->operands;
+
+    // 除移位的寄存器外，寄存器操作数都只用到regNo
+    auto r = [operands](int32_t k) -> uint32_t { return operands[k].regNo; };
+
+    switch (inst->opcode) {
+        case ArmOp::MUL:
+            // mul rd,rm,rs
+            word = 0x00000090 | (r(0) << 16) | (r(2) << 8) | r(1);
+            break;
+        case ArmOp::MLA:
+            // mla rd,rm,rs,ra
+            word = 0x00200090 | (r(0) << 16) | (r(3) << 12) | (r(2) << 8) | r(1);
+            break;
+        case ArmOp::MLS:
+            // mls rd,rn,rm,ra
+            word = 0x00600090 | (r(0) << 16) | (r(3) << 12) | (r(2) << 8) | r(1);
+            break;
+        case ArmOp::SDIV:
+            // sdiv rd,rn,rm
+            word = 0x0710F010 | (r(0) << 16) | (r(2) << 8) | r(1);
+            break;
+        case ArmOp::SMMUL:
+            // smmul rd,rn,rm
+            word = 0x0750F010 | (r(0) << 16) | (r(2) << 8) | r(1);
+            break;
+        case ArmOp::MOVW:
+        case ArmOp::MOVT: {
+            // 符号的地址由链接器填写，REL格式的加数为0
+            const MachineOperand & half = operands[1];
+            uint32_t value = 0;
+            if (half.sym) {
+                uint32_t type = (inst->opcode == ArmOp::MOVW) ? ELF_R_ARM_MOVW_ABS_NC : ELF_R_ARM_MOVT_ABS;
+                fixups.push_back(ArmFixup{offset, half.sym, type});
+            } else if (half.kind == MachineOperand::Lower16) {
+                value = (uint32_t) half.imm & 0xFFFF;
+            } else if (half.kind == MachineOperand::Upper16) {
+                value = ((uint32_t) half.imm >> 16) & 0xFFFF;
+            } else {
+                return false;
+            }
+            word = ((inst->opcode == ArmOp::MOVW) ? 0x03000000 : 0x03400000) | ((value >> 12) << 16) | (r(0) << 12) |
+                   (value & 0xFFF);
+            break;
+        }
+        case ArmOp::LDR:
+        case ArmOp::STR: {
+            uint32_t load = (inst->opcode == ArmOp::LDR) ? (1u << 20) : 0;
+            const MachineOperand & mem = operands[1];
+            if (mem.kind == MachineOperand::Mem) {
+                // ldr rt,[rn,#disp]，U位表示偏移的符号
+                uint32_t up = (mem.imm >= 0) ? (1u << 23) : 0;
+                uint32_t disp = (mem.imm >= 0) ? (uint32_t) mem.imm : (0u - (uint32_t) mem.imm);
+                if (disp > 0xFFF) {
+                    return false;
+                }
+                word = 0x05000000 | up | load | ((uint32_t) mem.regNo << 16) | (r(0) << 12) | disp;
+            } else if (mem.kind == MachineOperand::MemIndex) {
+                // ldr rt,[rn,rm]
+                word = 0x07800000 | load | ((uint32_t) mem.regNo << 16) | (r(0) << 12) | mem.indexNo;
+            } else {
+                return false;
+            }
+            break;
+        }
+        case ArmOp::B: {
+            auto pIter = labels.find(operands[0].sym);
+            if (pIter == labels.end()) {
+                return false;
+            }
+            // 跳转偏移相对于当前指令地址+8，以字为单位
+            int32_t disp = (int32_t) (pIter->second - (offset + 8)) >> 2;
+            word = 0x0A000000 | ((uint32_t) disp & 0xFFFFFF);
+            break;
+        }
+        case ArmOp::BL: {
+            // 加数-8的字偏移，条件执行的调用不能改为blx，采用JUMP24
+            uint32_t type = (inst->cond == ArmCond::AL) ? ELF_R_ARM_CALL : ELF_R_ARM_JUMP24;
+            fixups.push_back(ArmFixup{offset, operands[0].sym, type});
+            word = 0x0BFFFFFE;
+            break;
+        }
+        case ArmOp::BX:
+            word = 0x012FFF10 | r(0);
+            break;
+        case ArmOp::PUSH:
+        case ArmOp::POP: {
+            // 只有一个寄存器时与汇编器一样采用str rt,[sp,#-4]!与ldr rt,[sp],#4
+            int32_t single = singleReg(operands[0].regMask);
+            if (inst->opcode == ArmOp::PUSH) {
+                word = (single >= 0) ? (0x052D0004 | ((uint32_t) single << 12)) : (0x092D0000 | operands[0].regMask);
+            } else {
+                word = (single >= 0) ? (0x049D0004 | ((uint32_t) single << 12)) : (0x08BD0000 | operands[0].regMask);
+            }
+            break;
+        }
+        default:
+            if ((dataProcessingOpcode(inst->opcode) < 0) && (inst->opcode != ArmOp::LSL) &&
+                (inst->opcode != ArmOp::LSR) && (inst->opcode != ArmOp::ASR)) {
+                return false;
+            }
+            if (!encodeDataProcessing(inst, word)) {
+                return false;
+            }
+            break;
+    }
+
+    // 条件码在最高4位
+    word |= (uint32_t) inst->cond << 28;
+
+    return true;
+}
@@ -0,0 +1,96 @@
+///
+/// @file EncoderArm32.h
+/// @brief ARM32机器指令的二进制编码
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，ARM32机器指令的二进制编码
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "MachineInstr.h"
+
+///
+/// @brief 需要链接时确定的符号引用，如函数调用、全局变量的地址
+///
+struct ArmFixup {
+
+    /// @brief 指令在代码段内的偏移
+    uint32_t offset;
+
+    /// @brief 引用的符号名，是ILocArm32区域内驻留的字符串
+    const char * sym;
+
+    /// @brief ELF的重定位类型，如ELF_R_ARM_CALL
+    uint32_t type;
+};
+
+///
+/// @brief ARM32机器指令的编码器，以函数为单位把指令序列编码为A32指令追加到代码段
+///
+/// 函数内的Label在编码时直接计算跳转的偏移，函数名与全局变量等外部符号记录为ArmFixup，
+/// 由调用者转换为目标文件的重定位。
+///
+class EncoderArm32 {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _text 代码段的内容，编码结果追加到末尾
+    ///
+    explicit EncoderArm32(std::vector<uint8_t> & _text);
+
+    ///
+    /// @brief 编码一个函数的指令序列，无效指令、NOP、注释不编码
+    /// @param code 指令序列
+    /// @return true 成功 false 存在不能编码的指令
+    ///
+    bool encode(const std::vector<MachineInstr *> & code);
+
+    ///
+    /// @brief 获取编码过程中产生的符号引用，符号名随指令序列一起释放，需及时处理
+    /// @return std::vector<ArmFixup>& 符号引用
+    ///
+    std::vector<ArmFixup> & getFixups()
+    {
+        return fixups;
+    }
+
+private:
+    ///
+    /// @brief 编码一条指令
+    /// @param inst 指令
+    /// @param offset 指令在代码段内的偏移
+    /// @param word 编码结果
+    /// @return true 成功 false 不能编码
+    ///
+    bool encodeInst(const MachineInstr * inst, uint32_t offset, uint32_t & word);
+
+    ///
+    /// @brief 编码数据处理指令，如add、mov、cmp，立即数不能编码时尝试对偶的指令
+    /// @param inst 指令
+    /// @param word 编码结果
+    /// @return true 成功 false 不能编码
+    ///
+    bool encodeDataProcessing(const MachineInstr * inst, uint32_t & word);
+
+    /// @brief 代码段的内容
+    std::vector<uint8_t> & text;
+
+    /// @brief 函数内Label的偏移，Label名称是驻留的字符串，可直接比较指针
+    std::unordered_map<const char *, uint32_t> labels;
+
+    /// @brief 符号引用
+    std::vector<ArmFixup> fixups;
+};
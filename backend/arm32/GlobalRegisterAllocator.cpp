@@ -0,0 +1,184 @@
+///
+/// @file GlobalRegisterAllocator.cpp
+/// @brief 基于活跃变量分析的全局寄存器分配器基类
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，线性扫描与图着色分配器共用的编号与活跃变量分析
+/// </table>
+///
+#include <cstdint>
+
+#include "Common.h"
+#include "GlobalRegisterAllocator.h"
+#include "ControlFlowGraph.h"
+#include "LocalVariable.h"
+
+///
+/// @brief 构造函数
+/// @param _func 要分配寄存器的函数
+///
+GlobalRegisterAllocator::GlobalRegisterAllocator(Function * _func)
+    : func(_func), insts(_func->getInterCode().begin(), _func->getInterCode().end())
+{}
+
+///
+/// @brief 获取分配过程中使用过的寄存器，这些寄存器在函数入口需要保护
+/// @return std::vector<int32_t>& 寄存器编号，从小到大
+///
+std::vector<int32_t> & GlobalRegisterAllocator::getUsedRegs()
+{
+    return usedRegs;
+}
+
+///
+/// @brief 检查Value是否需要参与寄存器分配
+/// @param val Value
+/// @return true 局部变量或者有值的指令
+///
+bool GlobalRegisterAllocator::isCandidate(Value * val)
+{
+    // 已经在栈内分配的变量不再参与分配
+    if (val->getMemoryAddr()) {
+        return false;
+    }
+
+    if (dynamic_cast<LocalVariable *>(val)) {
+        return true;
+    }
+
+    Instanceof(inst, Instruction *, val);
+
+    return inst && inst->hasResultValue();
+}
+
+///
+/// @brief 获取指令的使用与定值的Value
+/// @param inst 指令
+/// @param uses 使用的Value
+/// @return Value* 定值的Value，没有返回nullptr
+///
+Value * GlobalRegisterAllocator::getUseDef(Instruction * inst, std::vector<Value *> & uses)
+{
+    uses.clear();
+
+    if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) {
+        // 赋值指令：第一个操作数为目的操作数，第二个为源操作数
+        uses.push_back(inst->getOperand(1));
+        return inst->getOperand(0);
+    }
+
+    uses = inst->getOperandsValue();
+
+    return inst->hasResultValue() ? inst : nullptr;
+}
+
+///
+/// @brief 获取Value的编号，首次遇到时编号
+/// @param val Value
+/// @return int32_t 编号，不参与分配时返回-1
+///
+int32_t GlobalRegisterAllocator::valueIndex(Value * val)
+{
+    if (val == nullptr) {
+        return -1;
+    }
+
+    auto pIter = valueIds.find(val);
+    if (pIter != valueIds.end()) {
+        return pIter->second;
+    }
+
+    if (!isCandidate(val)) {
+        return -1;
+    }
+
+    int32_t id = (int32_t) values.size();
+    valueIds[val] = id;
+    values.push_back(val);
+
+    return id;
+}
+
+///
+/// @brief 根据函数的控制流图建立基本块以及后继关系
+///
+void GlobalRegisterAllocator::buildBlocks()
+{
+    ControlFlowGraph * cfg = func->getCFG();
+
+    // 控制流图的基本块在线性IR中连续排列，据此得到每个基本块的指令序号范围
+    int32_t first = 0;
+    for (auto bb: cfg->getBlocks()) {
+
+        int32_t last = first + (int32_t) bb->getInsts().size() - 1;
+
+        std::vector<int32_t> succs;
+        for (auto succ: bb->getSuccs()) {
+            succs.push_back(succ->getIndex());
+        }
+
+        blocks.push_back(Block{first, last, succs, Set(), Set(), Set(), Set()});
+
+        first = last + 1;
+    }
+}
+
+///
+/// @brief 迭代求解活跃变量数据流方程
+///
+void GlobalRegisterAllocator::computeLiveness()
+{
+    std::vector<Value *> uses;
+
+    // 计算每个基本块的use与def集合，use为定值前被使用的Value
+    for (auto & block: blocks) {
+
+        for (int32_t k = block.first; k <= block.last; ++k) {
+
+            Value * def = getUseDef(insts[k], uses);
+
+            for (auto use: uses) {
+                int32_t id = valueIndex(use);
+                if ((id != -1) && !block.def.get(id)) {
+                    block.use.set(id);
+                }
+            }
+
+            int32_t id = valueIndex(def);
+            if (id != -1) {
+                block.def.set(id);
+            }
+        }
+    }
+
+    // 逆序迭代直到不动点：out[B] = U in[S]，in[B] = use[B] U (out[B] - def[B])
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        for (int32_t b = (int32_t) blocks.size() - 1; b >= 0; --b) {
+
+            Block & block = blocks[b];
+
+            Set out;
+            for (auto succ: block.succs) {
+                out = out | blocks[succ].liveIn;
+            }
+
+            Set in = block.use | (out - block.def);
+
+            if (in != block.liveIn || out != block.liveOut) {
+                block.liveIn = in;
+                block.liveOut = out;
+                changed = true;
+            }
+        }
+    }
+}
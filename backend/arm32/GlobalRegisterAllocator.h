@@ -0,0 +1,134 @@
+///
+/// @file GlobalRegisterAllocator.h
+/// @brief 基于活跃变量分析的全局寄存器分配器基类
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，线性扫描与图着色分配器共用的编号与活跃变量分析
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Function.h"
+#include "Instruction.h"
+#include "Set.h"
+#include "Value.h"
+
+///
+/// @brief 全局寄存器分配器基类
+///
+/// 对函数的线性IR进行基本块划分，并通过活跃变量分析得到每个基本块入口与出口活跃的Value，
+/// 局部变量与临时变量在此基础上由派生类分配r4-r10寄存器。分配失败的Value不设置寄存器编号，
+/// 由栈空间分配为其分配栈内空间。
+///
+class GlobalRegisterAllocator {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 要分配寄存器的函数
+    ///
+    explicit GlobalRegisterAllocator(Function * _func);
+
+    ///
+    /// @brief 析构函数
+    ///
+    virtual ~GlobalRegisterAllocator() = default;
+
+    ///
+    /// @brief 执行寄存器分配，分配成功的Value设置寄存器编号
+    ///
+    virtual void run() = 0;
+
+    ///
+    /// @brief 获取分配过程中使用过的寄存器，这些寄存器在函数入口需要保护
+    /// @return std::vector<int32_t>& 寄存器编号，从小到大
+    ///
+    std::vector<int32_t> & getUsedRegs();
+
+protected:
+    ///
+    /// @brief 基本块，记录指令序号范围、后继以及数据流分析的集合
+    ///
+    struct Block {
+        int32_t first;
+        int32_t last;
+        std::vector<int32_t> succs;
+        Set use;
+        Set def;
+        Set liveIn;
+        Set liveOut;
+    };
+
+    ///
+    /// @brief 检查Value是否需要参与寄存器分配
+    /// @param val Value
+    /// @return true 局部变量或者有值的指令
+    ///
+    virtual bool isCandidate(Value * val);
+
+    ///
+    /// @brief 获取指令的使用与定值的Value
+    /// @param inst 指令
+    /// @param uses 使用的Value
+    /// @return Value* 定值的Value，没有返回nullptr
+    ///
+    static Value * getUseDef(Instruction * inst, std::vector<Value *> & uses);
+
+    ///
+    /// @brief 获取Value的编号，首次遇到时编号
+    /// @param val Value
+    /// @return int32_t 编号，不参与分配时返回-1
+    ///
+    int32_t valueIndex(Value * val);
+
+    ///
+    /// @brief 根据函数的控制流图建立基本块以及后继关系
+    ///
+    void buildBlocks();
+
+    ///
+    /// @brief 迭代求解活跃变量数据流方程
+    ///
+    void computeLiveness();
+
+    ///
+    /// @brief 要处理的函数
+    ///
+    Function * func;
+
+    ///
+    /// @brief 函数的指令列表，下标即指令在线性IR中的序号
+    ///
+    std::vector<Instruction *> insts;
+
+    ///
+    /// @brief 基本块列表，按照指令的先后次序
+    ///
+    std::vector<Block> blocks;
+
+    ///
+    /// @brief 参与分配的Value与编号的映射
+    ///
+    std::unordered_map<Value *, int32_t> valueIds;
+
+    ///
+    /// @brief 编号对应的Value
+    ///
+    std::vector<Value *> values;
+
+    ///
+    /// @brief 使用过的寄存器
+    ///
+    std::vector<int32_t> usedRegs;
+};
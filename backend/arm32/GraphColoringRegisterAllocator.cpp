@@ -0,0 +1,496 @@
+///
+/// @file GraphColoringRegisterAllocator.cpp
+/// @brief 基于干涉图着色的寄存器分配器
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，-O2时使用的图着色寄存器分配
+/// </table>
+///
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <unordered_set>
+#include <utility>
+
+#include "Common.h"
+#include "GraphColoringRegisterAllocator.h"
+#include "PlatformArm32.h"
+#include "RegVariable.h"
+#include "FormalParam.h"
+
+/// @brief 可着色的寄存器个数，即r4-r10
+#define ARM32_ALLOC_REG_NUM (ARM32_ALLOC_REG_LAST - ARM32_ALLOC_REG_FIRST + 1)
+
+/// @brief 干涉图的边在边集合中的键，与两个Value的先后无关
+/// @param a Value编号
+/// @param b Value编号
+/// @return uint64_t 编号小的在高32位
+static uint64_t edgeKey(int32_t a, int32_t b)
+{
+    if (a > b) {
+        std::swap(a, b);
+    }
+
+    return ((uint64_t) a << 32) | (uint32_t) b;
+}
+
+///
+/// @brief 构造函数
+/// @param _func 要分配寄存器的函数
+///
+GraphColoringRegisterAllocator::GraphColoringRegisterAllocator(Function * _func) : GlobalRegisterAllocator(_func)
+{}
+
+///
+/// @brief 检查Value是否需要参与寄存器分配，寄存器传值的形参也加入干涉图
+/// @param val Value
+/// @return true 局部变量、有值的指令或者寄存器传值的形参
+///
+bool GraphColoringRegisterAllocator::isCandidate(Value * val)
+{
+    if (dynamic_cast<FormalParam *>(val)) {
+        return val->getRegId() != -1;
+    }
+
+    return GlobalRegisterAllocator::isCandidate(val);
+}
+
+///
+/// @brief 执行寄存器分配，分配成功的Value设置寄存器编号
+///
+void GraphColoringRegisterAllocator::run()
+{
+    // 基本块划分与活跃变量分析
+    buildBlocks();
+    computeLiveness();
+
+    // 循环嵌套深度用于溢出代价的计算
+    computeLoopDepth();
+
+    // 干涉图构建
+    buildInterferenceGraph();
+
+    // 实参与返回值的复制指令预着色
+    precolorArgMoves();
+
+    // 复制指令合并
+    coalesce();
+
+    // 着色分配寄存器
+    colorGraph();
+}
+
+///
+/// @brief 根据回边计算每个基本块所在循环的嵌套深度
+///
+void GraphColoringRegisterAllocator::computeLoopDepth()
+{
+    loopDepth.assign(blocks.size(), 0);
+
+    // 线性IR中循环体位于循环入口与回边跳转之间，回边即跳转到前面（含自身）基本块的边
+    for (int32_t b = 0; b < (int32_t) blocks.size(); ++b) {
+        for (auto succ: blocks[b].succs) {
+            if (succ <= b) {
+                for (int32_t k = succ; k <= b; ++k) {
+                    loopDepth[k]++;
+                }
+            }
+        }
+    }
+}
+
+///
+/// @brief 干涉图中增加一条边
+/// @param a Value编号
+/// @param b Value编号
+///
+void GraphColoringRegisterAllocator::addEdge(int32_t a, int32_t b)
+{
+    if ((a != b) && adjSet.insert(edgeKey(a, b)).second) {
+        adjList[a].push_back(b);
+        adjList[b].push_back(a);
+    }
+}
+
+///
+/// @brief 检查两个Value在干涉图中是否相邻
+/// @param a Value编号
+/// @param b Value编号
+/// @return true 干涉 false 不干涉
+///
+bool GraphColoringRegisterAllocator::interfere(int32_t a, int32_t b) const
+{
+    return adjSet.count(edgeKey(a, b)) != 0;
+}
+
+///
+/// @brief 删除干涉图中与Value相连的所有边
+/// @param id Value编号
+///
+void GraphColoringRegisterAllocator::removeEdges(int32_t id)
+{
+    for (auto adj: adjList[id]) {
+        adjSet.erase(edgeKey(id, adj));
+
+        auto & list = adjList[adj];
+        list.erase(std::find(list.begin(), list.end(), id));
+    }
+
+    adjList[id].clear();
+}
+
+///
+/// @brief 构建干涉图，同时计算溢出代价以及收集复制指令
+///
+void GraphColoringRegisterAllocator::buildInterferenceGraph()
+{
+    int32_t valueNum = (int32_t) values.size();
+
+    adjSet.clear();
+    adjList.assign(valueNum, std::vector<int32_t>());
+    spillCost.assign(valueNum, 0);
+    srcLastUse.assign(insts.size(), false);
+    moves.clear();
+
+    std::vector<Value *> uses;
+
+    for (int32_t b = 0; b < (int32_t) blocks.size(); ++b) {
+
+        Block & block = blocks[b];
+
+        // 循环内每层嵌套的执行次数按照10次估计
+        double weight = 1;
+        for (int32_t depth = 0; depth < loopDepth[b]; ++depth) {
+            weight *= 10;
+        }
+
+        // 活跃集合只包含活跃的Value编号，定值点只需遍历活跃的Value
+        std::unordered_set<int32_t> live;
+        for (auto id: block.liveOut) {
+            live.insert((int32_t) id);
+        }
+
+        // 从基本块的出口逆序遍历，定值点与此时所有活跃的Value干涉
+        for (int32_t k = block.last; k >= block.first; --k) {
+
+            Instruction * inst = insts[k];
+            Value * def = getUseDef(inst, uses);
+            int32_t defId = valueIndex(def);
+
+            // 复制指令的源与目的不干涉，以便合并
+            int32_t moveSrcId = -1;
+            if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) {
+                int32_t srcId = valueIndex(uses[0]);
+                if (srcId != -1) {
+                    srcLastUse[k] = live.count(srcId) == 0;
+                    if (defId != -1) {
+                        moveSrcId = srcId;
+                        moves.emplace_back(defId, srcId);
+                    }
+                }
+            }
+
+            if (defId != -1) {
+                for (auto id: live) {
+                    if (id != moveSrcId) {
+                        addEdge(defId, id);
+                    }
+                }
+                live.erase(defId);
+                spillCost[defId] += weight;
+            }
+
+            for (auto use: uses) {
+                int32_t id = valueIndex(use);
+                if (id != -1) {
+                    live.insert(id);
+                    spillCost[id] += weight;
+                }
+            }
+        }
+    }
+}
+
+///
+/// @brief 实参传递以及返回值的复制指令涉及的临时变量预着色为r0-r3寄存器
+///
+void GraphColoringRegisterAllocator::precolorArgMoves()
+{
+    int32_t valueNum = (int32_t) values.size();
+
+    precolored.assign(valueNum, -1);
+
+    // 寄存器传值的形参预着色为其寄存器，下标为寄存器编号，没有形参或者形参没有使用时为-1
+    int32_t paramNode[PlatformArm32::maxRegNum];
+    std::fill(std::begin(paramNode), std::end(paramNode), -1);
+    for (auto param: func->getParams()) {
+        auto pIter = valueIds.find(param);
+        if (pIter != valueIds.end()) {
+            precolored[pIter->second] = param->getRegId();
+            paramNode[param->getRegId()] = pIter->second;
+        }
+    }
+
+    // 与形参干涉的Value不能预着色为形参的寄存器
+    auto paramConflict = [&](int32_t id, int32_t regId) {
+        return (paramNode[regId] != -1) && interfere(id, paramNode[regId]);
+    };
+
+    std::vector<Value *> uses;
+
+    for (auto & block: blocks) {
+
+        for (int32_t k = block.first; k <= block.last; ++k) {
+
+            Instruction * inst = insts[k];
+            if (inst->getOp() != IRInstOperator::IRINST_OP_ASSIGN) {
+                continue;
+            }
+
+            Value * dest = inst->getOperand(0);
+            Value * src = inst->getOperand(1);
+
+            if (Instanceof(destReg, RegVariable *, dest)) {
+
+                // 实参传递：mov rK, v，要求v为临时变量且此后不再使用
+                int32_t id = valueIndex(src);
+                int32_t regId = destReg->getRegId();
+                if ((id == -1) || !srcLastUse[k] || (precolored[id] != -1) || paramConflict(id, regId) ||
+                    !dynamic_cast<Instruction *>(src)) {
+                    continue;
+                }
+
+                // v的定值点与复制指令之间只能是实参复制指令，这些指令不会用到r0-r3作为临时寄存器
+                for (int32_t j = k - 1; j >= block.first; --j) {
+
+                    Value * def = getUseDef(insts[j], uses);
+                    if (def == src) {
+
+                        // 函数调用的结果在调用后由r0复制，定值指令不能是函数调用，也不能使用自身
+                        if ((insts[j]->getOp() != IRInstOperator::IRINST_OP_FUNC_CALL) &&
+                            (std::find(uses.begin(), uses.end(), src) == uses.end())) {
+                            precolored[id] = regId;
+                        }
+                        break;
+                    }
+
+                    if ((insts[j]->getOp() != IRInstOperator::IRINST_OP_ASSIGN) ||
+                        !dynamic_cast<RegVariable *>(insts[j]->getOperand(0))) {
+                        break;
+                    }
+                }
+
+            } else if (Instanceof(srcReg, RegVariable *, src)) {
+
+                // 函数返回值：v = r0，要求v紧接着被复制且此后不再使用
+                int32_t id = valueIndex(dest);
+                int32_t regId = srcReg->getRegId();
+                if ((id == -1) || (precolored[id] != -1) || paramConflict(id, regId) || (k + 1 > block.last) ||
+                    !dynamic_cast<Instruction *>(dest)) {
+                    continue;
+                }
+
+                Instruction * nextInst = insts[k + 1];
+                if ((nextInst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) && (nextInst->getOperand(1) == dest) &&
+                    (nextInst->getOperand(0) != dest) && srcLastUse[k + 1]) {
+                    precolored[id] = regId;
+                }
+            }
+        }
+    }
+
+    // 预着色的Value不参与着色，从干涉图中删除
+    for (int32_t id = 0; id < valueNum; ++id) {
+        if (precolored[id] != -1) {
+            removeEdges(id);
+        }
+    }
+}
+
+///
+/// @brief 查找合并后代表的Value编号
+/// @param id Value编号
+/// @return int32_t 代表的Value编号
+///
+int32_t GraphColoringRegisterAllocator::getAlias(int32_t id)
+{
+    while (alias[id] != id) {
+        id = alias[id];
+    }
+
+    return id;
+}
+
+///
+/// @brief 按照Briggs准则或George准则保守合并复制指令两侧的Value
+///
+void GraphColoringRegisterAllocator::coalesce()
+{
+    int32_t valueNum = (int32_t) values.size();
+
+    alias.resize(valueNum);
+    for (int32_t id = 0; id < valueNum; ++id) {
+        alias[id] = id;
+    }
+
+    // 合并后度数会发生变化，重复直到没有可合并的复制指令
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        for (auto & move: moves) {
+
+            int32_t a = getAlias(move.first);
+            int32_t b = getAlias(move.second);
+
+            if ((a == b) || (precolored[a] != -1) || (precolored[b] != -1) || interfere(a, b)) {
+                continue;
+            }
+
+            // Briggs准则：合并后高度数邻居的个数小于可用寄存器个数，则合并不会使得原本可着色的图变得不可着色
+            int32_t significant = 0;
+            auto countSignificant = [&](int32_t adj) {
+                int32_t degree = (int32_t) adjList[adj].size();
+                if (interfere(adj, a) && interfere(adj, b)) {
+                    degree--;
+                }
+                if (degree >= ARM32_ALLOC_REG_NUM) {
+                    significant++;
+                }
+            };
+
+            for (auto adj: adjList[a]) {
+                countSignificant(adj);
+            }
+            for (auto adj: adjList[b]) {
+                if (!interfere(adj, a)) {
+                    countSignificant(adj);
+                }
+            }
+
+            // George准则：b的每个邻居要么已与a干涉，要么度数小于可用寄存器个数，则b可合并到a中。
+            // 活跃范围长的变量度数很高时Briggs准则不成立，短的临时变量合并到其中时用此准则
+            auto george = [&](int32_t x, int32_t y) {
+                for (auto adj: adjList[y]) {
+                    if (!interfere(adj, x) && ((int32_t) adjList[adj].size() >= ARM32_ALLOC_REG_NUM)) {
+                        return false;
+                    }
+                }
+                return true;
+            };
+
+            if (significant >= ARM32_ALLOC_REG_NUM) {
+                if (george(b, a)) {
+                    std::swap(a, b);
+                } else if (!george(a, b)) {
+                    continue;
+                }
+            }
+
+            // b合并到a中
+            alias[b] = a;
+            spillCost[a] += spillCost[b];
+            std::vector<int32_t> neighbors = adjList[b];
+            removeEdges(b);
+            for (auto adj: neighbors) {
+                addEdge(a, adj);
+            }
+
+            changed = true;
+        }
+    }
+}
+
+///
+/// @brief 简化与乐观着色，分配r4-r10寄存器
+///
+void GraphColoringRegisterAllocator::colorGraph()
+{
+    int32_t valueNum = (int32_t) values.size();
+
+    // 参与着色的结点为合并后的代表结点，预着色的结点除外
+    std::vector<bool> inGraph(valueNum, false);
+    std::vector<int32_t> degree(valueNum, 0);
+    int32_t nodeNum = 0;
+    for (int32_t id = 0; id < valueNum; ++id) {
+        if ((getAlias(id) == id) && (precolored[id] == -1)) {
+            inGraph[id] = true;
+            degree[id] = (int32_t) adjList[id].size();
+            nodeNum++;
+        }
+    }
+
+    // 简化：反复移除度数小于可用寄存器个数的结点，没有时按照溢出代价选择结点乐观移除
+    std::vector<int32_t> selectStack;
+    while (nodeNum > 0) {
+
+        int32_t node = -1;
+        for (int32_t id = 0; id < valueNum; ++id) {
+            if (inGraph[id] && (degree[id] < ARM32_ALLOC_REG_NUM)) {
+                node = id;
+                break;
+            }
+        }
+
+        if (node == -1) {
+            for (int32_t id = 0; id < valueNum; ++id) {
+                if (inGraph[id] &&
+                    ((node == -1) || (spillCost[id] / degree[id] < spillCost[node] / degree[node]))) {
+                    node = id;
+                }
+            }
+        }
+
+        inGraph[node] = false;
+        nodeNum--;
+        for (auto adj: adjList[node]) {
+            degree[adj]--;
+        }
+        selectStack.push_back(node);
+    }
+
+    // 着色：按照移除的逆序选择邻居没有使用的编号最小的寄存器，没有时实际溢出
+    color.assign(valueNum, -1);
+    bool regUsed[PlatformArm32::maxRegNum] = {false};
+
+    while (!selectStack.empty()) {
+
+        int32_t node = selectStack.back();
+        selectStack.pop_back();
+
+        bool regBusy[PlatformArm32::maxRegNum] = {false};
+        for (auto adj: adjList[node]) {
+            if (color[adj] != -1) {
+                regBusy[color[adj]] = true;
+            }
+        }
+
+        for (int32_t reg = ARM32_ALLOC_REG_FIRST; reg <= ARM32_ALLOC_REG_LAST; ++reg) {
+            if (!regBusy[reg]) {
+                color[node] = reg;
+                regUsed[reg] = true;
+                break;
+            }
+        }
+    }
+
+    // 设置每个Value的寄存器，溢出的Value由栈空间分配处理
+    for (int32_t id = 0; id < valueNum; ++id) {
+        int32_t node = getAlias(id);
+        values[id]->setRegId(precolored[node] != -1 ? precolored[node] : color[node]);
+    }
+
+    usedRegs.clear();
+    for (int32_t reg = ARM32_ALLOC_REG_FIRST; reg <= ARM32_ALLOC_REG_LAST; ++reg) {
+        if (regUsed[reg]) {
+            usedRegs.push_back(reg);
+        }
+    }
+}
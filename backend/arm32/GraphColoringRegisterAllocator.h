@@ -0,0 +1,156 @@
+///
+/// @file GraphColoringRegisterAllocator.h
+/// @brief 基于干涉图着色的寄存器分配器
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，-O2时使用的图着色寄存器分配
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "GlobalRegisterAllocator.h"
+
+///
+/// @brief 图着色寄存器分配器（Chaitin-Briggs），-O2时使用
+///
+/// 在活跃变量分析的基础上构建干涉图，对赋值指令两侧的Value进行保守合并（Briggs准则或George准则），
+/// 然后通过简化与乐观着色为其分配r4-r10寄存器。溢出代价为定值与使用次数按照所在循环的嵌套深度加权，
+/// 寄存器不够时优先溢出代价与度数之比最小的Value。
+///
+/// 函数调用前向r0-r3传递实参的复制指令，若实参的临时变量在定值后直到复制指令之间只有实参复制指令，
+/// 则该临时变量直接分配到对应的r0-r3寄存器，从而消除复制指令，函数调用的返回值类似处理。
+/// 寄存器传值的形参作为预着色的结点加入干涉图，与其活跃期间的Value干涉，这样的Value不能预着色为该形参的寄存器。
+///
+class GraphColoringRegisterAllocator : public GlobalRegisterAllocator {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 要分配寄存器的函数
+    ///
+    explicit GraphColoringRegisterAllocator(Function * _func);
+
+    ///
+    /// @brief 执行寄存器分配，分配成功的Value设置寄存器编号
+    ///
+    void run() override;
+
+protected:
+    ///
+    /// @brief 检查Value是否需要参与寄存器分配，寄存器传值的形参也加入干涉图
+    /// @param val Value
+    /// @return true 局部变量、有值的指令或者寄存器传值的形参
+    ///
+    bool isCandidate(Value * val) override;
+
+    ///
+    /// @brief 根据回边计算每个基本块所在循环的嵌套深度
+    ///
+    void computeLoopDepth();
+
+    ///
+    /// @brief 构建干涉图，同时计算溢出代价以及收集复制指令
+    ///
+    void buildInterferenceGraph();
+
+    ///
+    /// @brief 实参传递以及返回值的复制指令涉及的临时变量预着色为r0-r3寄存器
+    ///
+    void precolorArgMoves();
+
+    ///
+    /// @brief 按照Briggs准则或George准则保守合并复制指令两侧的Value
+    ///
+    void coalesce();
+
+    ///
+    /// @brief 简化与乐观着色，分配r4-r10寄存器
+    ///
+    void colorGraph();
+
+    ///
+    /// @brief 干涉图中增加一条边
+    /// @param a Value编号
+    /// @param b Value编号
+    ///
+    void addEdge(int32_t a, int32_t b);
+
+    ///
+    /// @brief 检查两个Value在干涉图中是否相邻
+    /// @param a Value编号
+    /// @param b Value编号
+    /// @return true 干涉 false 不干涉
+    ///
+    [[nodiscard]] bool interfere(int32_t a, int32_t b) const;
+
+    ///
+    /// @brief 删除干涉图中与Value相连的所有边
+    /// @param id Value编号
+    ///
+    void removeEdges(int32_t id);
+
+    ///
+    /// @brief 查找合并后代表的Value编号
+    /// @param id Value编号
+    /// @return int32_t 代表的Value编号
+    ///
+    int32_t getAlias(int32_t id);
+
+private:
+    ///
+    /// @brief 每个基本块的循环嵌套深度
+    ///
+    std::vector<int32_t> loopDepth;
+
+    ///
+    /// @brief 干涉图的边集合，编号小的Value在高32位，用于判断两个Value是否干涉
+    ///
+    std::unordered_set<uint64_t> adjSet;
+
+    ///
+    /// @brief 干涉图的邻接表，下标为Value编号，用于遍历邻居以及得到度数
+    ///
+    std::vector<std::vector<int32_t>> adjList;
+
+    ///
+    /// @brief 每个Value的溢出代价
+    ///
+    std::vector<double> spillCost;
+
+    ///
+    /// @brief 合并后的代表Value编号，自身为代表时为自己
+    ///
+    std::vector<int32_t> alias;
+
+    ///
+    /// @brief 预着色的寄存器编号，-1表示没有预着色
+    ///
+    std::vector<int32_t> precolored;
+
+    ///
+    /// @brief 着色分配的寄存器编号，-1表示溢出
+    ///
+    std::vector<int32_t> color;
+
+    ///
+    /// @brief 两侧都参与分配的复制指令，分别为目的与源的Value编号
+    ///
+    std::vector<std::pair<int32_t, int32_t>> moves;
+
+    ///
+    /// @brief 复制指令的源操作数在该指令后是否不再活跃，下标为指令序号
+    ///
+    std::vector<bool> srcLastUse;
+};
@@ -22,98 +22,33 @@
 #include "PlatformArm32.h"
 #include "Module.h"
 
-ArmInst::ArmInst(std::string _opcode,
-                 std::string _result,
-                 std::string _arg1,
-                 std::string _arg2,
-                 std::string _cond,
-                 std::string _addition)
-    : opcode(_opcode), cond(_cond), result(_result), arg1(_arg1), arg2(_arg2), addition(_addition), dead(false)
-{}
-
-/*
-    指令内容替换
-*/
-void ArmInst::replace(std::string _opcode,
-                      std::string _result,
-                      std::string _arg1,
-                      std::string _arg2,
-                      std::string _cond,
-                      std::string _addition)
+/// @brief 在区域内创建指令并追加到序列末尾
+/// @param op 操作码
+/// @return 指令
+MachineInstr * ILocArm32::emit(ArmOp op,
+                               const MachineOperand & op0,
+                               const MachineOperand & op1,
+                               const MachineOperand & op2,
+                               const MachineOperand & op3)
 {
-    opcode = _opcode;
-    result = _result;
-    arg1 = _arg1;
-    arg2 = _arg2;
-    cond = _cond;
-    addition = _addition;
-
-#if 0
-    // 空操作，则设置为dead
-    if (op == "") {
-        dead = true;
-    }
-#endif
+    MachineInstr * inst = arena.create<MachineInstr>(op, op0, op1, op2, op3);
+    code.push_back(inst);
+
+    return inst;
 }
 
-/*
-    设置为无效指令
-*/
-void ArmInst::setDead()
+/// @brief 寄存器操作数
+static inline MachineOperand reg(int32_t regNo)
 {
-    dead = true;
+    return MachineOperand::reg(regNo);
 }
 
-/*
-    输出函数
-*/
-std::string ArmInst::outPut()
+/// @brief 立即数操作数
+static inline MachineOperand imm(int32_t num)
 {
-    // 无用代码，什么都不输出
-    if (dead) {
-        return "";
-    }
-
-    // 占位指令,可能需要输出一个空操作，看是否支持 FIXME
-    if (opcode.empty()) {
-        return "";
-    }
-
-    std::string ret = opcode;
-
-    if (!cond.empty()) {
-        ret += cond;
-    }
-
-    // 结果输出
-    if (!result.empty()) {
-        if (result == ":") {
-            ret += result;
-        } else {
-            ret += " " + result;
-        }
-    }
-
-    // 第一元参数输出
-    if (!arg1.empty()) {
-        ret += "," + arg1;
-    }
-
-    // 第二元参数输出
-    if (!arg2.empty()) {
-        ret += "," + arg2;
-    }
-
-    // 其他附加信息输出
-    if (!addition.empty()) {
-        ret += "," + addition;
-    }
-
-    return ret;
+    return MachineOperand::immediate(num);
 }
 
-#define emit(...) code.push_back(new ArmInst(__VA_ARGS__))
-
 /// @brief 构造函数
 /// @param _module 符号表
 ILocArm32::ILocArm32(Module * _module)
@@ -124,86 +59,74 @@ ILocArm32::ILocArm32(Module * _module)
 /// @brief 析构函数
 ILocArm32::~ILocArm32()
 {
-    std::list<ArmInst *>::iterator pIter;
-
-    for (pIter = code.begin(); pIter != code.end(); ++pIter) {
-        delete (*pIter);
-    }
+    // 指令都在区域内分配，随区域一起释放
 }
 
 /// @brief 删除无用的Label指令
 void ILocArm32::deleteUnusedLabel()
 {
-    std::list<ArmInst *> labelInsts;
-    for (ArmInst * arm: code) {
-        if ((!arm->dead) && (arm->opcode[0] == '.') && (arm->result == ":")) {
-            labelInsts.push_back(arm);
+    // 被跳转指令引用的Label，Label名称是驻留的字符串，可直接比较指针
+    std::unordered_map<const char *, bool> labelUsed;
+    for (MachineInstr * arm: code) {
+        if ((!arm->dead) && arm->isBranch()) {
+            labelUsed[arm->operands[0].sym] = true;
         }
     }
 
-    // 检测Label指令是否在被使用，也就是是否有跳转到该Label的指令
-    // 如果没有使用，则设置为dead
-    for (ArmInst * labelArm: labelInsts) {
-        bool labelUsed = false;
-
-        for (ArmInst * arm: code) {
-            // TODO 转移语句的指令标识符根据定义修改判断
-            if ((!arm->dead) && (arm->opcode[0] == 'b') && (arm->result == labelArm->opcode)) {
-                labelUsed = true;
-                break;
-            }
-        }
-
-        if (!labelUsed) {
-            labelArm->setDead();
+    // 没有跳转到该Label的指令则设置为dead
+    for (MachineInstr * arm: code) {
+        if ((!arm->dead) && arm->isLabel() && !labelUsed[arm->operands[0].sym]) {
+            arm->setDead();
         }
     }
 }
 
 /// @brief 输出汇编
-/// @param file 输出的文件指针
+/// @param writer 汇编输出
 /// @param outputEmpty 是否输出空语句
-void ILocArm32::outPut(FILE * file, bool outputEmpty)
+void ILocArm32::outPut(AsmWriter & writer, bool outputEmpty)
 {
     for (auto arm: code) {
 
-        std::string s = arm->outPut();
-
-        if (arm->result == ":") {
-            // Label指令，不需要Tab输出
-            fprintf(file, "%s\n", s.c_str());
+        if (arm->dead || (arm->opcode == ArmOp::NOP)) {
+            // 删除的Label不输出
+            if (outputEmpty && !arm->isLabel()) {
+                writer << '\n';
+            }
             continue;
         }
 
-        if (!s.empty()) {
-            fprintf(file, "\t%s\n", s.c_str());
-        } else if ((outputEmpty)) {
-            fprintf(file, "\n");
+        // Label指令，不需要Tab输出
+        if (!arm->isLabel()) {
+            writer << '\t';
         }
+
+        arm->print(writer);
+        writer << '\n';
     }
 }
 
 /// @brief 获取当前的代码序列
 /// @return 代码序列
-std::list<ArmInst *> & ILocArm32::getCode()
+std::vector<MachineInstr *> & ILocArm32::getCode()
 {
     return code;
 }
 
-/**
- * 数字变字符串，若flag为真，则变为立即数寻址（加#）
- */
-std::string ILocArm32::toStr(int num, bool flag)
+/// @brief 驻留Label、函数名等符号，同名的符号返回同一个指针
+/// @param name 符号名
+/// @return 区域内的符号名
+const char * ILocArm32::symbol(const std::string & name)
 {
-    std::string ret;
-
-    if (flag) {
-        ret = "#";
+    auto pIter = symbols.find(name);
+    if (pIter != symbols.end()) {
+        return pIter->second;
     }
 
-    ret += std::to_string(num);
+    const char * sym = arena.copyString(name);
+    symbols.emplace(name, sym);
 
-    return ret;
+    return sym;
 }
 
 /*
@@ -212,34 +135,37 @@ std::string ILocArm32::toStr(int num, bool flag)
 void ILocArm32::label(std::string name)
 {
     // .L1:
-    emit(name, ":");
+    emit(ArmOp::LABEL, MachineOperand::label(symbol(name)));
 }
 
-/// @brief 0个源操作数指令
-/// @param op 操作码
-/// @param rs 操作数
-void ILocArm32::inst(std::string op, std::string rs)
-{
-    emit(op, rs);
-}
-
-/// @brief 一个操作数指令
+/// @brief 指令，操作数的种类为None时不输出
 /// @param op 操作码
 /// @param rs 操作数
 /// @param arg1 源操作数
-void ILocArm32::inst(std::string op, std::string rs, std::string arg1)
+/// @param arg2 源操作数
+/// @param arg3 源操作数
+void ILocArm32::inst(ArmOp op,
+                     const MachineOperand & rs,
+                     const MachineOperand & arg1,
+                     const MachineOperand & arg2,
+                     const MachineOperand & arg3)
 {
-    emit(op, rs, arg1);
+    emit(op, rs, arg1, arg2, arg3);
 }
 
-/// @brief 一个操作数指令
+/// @brief 条件执行的指令，如movlt r0,#1
 /// @param op 操作码
+/// @param cond 条件码
 /// @param rs 操作数
 /// @param arg1 源操作数
 /// @param arg2 源操作数
-void ILocArm32::inst(std::string op, std::string rs, std::string arg1, std::string arg2)
+void ILocArm32::inst_cond(ArmOp op,
+                          ArmCond cond,
+                          const MachineOperand & rs,
+                          const MachineOperand & arg1,
+                          const MachineOperand & arg2)
 {
-    emit(op, rs, arg1, arg2);
+    emit(op, rs, arg1, arg2)->cond = cond;
 }
 
 ///
@@ -247,7 +173,8 @@ void ILocArm32::inst(std::string op, std::string rs, std::string arg1, std::stri
 ///
 void ILocArm32::comment(std::string str)
 {
-    emit("@", str);
+    // 注释不会重复，不需要驻留
+    emit(ArmOp::COMMENT, MachineOperand::text(arena.copyString(str)));
 }
 
 /*
@@ -255,15 +182,26 @@ void ILocArm32::comment(std::string str)
 */
 void ILocArm32::load_imm(int rs_reg_no, int constant)
 {
+    // 可编码为立即数时一条mov或mvn即可
+    if (PlatformArm32::isImm(constant)) {
+        // mov r0,#100
+        emit(ArmOp::MOV, reg(rs_reg_no), imm(constant));
+        return;
+    }
+
+    if (PlatformArm32::isImm(~constant)) {
+        // mvn r0,#99 即 r0 = -100
+        emit(ArmOp::MVN, reg(rs_reg_no), imm(~constant));
+        return;
+    }
+
     // movw:把 16 位立即数放到寄存器的低16位，高16位清0
     // movt:把 16 位立即数放到寄存器的高16位，低 16位不影响
-    if (0 == ((constant >> 16) & 0xFFFF)) {
-        // 如果高16位本来就为0，直接movw
-        emit("movw", PlatformArm32::regName[rs_reg_no], "#:lower16:" + std::to_string(constant));
-    } else {
-        // 如果高16位不为0，先movw，然后movt
-        emit("movw", PlatformArm32::regName[rs_reg_no], "#:lower16:" + std::to_string(constant));
-        emit("movt", PlatformArm32::regName[rs_reg_no], "#:upper16:" + std::to_string(constant));
+    emit(ArmOp::MOVW, reg(rs_reg_no), MachineOperand::half(MachineOperand::Lower16, constant));
+
+    // 如果高16位不为0，再movt
+    if (0 != ((constant >> 16) & 0xFFFF)) {
+        emit(ArmOp::MOVT, reg(rs_reg_no), MachineOperand::half(MachineOperand::Upper16, constant));
     }
 }
 
@@ -274,8 +212,9 @@ void ILocArm32::load_symbol(int rs_reg_no, std::string name)
 {
     // movw r10, #:lower16:a
     // movt r10, #:upper16:a
-    emit("movw", PlatformArm32::regName[rs_reg_no], "#:lower16:" + name);
-    emit("movt", PlatformArm32::regName[rs_reg_no], "#:upper16:" + name);
+    const char * sym = symbol(name);
+    emit(ArmOp::MOVW, reg(rs_reg_no), MachineOperand::half(MachineOperand::Lower16, sym));
+    emit(ArmOp::MOVT, reg(rs_reg_no), MachineOperand::half(MachineOperand::Upper16, sym));
 }
 
 /// @brief 基址寻址 ldr r0,[fp,#100]
@@ -284,30 +223,18 @@ void ILocArm32::load_symbol(int rs_reg_no, std::string name)
 /// @param offset 偏移
 void ILocArm32::load_base(int rs_reg_no, int base_reg_no, int offset)
 {
-    std::string rsReg = PlatformArm32::regName[rs_reg_no];
-    std::string base = PlatformArm32::regName[base_reg_no];
-
     if (PlatformArm32::isDisp(offset)) {
         // 有效的偏移常量
-        if (offset) {
-            // [fp,#-16] [fp]
-            base += "," + toStr(offset);
-        }
+        // ldr r8,[fp,#-16] ldr r8,[fp]
+        emit(ArmOp::LDR, reg(rs_reg_no), MachineOperand::mem(base_reg_no, offset));
     } else {
 
         // ldr r8,=-4096
         load_imm(rs_reg_no, offset);
 
-        // fp,r8
-        base += "," + rsReg;
+        // ldr r8,[fp,r8]
+        emit(ArmOp::LDR, reg(rs_reg_no), MachineOperand::memIndex(base_reg_no, rs_reg_no));
     }
-
-    // 内存寻址
-    base = "[" + base + "]";
-
-    // ldr r8,[fp,#-16]
-    // ldr r8,[fp,r8]
-    emit("ldr", rsReg, base);
 }
 
 /// @brief 基址寻址 str r0,[fp,#100]
@@ -317,32 +244,19 @@ void ILocArm32::load_base(int rs_reg_no, int base_reg_no, int offset)
 /// @param tmp_reg_no 可能需要临时寄存器编号
 void ILocArm32::store_base(int src_reg_no, int base_reg_no, int disp, int tmp_reg_no)
 {
-    std::string base = PlatformArm32::regName[base_reg_no];
-
     if (PlatformArm32::isDisp(disp)) {
-        // 有效的偏移常量
-
-        // 若disp为0，则直接采用基址，否则采用基址+偏移
-        // [fp,#-16] [fp]
-        if (disp) {
-            base += "," + toStr(disp);
-        }
+        // 有效的偏移常量，若disp为0，则直接采用基址，否则采用基址+偏移
+        // str r8,[fp,#-16] str r8,[fp]
+        emit(ArmOp::STR, reg(src_reg_no), MachineOperand::mem(base_reg_no, disp));
     } else {
         // 先把立即数赋值给指定的寄存器tmpReg，然后采用基址+寄存器的方式进行
 
         // ldr r9,=-4096
         load_imm(tmp_reg_no, disp);
 
-        // fp,r9
-        base += "," + PlatformArm32::regName[tmp_reg_no];
+        // str r8,[fp,r9]
+        emit(ArmOp::STR, reg(src_reg_no), MachineOperand::memIndex(base_reg_no, tmp_reg_no));
     }
-
-    // 内存间接寻址
-    base = "[" + base + "]";
-
-    // str r8,[fp,#-16]
-    // str r8,[fp,r9]
-    emit("str", PlatformArm32::regName[src_reg_no], base);
 }
 
 /// @brief 寄存器Mov操作
@@ -350,7 +264,7 @@ void ILocArm32::store_base(int src_reg_no, int base_reg_no, int disp, int tmp_re
 /// @param src_reg_no 源寄存器
 void ILocArm32::mov_reg(int rs_reg_no, int src_reg_no)
 {
-    emit("mov", PlatformArm32::regName[rs_reg_no], PlatformArm32::regName[src_reg_no]);
+    emit(ArmOp::MOV, reg(rs_reg_no), reg(src_reg_no));
 }
 
 /// @brief 加载变量到寄存器，保证将变量放到reg中
@@ -373,7 +287,7 @@ void ILocArm32::load_var(int rs_reg_no, Value * src_var)
         if (src_regId != rs_reg_no) {
 
             // mov r8,r2 | 这里有优化空间——消除r8
-            emit("mov", PlatformArm32::regName[rs_reg_no], PlatformArm32::regName[src_regId]);
+            emit(ArmOp::MOV, reg(rs_reg_no), reg(src_regId));
         }
     } else if (Instanceof(globalVar, GlobalVariable *, src_var)) {
         // 全局变量
@@ -384,7 +298,7 @@ void ILocArm32::load_var(int rs_reg_no, Value * src_var)
         load_symbol(rs_reg_no, globalVar->getName());
 
         // ldr r8, [r8]
-        emit("ldr", PlatformArm32::regName[rs_reg_no], "[" + PlatformArm32::regName[rs_reg_no] + "]");
+        emit(ArmOp::LDR, reg(rs_reg_no), MachineOperand::mem(rs_reg_no));
 
     } else {
 
@@ -449,7 +363,7 @@ void ILocArm32::store_var(int src_reg_no, Value * dest_var, int tmp_reg_no)
         if (src_reg_no != dest_reg_id) {
 
             // mov r2,r8 | 这里有优化空间——消除r8
-            emit("mov", PlatformArm32::regName[dest_reg_id], PlatformArm32::regName[src_reg_no]);
+            emit(ArmOp::MOV, reg(dest_reg_id), reg(src_reg_no));
         }
 
     } else if (Instanceof(globalVar, GlobalVariable *, dest_var)) {
@@ -459,7 +373,7 @@ void ILocArm32::store_var(int src_reg_no, Value * dest_var, int tmp_reg_no)
         load_symbol(tmp_reg_no, globalVar->getName());
 
         // str r8, [r10]
-        emit("str", PlatformArm32::regName[src_reg_no], "[" + PlatformArm32::regName[tmp_reg_no] + "]");
+        emit(ArmOp::STR, reg(src_reg_no), MachineOperand::mem(tmp_reg_no));
 
     } else {
 
@@ -488,18 +402,15 @@ void ILocArm32::store_var(int src_reg_no, Value * dest_var, int tmp_reg_no)
 /// @param off 偏移
 void ILocArm32::leaStack(int rs_reg_no, int base_reg_no, int off)
 {
-    std::string rs_reg_name = PlatformArm32::regName[rs_reg_no];
-    std::string base_reg_name = PlatformArm32::regName[base_reg_no];
-
     if (PlatformArm32::constExpr(off))
         // add r8,fp,#-16
-        emit("add", rs_reg_name, base_reg_name, toStr(off));
+        emit(ArmOp::ADD, reg(rs_reg_no), reg(base_reg_no), imm(off));
     else {
         // ldr r8,=-257
         load_imm(rs_reg_no, off);
 
         // add r8,fp,r8
-        emit("add", rs_reg_name, base_reg_name, rs_reg_name);
+        emit(ArmOp::ADD, reg(rs_reg_no), reg(base_reg_no), reg(rs_reg_no));
     }
 }
 
@@ -511,23 +422,23 @@ void ILocArm32::allocStack(Function * func, int tmp_reg_no)
     // 计算栈帧大小
     int off = func->getMaxDep();
 
-    // 不需要在栈内额外分配空间，则什么都不做
+    // 保存SP寄存器到FP寄存器中，函数出口通过FP恢复SP，因此栈帧为空时也必须设置
+    mov_reg(ARM32_FP_REG_NO, ARM32_SP_REG_NO);
+
+    // 不需要在栈内额外分配空间，则不需要调整SP
     if (0 == off) {
         return;
     }
 
-    // 保存SP寄存器到FP寄存器中
-    mov_reg(ARM32_FP_REG_NO, ARM32_SP_REG_NO);
-
     if (PlatformArm32::constExpr(off)) {
         // sub sp,sp,#16
-        emit("sub", "sp", "sp", toStr(off));
+        emit(ArmOp::SUB, reg(ARM32_SP_REG_NO), reg(ARM32_SP_REG_NO), imm(off));
     } else {
         // ldr r8,=257
         load_imm(tmp_reg_no, off);
 
         // sub sp,sp,r8
-        emit("sub", "sp", "sp", PlatformArm32::regName[tmp_reg_no]);
+        emit(ArmOp::SUB, reg(ARM32_SP_REG_NO), reg(ARM32_SP_REG_NO), reg(tmp_reg_no));
     }
 }
 
@@ -536,14 +447,14 @@ void ILocArm32::allocStack(Function * func, int tmp_reg_no)
 void ILocArm32::call_fun(std::string name)
 {
     // 函数返回值在r0,不需要保护
-    emit("bl", name);
+    emit(ArmOp::BL, MachineOperand::label(symbol(name)));
 }
 
 /// @brief NOP操作
 void ILocArm32::nop()
 {
     // FIXME 无操作符，要确认是否用nop指令
-    emit("");
+    emit(ArmOp::NOP);
 }
 
 ///
@@ -552,5 +463,14 @@ void ILocArm32::nop()
 ///
 void ILocArm32::jump(std::string label)
 {
-    emit("b", label);
+    emit(ArmOp::B, MachineOperand::label(symbol(label)));
+}
+
+/// @brief 条件跳转指令
+/// @param cond 条件码，如lt
+/// @param label 目标Label名称
+void ILocArm32::branch(ArmCond cond, std::string label)
+{
+    // blt .L1
+    emit(ArmOp::B, MachineOperand::label(symbol(label)))->cond = cond;
 }
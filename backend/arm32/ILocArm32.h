@@ -15,84 +15,43 @@
 ///
 #pragma once
 
-#include <list>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "Arena.h"
+#include "MachineInstr.h"
 #include "Module.h"
 
 #define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
 
-/// @brief 底层汇编指令：ARM32
-struct ArmInst {
-
-    /// @brief 操作码
-    std::string opcode;
-
-    /// @brief 条件
-    std::string cond;
-
-    /// @brief 结果
-    std::string result;
-
-    /// @brief 源操作数1
-    std::string arg1;
-
-    /// @brief 源操作数2
-    std::string arg2;
-
-    /// @brief 附加信息
-    std::string addition;
-
-    /// @brief 标识指令是否无效
-    bool dead;
-
-    /// @brief 构造函数
-    /// @param op
-    /// @param rs
-    /// @param s1
-    /// @param s2
-    /// @param add
-    ArmInst(std::string op,
-            std::string rs = "",
-            std::string s1 = "",
-            std::string s2 = "",
-            std::string cond = "",
-            std::string extra = "");
-
-    /// @brief 指令更新
-    /// @param op
-    /// @param rs
-    /// @param s1
-    /// @param s2
-    /// @param add
-    void replace(std::string op,
-                 std::string rs = "",
-                 std::string s1 = "",
-                 std::string s2 = "",
-                 std::string cond = "",
-                 std::string extra = "");
-
-    /// @brief 设置死指令
-    void setDead();
-
-    /// @brief 指令字符串输出函数
-    /// @return
-    std::string outPut();
-};
-
 /// @brief 底层汇编序列-ARM32
 class ILocArm32 {
 
     /// @brief ARM汇编序列
-    std::list<ArmInst *> code;
+    std::vector<MachineInstr *> code;
+
+    /// @brief 函数内指令与字符串的区域，随指令序列一起释放
+    Arena arena;
+
+    /// @brief 驻留的Label、符号名称，同名的符号共享同一个字符串
+    std::unordered_map<std::string, const char *> symbols;
 
     /// @brief 符号表
     Module * module;
 
-    /// @brief 加载立即数 ldr r0,=#100
-    /// @param rs_reg_no 结果寄存器号
-    /// @param num 立即数
-    void load_imm(int rs_reg_no, int num);
+    /// @brief 在区域内创建指令并追加到序列末尾
+    /// @param op 操作码
+    /// @param op0 操作数
+    /// @param op1 操作数
+    /// @param op2 操作数
+    /// @param op3 操作数
+    /// @return 指令
+    MachineInstr * emit(ArmOp op,
+                        const MachineOperand & op0 = MachineOperand(),
+                        const MachineOperand & op1 = MachineOperand(),
+                        const MachineOperand & op2 = MachineOperand(),
+                        const MachineOperand & op3 = MachineOperand());
 
     /// @brief 加载符号值 ldr r0,=g; ldr r0,[r0]
     /// @param rsReg 结果寄存器号
@@ -119,15 +78,19 @@ public:
     ///
     void comment(std::string str);
 
-    /// @brief 数字变字符串，若flag为真，则变为立即数寻址（加#）
-    /// @param num 立即数
-    /// @param flag 是否家#
-    /// @return 字符串
-    std::string toStr(int num, bool flag = true);
+    /// @brief 驻留Label、函数名等符号，同名的符号返回同一个指针
+    /// @param name 符号名
+    /// @return 区域内的符号名
+    const char * symbol(const std::string & name);
 
     /// @brief 获取当前的代码序列
     /// @return 代码序列
-    std::list<ArmInst *> & getCode();
+    std::vector<MachineInstr *> & getCode();
+
+    /// @brief 加载立即数 ldr r0,=#100
+    /// @param rs_reg_no 结果寄存器号
+    /// @param num 立即数
+    void load_imm(int rs_reg_no, int num);
 
     /// @brief Load指令，基址寻址 ldr r0,[fp,#100]
     /// @param rs_reg_no 结果寄存器
@@ -146,23 +109,29 @@ public:
     /// @param name
     void label(std::string name);
 
-    /// @brief 一个操作数指令
-    /// @param op 操作码
-    /// @param rs 操作数
-    void inst(std::string op, std::string rs);
-
-    /// @brief 一个操作数指令
+    /// @brief 指令，操作数的种类为None时不输出
     /// @param op 操作码
     /// @param rs 操作数
     /// @param arg1 源操作数
-    void inst(std::string op, std::string rs, std::string arg1);
-
-    /// @brief 一个操作数指令
+    /// @param arg2 源操作数
+    /// @param arg3 源操作数
+    void inst(ArmOp op,
+              const MachineOperand & rs,
+              const MachineOperand & arg1 = MachineOperand(),
+              const MachineOperand & arg2 = MachineOperand(),
+              const MachineOperand & arg3 = MachineOperand());
+
+    /// @brief 条件执行的指令，如movlt r0,#1
     /// @param op 操作码
+    /// @param cond 条件码
     /// @param rs 操作数
     /// @param arg1 源操作数
     /// @param arg2 源操作数
-    void inst(std::string op, std::string rs, std::string arg1, std::string arg2);
+    void inst_cond(ArmOp op,
+                   ArmCond cond,
+                   const MachineOperand & rs,
+                   const MachineOperand & arg1 = MachineOperand(),
+                   const MachineOperand & arg2 = MachineOperand());
 
     /// @brief 加载变量到寄存器
     /// @param rs_reg_no 结果寄存器
@@ -207,10 +176,17 @@ public:
     ///
     void jump(std::string label);
 
+    ///
+    /// @brief 条件跳转指令
+    /// @param cond 条件码，如lt
+    /// @param label 目标Label名称
+    ///
+    void branch(ArmCond cond, std::string label);
+
     /// @brief 输出汇编
-    /// @param file 输出的文件指针
+    /// @param writer 汇编输出
     /// @param outputEmpty 是否输出空语句
-    void outPut(FILE * file, bool outputEmpty = false);
+    void outPut(AsmWriter & writer, bool outputEmpty = false);
 
     /// @brief 删除无用的Label指令
     void deleteUnusedLabel();
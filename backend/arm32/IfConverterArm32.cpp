@@ -0,0 +1,249 @@
+///
+/// @file IfConverterArm32.cpp
+/// @brief ARM32的if转换，小的分支结构改为条件执行的指令
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，小的if/else结构改为条件执行的指令
+/// </table>
+///
+#include "IfConverterArm32.h"
+
+///
+/// @brief 构造函数
+/// @param _iloc 汇编指令序列
+/// @param _maxInsts 每个分支允许条件执行的最大指令数，超过时保留跳转更划算
+///
+IfConverterArm32::IfConverterArm32(ILocArm32 & _iloc, int32_t _maxInsts) : code(_iloc.getCode()), maxInsts(_maxInsts)
+{}
+
+///
+/// @brief 执行if转换
+///
+void IfConverterArm32::run()
+{
+    countLabelUses();
+
+    for (auto pIter = code.begin(); pIter != code.end(); ++pIter) {
+
+        MachineInstr * inst = *pIter;
+        if (!inst->dead && inst->isBranch() && (inst->cond != ArmCond::AL)) {
+            convert(pIter);
+        }
+    }
+}
+
+///
+/// @brief 统计每个Label被跳转指令引用的次数
+///
+void IfConverterArm32::countLabelUses()
+{
+    labelUses.clear();
+
+    for (auto inst: code) {
+        if (!inst->dead && inst->isBranch()) {
+            labelUses[inst->operands[0].sym]++;
+        }
+    }
+}
+
+///
+/// @brief 检查是否是可以条件执行且不改变条件标志的指令
+/// @param inst 指令
+/// @return true 是 false 不是
+///
+bool IfConverterArm32::isPredicable(MachineInstr * inst)
+{
+    if (inst->cond != ArmCond::AL) {
+        return false;
+    }
+
+    // 跳转、函数调用、比较、栈操作等都不能条件执行
+    switch (inst->opcode) {
+        case ArmOp::MOV:
+        case ArmOp::MVN:
+        case ArmOp::MOVW:
+        case ArmOp::MOVT:
+        case ArmOp::ADD:
+        case ArmOp::SUB:
+        case ArmOp::RSB:
+        case ArmOp::MUL:
+        case ArmOp::MLA:
+        case ArmOp::MLS:
+        case ArmOp::SDIV:
+        case ArmOp::SMMUL:
+        case ArmOp::AND:
+        case ArmOp::ORR:
+        case ArmOp::EOR:
+        case ArmOp::BIC:
+        case ArmOp::LSL:
+        case ArmOp::LSR:
+        case ArmOp::ASR:
+        case ArmOp::LDR:
+        case ArmOp::STR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+///
+/// @brief 跳过注释与无效指令
+/// @param pos 开始位置，返回时为第一条有效指令的位置
+///
+void IfConverterArm32::skipNoise(std::vector<MachineInstr *>::iterator & pos)
+{
+    while ((pos != code.end()) && ((*pos)->dead || ((*pos)->opcode == ArmOp::COMMENT))) {
+        ++pos;
+    }
+}
+
+///
+/// @brief 从pos开始收集可条件执行的指令，跳过注释、无效指令与无引用的Label
+/// @param pos 开始位置，返回时为第一条不能条件执行的指令的位置
+/// @param insts 收集的指令
+/// @return true 指令数没有超过上限 false 超过上限
+///
+bool IfConverterArm32::collectBlock(std::vector<MachineInstr *>::iterator & pos, std::vector<MachineInstr *> & insts)
+{
+    for (skipNoise(pos); pos != code.end(); ++pos, skipNoise(pos)) {
+
+        MachineInstr * inst = *pos;
+
+        // 有跳转引用的Label是其它路径的入口，不能跨越
+        if (inst->isLabel()) {
+            if (labelUses[inst->operands[0].sym] != 0) {
+                break;
+            }
+            continue;
+        }
+
+        if (!isPredicable(inst)) {
+            break;
+        }
+
+        insts.push_back(inst);
+        if ((int32_t) insts.size() > maxInsts) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 对一条条件跳转开始的结构尝试if转换
+/// @param branchIter 条件跳转指令的位置
+/// @return true 已转换 false 不满足条件
+///
+bool IfConverterArm32::convert(std::vector<MachineInstr *>::iterator branchIter)
+{
+    MachineInstr * branch = *branchIter;
+
+    ArmCond cond = branch->cond;
+    ArmCond invCond = invertCond(cond);
+
+    const char * elseLabel = branch->operands[0].sym;
+
+    // then部分：条件跳转不成立时顺序执行的指令
+    std::vector<MachineInstr *> thenInsts;
+    auto pos = std::next(branchIter);
+    if (!collectBlock(pos, thenInsts) || (pos == code.end())) {
+        return false;
+    }
+
+    // 三角形结构，then后面紧跟跳转目标
+    if ((*pos)->isLabel() && ((*pos)->operands[0].sym == elseLabel)) {
+
+        for (auto inst: thenInsts) {
+            inst->cond = invCond;
+        }
+
+        branch->setDead();
+        labelUses[elseLabel]--;
+
+        return true;
+    }
+
+    // 菱形结构，then以跳转到结束Label的无条件跳转结束，后面紧跟else Label
+    MachineInstr * thenJump = *pos;
+    if (!thenJump->isBranch() || (thenJump->cond != ArmCond::AL)) {
+        return false;
+    }
+    const char * endLabel = thenJump->operands[0].sym;
+
+    ++pos;
+    skipNoise(pos);
+    if ((pos == code.end()) || !(*pos)->isLabel() || ((*pos)->operands[0].sym != elseLabel)) {
+        return false;
+    }
+    MachineInstr * elseLabelInst = *pos;
+
+    // 没有else部分时then跳转到紧随的跳转目标，仍是三角形结构
+    if (endLabel == elseLabel) {
+
+        for (auto inst: thenInsts) {
+            inst->cond = invCond;
+        }
+
+        branch->setDead();
+        thenJump->setDead();
+        labelUses[elseLabel] -= 2;
+
+        return true;
+    }
+
+    // else Label只有本条件跳转引用，else部分才只能从这里进入
+    if (labelUses[elseLabel] != 1) {
+        return false;
+    }
+
+    std::vector<MachineInstr *> elseInsts;
+    ++pos;
+    if (!collectBlock(pos, elseInsts) || (pos == code.end())) {
+        return false;
+    }
+
+    // else以结束Label或跳转到结束Label的无条件跳转结束
+    MachineInstr * elseJump = nullptr;
+    if ((*pos)->isBranch()) {
+        if (((*pos)->cond != ArmCond::AL) || ((*pos)->operands[0].sym != endLabel)) {
+            return false;
+        }
+        elseJump = *pos;
+    } else if (!(*pos)->isLabel() || ((*pos)->operands[0].sym != endLabel)) {
+        return false;
+    }
+
+    for (auto inst: thenInsts) {
+        inst->cond = invCond;
+    }
+    for (auto inst: elseInsts) {
+        inst->cond = cond;
+    }
+
+    branch->setDead();
+    labelUses[elseLabel]--;
+    elseLabelInst->setDead();
+
+    thenJump->setDead();
+    labelUses[endLabel]--;
+
+    // else后的跳转目标紧随其后时也可删除，否则两条路径都经过该跳转
+    if (elseJump) {
+        ++pos;
+        skipNoise(pos);
+        if ((pos != code.end()) && (*pos)->isLabel() && ((*pos)->operands[0].sym == endLabel)) {
+            elseJump->setDead();
+            labelUses[endLabel]--;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,96 @@
+///
+/// @file IfConverterArm32.h
+/// @brief ARM32的if转换，小的分支结构改为条件执行的指令
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，小的if/else结构改为条件执行的指令
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "ILocArm32.h"
+
+///
+/// @brief ARM32的if转换
+///
+/// 在指令选择后的汇编序列上识别条件跳转开始的两种结构：
+/// 三角形：b<c> L; then; L:          then改为在条件c不成立时执行
+/// 菱形：  b<c> L1; then; b L2; L1: else; [b L2;] L2:  then在c不成立时执行，else在c成立时执行
+/// 要求then与else中都是可条件执行且不改变条件标志的指令，且指令数不超过上限，转换后删除跳转指令。
+///
+class IfConverterArm32 {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _iloc 汇编指令序列
+    /// @param _maxInsts 每个分支允许条件执行的最大指令数，超过时保留跳转更划算
+    ///
+    IfConverterArm32(ILocArm32 & _iloc, int32_t _maxInsts = 4);
+
+    ///
+    /// @brief 执行if转换
+    ///
+    void run();
+
+protected:
+    ///
+    /// @brief 统计每个Label被跳转指令引用的次数
+    ///
+    void countLabelUses();
+
+    ///
+    /// @brief 对一条条件跳转开始的结构尝试if转换
+    /// @param branchIter 条件跳转指令的位置
+    /// @return true 已转换 false 不满足条件
+    ///
+    bool convert(std::vector<MachineInstr *>::iterator branchIter);
+
+    ///
+    /// @brief 从pos开始收集可条件执行的指令，跳过注释、无效指令与无引用的Label
+    /// @param pos 开始位置，返回时为第一条不能条件执行的指令的位置
+    /// @param insts 收集的指令
+    /// @return true 指令数没有超过上限 false 超过上限
+    ///
+    bool collectBlock(std::vector<MachineInstr *>::iterator & pos, std::vector<MachineInstr *> & insts);
+
+    ///
+    /// @brief 跳过注释与无效指令
+    /// @param pos 开始位置，返回时为第一条有效指令的位置
+    ///
+    void skipNoise(std::vector<MachineInstr *>::iterator & pos);
+
+    ///
+    /// @brief 检查是否是可以条件执行且不改变条件标志的指令
+    /// @param inst 指令
+    /// @return true 是 false 不是
+    ///
+    static bool isPredicable(MachineInstr * inst);
+
+private:
+    ///
+    /// @brief 汇编指令序列
+    ///
+    std::vector<MachineInstr *> & code;
+
+    ///
+    /// @brief 每个分支允许条件执行的最大指令数
+    ///
+    int32_t maxInsts;
+
+    ///
+    /// @brief Label被跳转指令引用的次数，Label名称是驻留的字符串
+    ///
+    std::unordered_map<const char *, int32_t> labelUses;
+};
@@ -13,6 +13,7 @@
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// </table>
 ///
+#include <algorithm>
 #include <cstdio>
 
 #include "Common.h"
@@ -26,14 +27,28 @@
 
 #include "LabelInstruction.h"
 #include "GotoInstruction.h"
+#include "BranchInstruction.h"
 #include "FuncCallInstruction.h"
 #include "MoveInstruction.h"
+#include "ConstInt.h"
+
+/// @brief 寄存器操作数
+static inline MachineOperand reg(int32_t regNo)
+{
+    return MachineOperand::reg(regNo);
+}
+
+/// @brief 立即数操作数
+static inline MachineOperand imm(int32_t num)
+{
+    return MachineOperand::immediate(num);
+}
 
 /// @brief 构造函数
 /// @param _irCode 指令
 /// @param _iloc ILoc
 /// @param _func 函数
-InstSelectorArm32::InstSelectorArm32(vector<Instruction *> & _irCode,
+InstSelectorArm32::InstSelectorArm32(InterCode & _irCode,
                                      ILocArm32 & _iloc,
                                      Function * _func,
                                      SimpleRegisterAllocator & allocator)
@@ -44,6 +59,9 @@ InstSelectorArm32::InstSelectorArm32(vector<Instruction *> & _irCode,
 
     translator_handlers[IRInstOperator::IRINST_OP_LABEL] = &InstSelectorArm32::translate_label;
     translator_handlers[IRInstOperator::IRINST_OP_GOTO] = &InstSelectorArm32::translate_goto;
+    translator_handlers[IRInstOperator::IRINST_OP_BC] = &InstSelectorArm32::translate_branch;
+    translator_handlers[IRInstOperator::IRINST_OP_BT] = &InstSelectorArm32::translate_branch;
+    translator_handlers[IRInstOperator::IRINST_OP_BF] = &InstSelectorArm32::translate_branch;
 
     translator_handlers[IRInstOperator::IRINST_OP_ASSIGN] = &InstSelectorArm32::translate_assign;
 
@@ -54,6 +72,13 @@ InstSelectorArm32::InstSelectorArm32(vector<Instruction *> & _irCode,
     translator_handlers[IRInstOperator::IRINST_OP_MOD_I] = &InstSelectorArm32::translate_mod_int32;
     translator_handlers[IRInstOperator::IRINST_OP_NEG_I] = &InstSelectorArm32::translate_neg_int32;
 
+    translator_handlers[IRInstOperator::IRINST_OP_EQ_I] = &InstSelectorArm32::translate_relop;
+    translator_handlers[IRInstOperator::IRINST_OP_NE_I] = &InstSelectorArm32::translate_relop;
+    translator_handlers[IRInstOperator::IRINST_OP_LT_I] = &InstSelectorArm32::translate_relop;
+    translator_handlers[IRInstOperator::IRINST_OP_LE_I] = &InstSelectorArm32::translate_relop;
+    translator_handlers[IRInstOperator::IRINST_OP_GT_I] = &InstSelectorArm32::translate_relop;
+    translator_handlers[IRInstOperator::IRINST_OP_GE_I] = &InstSelectorArm32::translate_relop;
+
     translator_handlers[IRInstOperator::IRINST_OP_FUNC_CALL] = &InstSelectorArm32::translate_call;
     translator_handlers[IRInstOperator::IRINST_OP_ARG] = &InstSelectorArm32::translate_arg;
 }
@@ -67,13 +92,50 @@ InstSelectorArm32::~InstSelectorArm32()
 /// @brief 指令选择执行
 void InstSelectorArm32::run()
 {
+    // 寄存器传值的形参在最后一次使用之前，其所在的r0-r3不能作为临时寄存器
+    Instruction * lastParamUse = nullptr;
     for (auto inst: ir) {
+        for (auto operand: inst->getOperandsValue()) {
+            if (dynamic_cast<FormalParam *>(operand) && (operand->getRegId() != -1)) {
+                lastParamUse = inst;
+            }
+        }
+    }
+
+    auto & params = func->getParams();
+    int32_t paramRegNum = lastParamUse ? std::min((int32_t) params.size(), 4) : 0;
+    for (int32_t k = 0; k < paramRegNum; ++k) {
+        simpleRegisterAllocator.reserve(k);
+    }
+
+    for (auto inst: ir) {
+
+        curInst = inst;
 
         // 逐个指令进行翻译
         if (!inst->isDead()) {
             translate(inst);
         }
+
+        if (inst == lastParamUse) {
+            for (int32_t k = 0; k < paramRegNum; ++k) {
+                simpleRegisterAllocator.unreserve(k);
+            }
+        }
+    }
+}
+
+/// @brief 获取当前翻译指令之后第一条有效的IR指令
+/// @return Instruction* 指令，没有时为nullptr
+Instruction * InstSelectorArm32::nextInst()
+{
+    for (Instruction * inst = curInst->getNext(); inst; inst = inst->getNext()) {
+        if (!inst->isDead()) {
+            return inst;
+        }
     }
+
+    return nullptr;
 }
 
 /// @brief 指令翻译成ARM32汇编
@@ -137,26 +199,230 @@ void InstSelectorArm32::translate_goto(Instruction * inst)
     iloc.jump(gotoInst->getTarget()->getName());
 }
 
+/// @brief 比较运算对应的条件码
+/// @param op 比较运算
+/// @return 条件码
+static ArmCond condCode(IRInstOperator op)
+{
+    switch (op) {
+        case IRInstOperator::IRINST_OP_EQ_I:
+            return ArmCond::EQ;
+        case IRInstOperator::IRINST_OP_NE_I:
+            return ArmCond::NE;
+        case IRInstOperator::IRINST_OP_LT_I:
+            return ArmCond::LT;
+        case IRInstOperator::IRINST_OP_LE_I:
+            return ArmCond::LE;
+        case IRInstOperator::IRINST_OP_GT_I:
+            return ArmCond::GT;
+        default:
+            return ArmCond::GE;
+    }
+}
+
+/// @brief 比较的两个操作数交换后的条件码
+/// @param cond 条件码
+/// @return 交换操作数后的条件码
+static ArmCond swapCondCode(ArmCond cond)
+{
+    switch (cond) {
+        case ArmCond::LT:
+            return ArmCond::GT;
+        case ArmCond::GT:
+            return ArmCond::LT;
+        case ArmCond::LE:
+            return ArmCond::GE;
+        case ArmCond::GE:
+            return ArmCond::LE;
+        default:
+            return cond;
+    }
+}
+
+/// @brief 比较指令是否只被紧随其后的条件跳转使用，中间只允许不影响条件标志的赋值指令
+/// @param inst 比较指令
+/// @return true 可以融合 false 不能融合
+bool InstSelectorArm32::isFusedCompare(Instruction * inst)
+{
+    if (!inst->hasOneUse()) {
+        return false;
+    }
+
+    Instanceof(branchInst, BranchInstruction *, inst->getUses().front()->getUser());
+    if (!branchInst) {
+        return false;
+    }
+
+    // 出SSA时插入的复制只产生mov、ldr、str等指令，不改变条件标志
+    for (Instruction * next = curInst->getNext(); next; next = next->getNext()) {
+        if (next == branchInst) {
+            return true;
+        }
+        if (!next->isDead() && (next->getOp() != IRInstOperator::IRINST_OP_ASSIGN)) {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+/// @brief 比较指令的两个操作数翻译成cmp或cmn指令
+/// @param inst 比较指令
+/// @return 比较结果为真时的条件码
+ArmCond InstSelectorArm32::translate_cmp(Instruction * inst)
+{
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+    ArmCond cond = condCode(inst->getOp());
+
+    // 常量只能作为第二个操作数立即数寻址
+    if (dynamic_cast<ConstInt *>(arg1) && !dynamic_cast<ConstInt *>(arg2)) {
+        std::swap(arg1, arg2);
+        cond = swapCondCode(cond);
+    }
+
+    int32_t arg1_reg_no = arg1->getRegId();
+    int32_t load_arg1_reg_no;
+    if (arg1_reg_no == -1) {
+        load_arg1_reg_no = simpleRegisterAllocator.Allocate(arg1);
+        iloc.load_var(load_arg1_reg_no, arg1);
+    } else {
+        load_arg1_reg_no = arg1_reg_no;
+    }
+
+    ArmOp operator_name = ArmOp::CMP;
+    MachineOperand arg2_operand;
+    Instanceof(constArg2, ConstInt *, arg2);
+    if (constArg2 && selectImmOperand(operator_name, constArg2->getVal(), arg2_operand)) {
+        arg2 = nullptr;
+    } else if (arg2->getRegId() == -1) {
+        int32_t load_arg2_reg_no = simpleRegisterAllocator.Allocate(arg2);
+        iloc.load_var(load_arg2_reg_no, arg2);
+        arg2_operand = reg(load_arg2_reg_no);
+    } else {
+        arg2_operand = reg(arg2->getRegId());
+    }
+
+    // cmp r8,r9 或 cmp r8,#imm
+    iloc.inst(operator_name, reg(load_arg1_reg_no), arg2_operand);
+
+    simpleRegisterAllocator.free(arg1);
+    if (arg2) {
+        simpleRegisterAllocator.free(arg2);
+    }
+
+    return cond;
+}
+
+/// @brief 比较指令翻译成ARM32汇编
+/// @param inst IR指令
+/// @details 只被紧随的条件跳转使用时只产生cmp，由条件跳转指令直接根据条件标志跳转，否则产生0或1
+void InstSelectorArm32::translate_relop(Instruction * inst)
+{
+    ArmCond cond = translate_cmp(inst);
+
+    if (isFusedCompare(inst)) {
+        fusedCompare = inst;
+        fusedCond = cond;
+        return;
+    }
+
+    Value * result = inst;
+    int32_t result_reg_no = inst->getRegId();
+    int32_t load_result_reg_no;
+    if (result_reg_no == -1) {
+        load_result_reg_no = simpleRegisterAllocator.Allocate(result);
+    } else {
+        load_result_reg_no = result_reg_no;
+    }
+
+    // mov不改变条件标志，mov r8,#0; movlt r8,#1
+    iloc.inst(ArmOp::MOV, reg(load_result_reg_no), imm(0));
+    iloc.inst_cond(ArmOp::MOV, cond, reg(load_result_reg_no), imm(1));
+
+    if (result_reg_no == -1) {
+        iloc.store_var(load_result_reg_no, result, ARM32_TMP_REG_NO);
+    }
+
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 条件跳转指令（bc、bt、bf）翻译成ARM32汇编
+/// @param inst IR指令
+void InstSelectorArm32::translate_branch(Instruction * inst)
+{
+    Instanceof(branchInst, BranchInstruction *, inst);
+
+    IRInstOperator op = inst->getOp();
+    Value * condVar = branchInst->getCondVar();
+
+    // 常量条件直接无条件跳转
+    Instanceof(constCond, ConstInt *, condVar);
+    if (constCond) {
+        bool isTrue = constCond->getVal() != 0;
+        if (op == IRInstOperator::IRINST_OP_BC) {
+            iloc.jump((isTrue ? branchInst->getTrueTarget() : branchInst->getFalseTarget())->getName());
+        } else if (isTrue == (op == IRInstOperator::IRINST_OP_BT)) {
+            iloc.jump(branchInst->getTarget()->getName());
+        }
+        return;
+    }
+
+    // 条件为真时的条件码，条件来自紧邻的比较时直接使用其条件标志，否则与0比较
+    ArmCond cond;
+    if (condVar == fusedCompare) {
+        cond = fusedCond;
+    } else {
+        int32_t cond_reg_no = condVar->getRegId();
+        int32_t load_cond_reg_no;
+        if (cond_reg_no == -1) {
+            load_cond_reg_no = simpleRegisterAllocator.Allocate(condVar);
+            iloc.load_var(load_cond_reg_no, condVar);
+        } else {
+            load_cond_reg_no = cond_reg_no;
+        }
+
+        iloc.inst(ArmOp::CMP, reg(load_cond_reg_no), imm(0));
+        simpleRegisterAllocator.free(condVar);
+
+        cond = ArmCond::NE;
+    }
+    fusedCompare = nullptr;
+
+    if (op == IRInstOperator::IRINST_OP_BT) {
+        iloc.branch(cond, branchInst->getTarget()->getName());
+    } else if (op == IRInstOperator::IRINST_OP_BF) {
+        iloc.branch(invertCond(cond), branchInst->getTarget()->getName());
+    } else {
+
+        // 紧随的Label是某个目标时该分支顺序执行，省去一条跳转
+        Instruction * trueTarget = branchInst->getTrueTarget();
+        Instruction * falseTarget = branchInst->getFalseTarget();
+        Instruction * next = nextInst();
+
+        if (next == falseTarget) {
+            iloc.branch(cond, trueTarget->getName());
+        } else if (next == trueTarget) {
+            iloc.branch(invertCond(cond), falseTarget->getName());
+        } else {
+            iloc.branch(cond, trueTarget->getName());
+            iloc.jump(falseTarget->getName());
+        }
+    }
+}
+
 /// @brief 函数入口指令翻译成ARM32汇编
 /// @param inst IR指令
 void InstSelectorArm32::translate_entry(Instruction * inst)
 {
     // 查看保护的寄存器
-    auto & protectedRegNo = func->getProtectedReg();
-    auto & protectedRegStr = func->getProtectedRegStr();
-
-    bool first = true;
-    for (auto regno: protectedRegNo) {
-        if (first) {
-            protectedRegStr = PlatformArm32::regName[regno];
-            first = false;
-        } else {
-            protectedRegStr += "," + PlatformArm32::regName[regno];
-        }
+    uint32_t protectedRegMask = 0;
+    for (auto regno: func->getProtectedReg()) {
+        protectedRegMask |= 1u << regno;
     }
 
-    if (!protectedRegStr.empty()) {
-        iloc.inst("push", "{" + protectedRegStr + "}");
+    if (protectedRegMask != 0) {
+        iloc.inst(ArmOp::PUSH, MachineOperand::regList(protectedRegMask));
     }
 
     // 为fun分配栈帧，含局部变量、函数调用值传递的空间等
@@ -176,15 +442,19 @@ void InstSelectorArm32::translate_exit(Instruction * inst)
     }
 
     // 恢复栈空间
-    iloc.inst("mov", "sp", "fp");
+    iloc.inst(ArmOp::MOV, reg(ARM32_SP_REG_NO), reg(ARM32_FP_REG_NO));
 
     // 保护寄存器的恢复
-    auto & protectedRegStr = func->getProtectedRegStr();
-    if (!protectedRegStr.empty()) {
-        iloc.inst("pop", "{" + protectedRegStr + "}");
+    uint32_t protectedRegMask = 0;
+    for (auto regno: func->getProtectedReg()) {
+        protectedRegMask |= 1u << regno;
+    }
+
+    if (protectedRegMask != 0) {
+        iloc.inst(ArmOp::POP, MachineOperand::regList(protectedRegMask));
     }
 
-    iloc.inst("bx", "lr");
+    iloc.inst(ArmOp::BX, reg(ARM32_LX_REG_NO));
 }
 
 /// @brief 赋值指令翻译成ARM32汇编
@@ -222,18 +492,98 @@ void InstSelectorArm32::translate_assign(Instruction * inst)
     }
 }
 
+/// @brief 常量能否作为指令的立即数，不能直接编码时尝试改用对偶指令
+/// @param operator_name 操作码，改用对偶指令时被替换，如add与sub、cmp与cmn互换
+/// @param constVal 常量
+/// @param immOperand 立即数寻址的操作数
+/// @return true 可以立即数寻址 false 只能加载到寄存器
+bool InstSelectorArm32::selectImmOperand(ArmOp & operator_name, int32_t constVal, MachineOperand & immOperand)
+{
+    // 对偶指令的立即数取负或者取反，没有对偶指令时与自身相同
+    ArmOp dual;
+    int32_t dualVal;
+
+    switch (operator_name) {
+        case ArmOp::ADD:
+            dual = ArmOp::SUB;
+            dualVal = (int32_t) (0u - (uint32_t) constVal);
+            break;
+        case ArmOp::SUB:
+            dual = ArmOp::ADD;
+            dualVal = (int32_t) (0u - (uint32_t) constVal);
+            break;
+        case ArmOp::CMP:
+            dual = ArmOp::CMN;
+            dualVal = (int32_t) (0u - (uint32_t) constVal);
+            break;
+        case ArmOp::CMN:
+            dual = ArmOp::CMP;
+            dualVal = (int32_t) (0u - (uint32_t) constVal);
+            break;
+        case ArmOp::AND:
+            dual = ArmOp::BIC;
+            dualVal = ~constVal;
+            break;
+        case ArmOp::BIC:
+            dual = ArmOp::AND;
+            dualVal = ~constVal;
+            break;
+        case ArmOp::MOV:
+            dual = ArmOp::MVN;
+            dualVal = ~constVal;
+            break;
+        case ArmOp::MVN:
+            dual = ArmOp::MOV;
+            dualVal = ~constVal;
+            break;
+        case ArmOp::RSB:
+        case ArmOp::ORR:
+        case ArmOp::EOR:
+            dual = operator_name;
+            dualVal = constVal;
+            break;
+        default:
+            // mul、sdiv等没有立即数寻址
+            return false;
+    }
+
+    if (PlatformArm32::isImm(constVal)) {
+        immOperand = imm(constVal);
+        return true;
+    }
+
+    if ((dual != operator_name) && PlatformArm32::isImm(dualVal)) {
+        operator_name = dual;
+        immOperand = imm(dualVal);
+        return true;
+    }
+
+    return false;
+}
+
 /// @brief 二元操作指令翻译成ARM32汇编
 /// @param inst IR指令
 /// @param operator_name 操作码
 /// @param rs_reg_no 结果寄存器号
 /// @param op1_reg_no 源操作数1寄存器号
 /// @param op2_reg_no 源操作数2寄存器号
-void InstSelectorArm32::translate_two_operator(Instruction * inst, string operator_name)
+void InstSelectorArm32::translate_two_operator(Instruction * inst, ArmOp operator_name)
 {
     Value * result = inst;
     Value * arg1 = inst->getOperand(0);
     Value * arg2 = inst->getOperand(1);
 
+    // 常量只能作为第二个源操作数立即数寻址，可交换的运算交换源操作数，减法改为反向减法
+    if (dynamic_cast<ConstInt *>(arg1) && !dynamic_cast<ConstInt *>(arg2)) {
+        if ((operator_name == ArmOp::ADD) || (operator_name == ArmOp::AND) || (operator_name == ArmOp::ORR) ||
+            (operator_name == ArmOp::EOR)) {
+            std::swap(arg1, arg2);
+        } else if (operator_name == ArmOp::SUB) {
+            operator_name = ArmOp::RSB;
+            std::swap(arg1, arg2);
+        }
+    }
+
     int32_t arg1_reg_no = arg1->getRegId();
     int32_t arg2_reg_no = arg2->getRegId();
     int32_t result_reg_no = inst->getRegId();
@@ -251,16 +601,23 @@ void InstSelectorArm32::translate_two_operator(Instruction * inst, string operat
         load_arg1_reg_no = arg1_reg_no;
     }
 
-    // 看arg2是否是寄存器，若是则寄存器寻址，否则要load变量到寄存器中
-    if (arg2_reg_no == -1) {
+    // 看arg2是否是可编码的常量，若是则立即数寻址
+    MachineOperand arg2_operand;
+    Instanceof(constArg2, ConstInt *, arg2);
+    if (constArg2 && selectImmOperand(operator_name, constArg2->getVal(), arg2_operand)) {
+        arg2 = nullptr;
+    } else if (arg2_reg_no == -1) {
 
+        // 看arg2是否是寄存器，若是则寄存器寻址，否则要load变量到寄存器中
         // 分配一个寄存器r9
         load_arg2_reg_no = simpleRegisterAllocator.Allocate(arg2);
 
         // arg2 -> r9
         iloc.load_var(load_arg2_reg_no, arg2);
+        arg2_operand = reg(load_arg2_reg_no);
     } else {
         load_arg2_reg_no = arg2_reg_no;
+        arg2_operand = reg(load_arg2_reg_no);
     }
 
     // 看结果变量是否是寄存器，若不是则需要分配一个新的寄存器来保存运算的结果
@@ -271,11 +628,8 @@ void InstSelectorArm32::translate_two_operator(Instruction * inst, string operat
         load_result_reg_no = result_reg_no;
     }
 
-    // r8 + r9 -> r10
-    iloc.inst(operator_name,
-              PlatformArm32::regName[load_result_reg_no],
-              PlatformArm32::regName[load_arg1_reg_no],
-              PlatformArm32::regName[load_arg2_reg_no]);
+    // r8 + r9 -> r10 或 r8 + #imm -> r10
+    iloc.inst(operator_name, reg(load_result_reg_no), reg(load_arg1_reg_no), arg2_operand);
 
     // 结果不是寄存器，则需要把rs_reg_name保存到结果变量中
     if (result_reg_no == -1) {
@@ -288,7 +642,9 @@ void InstSelectorArm32::translate_two_operator(Instruction * inst, string operat
 
     // 释放寄存器
     simpleRegisterAllocator.free(arg1);
-    simpleRegisterAllocator.free(arg2);
+    if (arg2) {
+        simpleRegisterAllocator.free(arg2);
+    }
     simpleRegisterAllocator.free(result);
 }
 
@@ -296,28 +652,48 @@ void InstSelectorArm32::translate_two_operator(Instruction * inst, string operat
 /// @param inst IR指令
 void InstSelectorArm32::translate_add_int32(Instruction * inst)
 {
-    translate_two_operator(inst, "add");
+    translate_two_operator(inst, ArmOp::ADD);
 }
 
 /// @brief 整数减法指令翻译成ARM32汇编
 /// @param inst IR指令
 void InstSelectorArm32::translate_sub_int32(Instruction * inst)
 {
-    translate_two_operator(inst, "sub");
+    translate_two_operator(inst, ArmOp::SUB);
 }
 
 /// @brief 整数乘法指令翻译成ARM32汇编
 /// @param inst IR指令
 void InstSelectorArm32::translate_mul_int32(Instruction * inst)
 {
-    translate_two_operator(inst, "mul");
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    // 乘法可交换，常量在任何一侧都可以
+    Instanceof(const1, ConstInt *, arg1);
+    Instanceof(const2, ConstInt *, arg2);
+
+    if (const2 && isMulByShift(const2->getVal())) {
+        translate_const_operator(inst, arg1, const2->getVal(), &InstSelectorArm32::emit_mul_const);
+    } else if (const1 && isMulByShift(const1->getVal())) {
+        translate_const_operator(inst, arg2, const1->getVal(), &InstSelectorArm32::emit_mul_const);
+    } else {
+        translate_two_operator(inst, ArmOp::MUL);
+    }
 }
 
 /// @brief 整数除法指令翻译成ARM32汇编
 /// @param inst IR指令
 void InstSelectorArm32::translate_div_int32(Instruction * inst)
 {
-    translate_two_operator(inst, "sdiv");
+    // 除数为常量时避免使用耗时几十个周期的sdiv，除数为0时保持sdiv的行为
+    Instanceof(divisor, ConstInt *, inst->getOperand(1));
+    if (divisor && (divisor->getVal() != 0)) {
+        translate_const_operator(inst, inst->getOperand(0), divisor->getVal(), &InstSelectorArm32::emit_div_const);
+        return;
+    }
+
+    translate_two_operator(inst, ArmOp::SDIV);
 }
 
 /// @brief 整数求余指令翻译成ARM32汇编
@@ -325,6 +701,12 @@ void InstSelectorArm32::translate_div_int32(Instruction * inst)
 /// @details ARM32没有直接的求余指令，因此需要使用除法和乘法来实现
 void InstSelectorArm32::translate_mod_int32(Instruction * inst)
 {
+    Instanceof(divisor, ConstInt *, inst->getOperand(1));
+    if (divisor && (divisor->getVal() != 0)) {
+        translate_const_operator(inst, inst->getOperand(0), divisor->getVal(), &InstSelectorArm32::emit_mod_const);
+        return;
+    }
+
     Value * result = inst;
     Value * arg1 = inst->getOperand(0);
     Value * arg2 = inst->getOperand(1);
@@ -355,29 +737,16 @@ void InstSelectorArm32::translate_mod_int32(Instruction * inst)
         load_result_reg_no = result_reg_no;
     }
 
-    // r8 / r9 -> r10
-    iloc.inst("sdiv",
-              PlatformArm32::regName[load_result_reg_no],
-              PlatformArm32::regName[load_arg1_reg_no],
-              PlatformArm32::regName[load_arg2_reg_no]);
-
-    // r10 * r9 -> r11
-    int32_t tempRegNo = simpleRegisterAllocator.Allocate();
-    iloc.inst("mul",
-              PlatformArm32::regName[tempRegNo],
-              PlatformArm32::regName[load_result_reg_no],
-              PlatformArm32::regName[load_arg2_reg_no]);
+    // 商放在ip寄存器中，结果寄存器可能与源操作数的寄存器相同，只能在最后写入。
+    // 源操作数可能位于不受临时寄存器分配管理的r0-r3中，临时分配的寄存器可能与之重叠，因此不用
+    iloc.inst(ArmOp::SDIV, reg(ARM32_TMP_REG_NO), reg(load_arg1_reg_no), reg(load_arg2_reg_no));
 
-    // r8 - r11 -> r12
-    int32_t tempRegNo2 = simpleRegisterAllocator.Allocate();
-    iloc.inst("sub",
-              PlatformArm32::regName[tempRegNo2],
-              PlatformArm32::regName[load_arg1_reg_no],
-              PlatformArm32::regName[tempRegNo]);
+    // r8 - ip * r9 -> r10
+    iloc.inst(ArmOp::MLS, reg(load_result_reg_no), reg(ARM32_TMP_REG_NO), reg(load_arg2_reg_no), reg(load_arg1_reg_no));
 
     // 结果不是寄存器，则需要把rs_reg_name保存到结果变量中
     if (result_reg_no == -1) {
-        iloc.store_var(tempRegNo2, result, ARM32_TMP_REG_NO);
+        iloc.store_var(load_result_reg_no, result, ARM32_TMP_REG_NO);
     }
 
     // 释放寄存器
@@ -386,6 +755,281 @@ void InstSelectorArm32::translate_mod_int32(Instruction * inst)
     simpleRegisterAllocator.free(result);
 }
 
+/// @brief 检查是否是2的幂次
+/// @param num 无符号整数
+/// @return true 是 false 不是
+static bool isPowerOfTwo(uint32_t num)
+{
+    return (num != 0) && ((num & (num - 1)) == 0);
+}
+
+/// @brief 求2的幂次的指数
+/// @param num 2的幂次
+/// @return int32_t 指数
+static int32_t log2OfPower(uint32_t num)
+{
+    int32_t k = 0;
+    while (num > 1) {
+        num >>= 1;
+        k++;
+    }
+
+    return k;
+}
+
+/// @brief 计算有符号除法的魔数与移位数，见Hacker's Delight 10-1节
+/// @param divisor 除数，大于1且不是2的幂次
+/// @param magic 魔数，与被除数相乘取高32位
+/// @param shift 取高32位后的算术右移位数
+static void signedDivMagic(uint32_t divisor, int32_t & magic, int32_t & shift)
+{
+    const uint32_t two31 = 0x80000000u;
+
+    uint32_t anc = two31 - 1 - two31 % divisor;
+    uint32_t q1 = two31 / anc;
+    uint32_t r1 = two31 - q1 * anc;
+    uint32_t q2 = two31 / divisor;
+    uint32_t r2 = two31 - q2 * divisor;
+    uint32_t delta;
+    int32_t p = 31;
+
+    do {
+        p++;
+        q1 = 2 * q1;
+        r1 = 2 * r1;
+        if (r1 >= anc) {
+            q1++;
+            r1 -= anc;
+        }
+        q2 = 2 * q2;
+        r2 = 2 * r2;
+        if (r2 >= divisor) {
+            q2++;
+            r2 -= divisor;
+        }
+        delta = divisor - r2;
+    } while ((q1 < delta) || ((q1 == delta) && (r1 == 0)));
+
+    magic = (int32_t) (q2 + 1);
+    shift = p - 32;
+}
+
+/// @brief 源操作数与常量的运算翻译成ARM32汇编，源操作数与结果的加载和保存同二元操作
+/// @param inst IR指令
+/// @param arg 非常量的源操作数
+/// @param constVal 常量
+/// @param emitter 运算指令的生成函数
+void InstSelectorArm32::translate_const_operator(Instruction * inst,
+                                                 Value * arg,
+                                                 int32_t constVal,
+                                                 const_emitter emitter)
+{
+    Value * result = inst;
+
+    int32_t arg_reg_no = arg->getRegId();
+    int32_t result_reg_no = inst->getRegId();
+    int32_t load_arg_reg_no, load_result_reg_no;
+
+    if (arg_reg_no == -1) {
+        load_arg_reg_no = simpleRegisterAllocator.Allocate(arg);
+        iloc.load_var(load_arg_reg_no, arg);
+    } else {
+        load_arg_reg_no = arg_reg_no;
+    }
+
+    if (result_reg_no == -1) {
+        load_result_reg_no = simpleRegisterAllocator.Allocate(result);
+    } else {
+        load_result_reg_no = result_reg_no;
+    }
+
+    (this->*emitter)(load_result_reg_no, load_arg_reg_no, constVal);
+
+    if (result_reg_no == -1) {
+        iloc.store_var(load_result_reg_no, result, ARM32_TMP_REG_NO);
+    }
+
+    simpleRegisterAllocator.free(arg);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 检查乘以常量能否用移位与加减代替
+/// @param constVal 常量
+/// @return true 可以 false 不可以
+bool InstSelectorArm32::isMulByShift(int32_t constVal)
+{
+    if (constVal == 0) {
+        return true;
+    }
+
+    // 常量的绝对值去掉末尾的0后为1、2^k+1或2^k-1
+    uint32_t num = (constVal < 0) ? (0u - (uint32_t) constVal) : (uint32_t) constVal;
+    while ((num & 1) == 0) {
+        num >>= 1;
+    }
+
+    return (num == 1) || isPowerOfTwo(num - 1) || isPowerOfTwo(num + 1);
+}
+
+/// @brief 乘以常量，用移位以及带移位操作数的add、rsb代替mul
+/// @param rs_reg_no 结果寄存器号
+/// @param arg_reg_no 源操作数寄存器号
+/// @param constVal 常量
+void InstSelectorArm32::emit_mul_const(int32_t rs_reg_no, int32_t arg_reg_no, int32_t constVal)
+{
+    MachineOperand rs = reg(rs_reg_no);
+    MachineOperand arg = reg(arg_reg_no);
+
+    if (constVal == 0) {
+        iloc.inst(ArmOp::MOV, rs, imm(0));
+        return;
+    }
+
+    uint32_t num = (constVal < 0) ? (0u - (uint32_t) constVal) : (uint32_t) constVal;
+    int32_t shift = 0;
+    while ((num & 1) == 0) {
+        num >>= 1;
+        shift++;
+    }
+
+    if (num == 1) {
+        // x * 2^s = x << s
+        if (shift != 0) {
+            iloc.inst(ArmOp::LSL, rs, arg, imm(shift));
+        } else if (rs_reg_no != arg_reg_no) {
+            iloc.mov_reg(rs_reg_no, arg_reg_no);
+        }
+    } else {
+        if (isPowerOfTwo(num - 1)) {
+            // x * (2^k + 1) = x + (x << k)
+            iloc.inst(ArmOp::ADD, rs, arg, MachineOperand::shifted(arg_reg_no, ArmShift::LSL, log2OfPower(num - 1)));
+        } else {
+            // x * (2^k - 1) = (x << k) - x
+            iloc.inst(ArmOp::RSB, rs, arg, MachineOperand::shifted(arg_reg_no, ArmShift::LSL, log2OfPower(num + 1)));
+        }
+
+        if (shift != 0) {
+            iloc.inst(ArmOp::LSL, rs, rs, imm(shift));
+        }
+    }
+
+    if (constVal < 0) {
+        iloc.inst(ArmOp::RSB, rs, rs, imm(0));
+    }
+}
+
+/// @brief 被除数除以正常量的商，结果写入rs_reg_no，rs_reg_no不能与arg_reg_no相同
+/// @param rs_reg_no 结果寄存器号
+/// @param arg_reg_no 被除数寄存器号
+/// @param divisor 除数，大于1
+void InstSelectorArm32::emit_div_positive(int32_t rs_reg_no, int32_t arg_reg_no, uint32_t divisor)
+{
+    MachineOperand rs = reg(rs_reg_no);
+    MachineOperand arg = reg(arg_reg_no);
+
+    if (isPowerOfTwo(divisor)) {
+
+        // 算术右移是向下取整，被除数为负时先加上2^k-1，使得结果向0取整
+        int32_t k = log2OfPower(divisor);
+        if (k == 1) {
+            iloc.inst(ArmOp::ADD, rs, arg, MachineOperand::shifted(arg_reg_no, ArmShift::LSR, 31));
+        } else {
+            iloc.inst(ArmOp::ASR, rs, arg, imm(31));
+            iloc.inst(ArmOp::ADD, rs, arg, MachineOperand::shifted(rs_reg_no, ArmShift::LSR, 32 - k));
+        }
+        iloc.inst(ArmOp::ASR, rs, rs, imm(k));
+    } else {
+
+        // 乘以魔数取高32位，再右移并加上符号位修正负数的舍入
+        int32_t magic, shift;
+        signedDivMagic(divisor, magic, shift);
+
+        iloc.load_imm(rs_reg_no, magic);
+        iloc.inst(ArmOp::SMMUL, rs, arg, rs);
+        if (magic < 0) {
+            iloc.inst(ArmOp::ADD, rs, rs, arg);
+        }
+        if (shift > 0) {
+            iloc.inst(ArmOp::ASR, rs, rs, imm(shift));
+        }
+        iloc.inst(ArmOp::ADD, rs, rs, MachineOperand::shifted(rs_reg_no, ArmShift::LSR, 31));
+    }
+}
+
+/// @brief 有符号整数除以非0常量，2的幂次用移位修正，其它用魔数乘法代替sdiv
+/// @param rs_reg_no 结果寄存器号
+/// @param arg_reg_no 源操作数寄存器号
+/// @param constVal 常量
+void InstSelectorArm32::emit_div_const(int32_t rs_reg_no, int32_t arg_reg_no, int32_t constVal)
+{
+    if (constVal == 1) {
+        if (rs_reg_no != arg_reg_no) {
+            iloc.mov_reg(rs_reg_no, arg_reg_no);
+        }
+        return;
+    }
+
+    if (constVal == -1) {
+        iloc.inst(ArmOp::RSB, reg(rs_reg_no), reg(arg_reg_no), imm(0));
+        return;
+    }
+
+    // 结果寄存器与被除数相同时商借助临时寄存器计算，x / -d = -(x / d)
+    int32_t quot_reg_no = (rs_reg_no != arg_reg_no) ? rs_reg_no : simpleRegisterAllocator.Allocate();
+    uint32_t divisor = (constVal < 0) ? (0u - (uint32_t) constVal) : (uint32_t) constVal;
+
+    emit_div_positive(quot_reg_no, arg_reg_no, divisor);
+
+    if (constVal < 0) {
+        iloc.inst(ArmOp::RSB, reg(rs_reg_no), reg(quot_reg_no), imm(0));
+    } else if (quot_reg_no != rs_reg_no) {
+        iloc.mov_reg(rs_reg_no, quot_reg_no);
+    }
+
+    if (quot_reg_no != rs_reg_no) {
+        simpleRegisterAllocator.free(quot_reg_no);
+    }
+}
+
+/// @brief 有符号整数对非0常量求余，先求商再用被除数减去商与常量的乘积
+/// @param rs_reg_no 结果寄存器号
+/// @param arg_reg_no 源操作数寄存器号
+/// @param constVal 常量
+void InstSelectorArm32::emit_mod_const(int32_t rs_reg_no, int32_t arg_reg_no, int32_t constVal)
+{
+    MachineOperand rs = reg(rs_reg_no);
+    MachineOperand arg = reg(arg_reg_no);
+
+    if ((constVal == 1) || (constVal == -1)) {
+        iloc.inst(ArmOp::MOV, rs, imm(0));
+        return;
+    }
+
+    // 余数的符号与被除数相同，与除数的符号无关，x % -d = x % d
+    uint32_t divisor = (constVal < 0) ? (0u - (uint32_t) constVal) : (uint32_t) constVal;
+
+    int32_t quot_reg_no = simpleRegisterAllocator.Allocate();
+    MachineOperand quot = reg(quot_reg_no);
+
+    emit_div_positive(quot_reg_no, arg_reg_no, divisor);
+
+    if (isPowerOfTwo(divisor)) {
+        iloc.inst(ArmOp::SUB, rs, arg, MachineOperand::shifted(quot_reg_no, ArmShift::LSL, log2OfPower(divisor)));
+    } else {
+        if (isMulByShift((int32_t) divisor)) {
+            emit_mul_const(quot_reg_no, quot_reg_no, (int32_t) divisor);
+        } else {
+            int32_t divisor_reg_no = simpleRegisterAllocator.Allocate();
+            iloc.load_imm(divisor_reg_no, (int32_t) divisor);
+            iloc.inst(ArmOp::MUL, quot, quot, reg(divisor_reg_no));
+            simpleRegisterAllocator.free(divisor_reg_no);
+        }
+        iloc.inst(ArmOp::SUB, rs, arg, quot);
+    }
+
+    simpleRegisterAllocator.free(quot_reg_no);
+}
+
 /// @brief 整数取负指令翻译成ARM32汇编
 /// @param inst IR指令
 void InstSelectorArm32::translate_neg_int32(Instruction * inst)
@@ -414,10 +1058,10 @@ void InstSelectorArm32::translate_neg_int32(Instruction * inst)
     }
 
     // 生成RSB指令：Rd = 0 - Rn
-    iloc.inst("rsb",
-              PlatformArm32::regName[load_result_reg_no], // 目标寄存器
-              PlatformArm32::regName[load_arg1_reg_no],   // 源寄存器
-              "#0");                                      // 立即数0
+    iloc.inst(ArmOp::RSB,
+              reg(load_result_reg_no), // 目标寄存器
+              reg(load_arg1_reg_no),   // 源寄存器
+              imm(0));                 // 立即数0
 
     // 结果存储处理
     if (result_reg_no == -1) {
@@ -460,6 +1104,15 @@ void InstSelectorArm32::translate_call(Instruction * inst)
 
             auto arg = callInst->getOperand(k);
 
+            // 寄存器分配前已经把实参保存到栈传值的位置上，则不需要再次传值
+            int32_t argBaseRegId;
+            int64_t argOffset;
+            if (arg->getMemoryAddr(&argBaseRegId, &argOffset) && (argBaseRegId == ARM32_SP_REG_NO) &&
+                (argOffset == esp)) {
+                esp += 4;
+                continue;
+            }
+
             // 新建一个内存变量，用于栈传值到形参变量中
             MemVariable * newVal = func->newMemVariable((Type *) PointerType::get(arg->getType()));
             newVal->setMemoryAddr(ARM32_SP_REG_NO, esp);
@@ -31,7 +31,7 @@ using namespace std;
 class InstSelectorArm32 {
 
     /// @brief 所有的IR指令
-    std::vector<Instruction *> & ir;
+    InterCode & ir;
 
     /// @brief 指令变换
     ILocArm32 & iloc;
@@ -68,6 +68,28 @@ protected:
     /// @param inst IR指令
     void translate_goto(Instruction * inst);
 
+    /// @brief 条件跳转指令（bc、bt、bf）翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_branch(Instruction * inst);
+
+    /// @brief 比较指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_relop(Instruction * inst);
+
+    /// @brief 比较指令的两个操作数翻译成cmp或cmn指令
+    /// @param inst 比较指令
+    /// @return 比较结果为真时的条件码
+    ArmCond translate_cmp(Instruction * inst);
+
+    /// @brief 比较指令是否只被紧随其后的条件跳转使用，中间只允许不影响条件标志的赋值指令
+    /// @param inst 比较指令
+    /// @return true 可以融合 false 不能融合
+    bool isFusedCompare(Instruction * inst);
+
+    /// @brief 获取当前翻译指令之后第一条有效的IR指令
+    /// @return Instruction* 指令，没有时为nullptr
+    Instruction * nextInst();
+
     /// @brief 整数加法指令翻译成ARM32汇编
     /// @param inst IR指令
     void translate_add_int32(Instruction * inst);
@@ -89,10 +111,57 @@ protected:
     void translate_mul_int32(Instruction * inst);
 
     void translate_neg_int32(Instruction * inst);
+
+    /// @brief 常量运算的生成函数原型，参数依次为结果寄存器、源操作数寄存器和常量
+    typedef void (InstSelectorArm32::*const_emitter)(int32_t, int32_t, int32_t);
+
+    /// @brief 源操作数与常量的运算翻译成ARM32汇编，源操作数与结果的加载和保存同二元操作
+    /// @param inst IR指令
+    /// @param arg 非常量的源操作数
+    /// @param constVal 常量
+    /// @param emitter 运算指令的生成函数
+    void translate_const_operator(Instruction * inst, Value * arg, int32_t constVal, const_emitter emitter);
+
+    /// @brief 检查乘以常量能否用移位与加减代替
+    /// @param constVal 常量
+    /// @return true 可以 false 不可以
+    static bool isMulByShift(int32_t constVal);
+
+    /// @brief 乘以常量，用移位以及带移位操作数的add、rsb代替mul
+    /// @param rs_reg_no 结果寄存器号
+    /// @param arg_reg_no 源操作数寄存器号
+    /// @param constVal 常量
+    void emit_mul_const(int32_t rs_reg_no, int32_t arg_reg_no, int32_t constVal);
+
+    /// @brief 有符号整数除以非0常量，2的幂次用移位修正，其它用魔数乘法代替sdiv
+    /// @param rs_reg_no 结果寄存器号
+    /// @param arg_reg_no 源操作数寄存器号
+    /// @param constVal 常量
+    void emit_div_const(int32_t rs_reg_no, int32_t arg_reg_no, int32_t constVal);
+
+    /// @brief 有符号整数对非0常量求余，先求商再用被除数减去商与常量的乘积
+    /// @param rs_reg_no 结果寄存器号
+    /// @param arg_reg_no 源操作数寄存器号
+    /// @param constVal 常量
+    void emit_mod_const(int32_t rs_reg_no, int32_t arg_reg_no, int32_t constVal);
+
+    /// @brief 被除数除以正常量的商，结果写入rs_reg_no，rs_reg_no不能与arg_reg_no相同
+    /// @param rs_reg_no 结果寄存器号
+    /// @param arg_reg_no 被除数寄存器号
+    /// @param divisor 除数，大于1
+    void emit_div_positive(int32_t rs_reg_no, int32_t arg_reg_no, uint32_t divisor);
+
+    /// @brief 常量能否作为指令的立即数，不能直接编码时尝试改用对偶指令
+    /// @param operator_name 操作码，改用对偶指令时被替换，如add与sub、cmp与cmn互换
+    /// @param constVal 常量
+    /// @param immOperand 立即数寻址的操作数
+    /// @return true 可以立即数寻址 false 只能加载到寄存器
+    bool selectImmOperand(ArmOp & operator_name, int32_t constVal, MachineOperand & immOperand);
+
     /// @brief 二元操作指令翻译成ARM32汇编
     /// @param inst IR指令
     /// @param operator_name 操作码
-    void translate_two_operator(Instruction * inst, string operator_name);
+    void translate_two_operator(Instruction * inst, ArmOp operator_name);
 
     /// @brief 函数调用指令翻译成ARM32汇编
     /// @param inst IR指令
@@ -128,6 +197,15 @@ protected:
     /// @brief 累计的实参个数
     int32_t realArgCount = 0;
 
+    /// @brief 当前翻译的IR指令
+    Instruction * curInst = nullptr;
+
+    /// @brief 已输出cmp、条件标志留给紧随的条件跳转使用的比较指令
+    Instruction * fusedCompare = nullptr;
+
+    /// @brief fusedCompare为真时的条件码
+    ArmCond fusedCond = ArmCond::AL;
+
     ///
     /// @brief 显示IR指令内容
     ///
@@ -138,7 +216,7 @@ public:
     /// @param _irCode IR指令
     /// @param _func 函数
     /// @param _iloc 后端指令
-    InstSelectorArm32(std::vector<Instruction *> & _irCode,
+    InstSelectorArm32(InterCode & _irCode,
                       ILocArm32 & _iloc,
                       Function * _func,
                       SimpleRegisterAllocator & allocator);
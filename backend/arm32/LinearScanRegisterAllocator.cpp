@@ -0,0 +1,184 @@
+///
+/// @file LinearScanRegisterAllocator.cpp
+/// @brief 基于活跃区间的线性扫描寄存器分配器
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，r4-r10的线性扫描寄存器分配
+/// </table>
+///
+#include <algorithm>
+#include <cstdint>
+
+#include "LinearScanRegisterAllocator.h"
+#include "PlatformArm32.h"
+
+///
+/// @brief 构造函数
+/// @param _func 要分配寄存器的函数
+///
+LinearScanRegisterAllocator::LinearScanRegisterAllocator(Function * _func) : GlobalRegisterAllocator(_func)
+{}
+
+///
+/// @brief 执行寄存器分配，分配成功的Value设置寄存器编号
+///
+void LinearScanRegisterAllocator::run()
+{
+    // 指令编号后划分基本块
+    buildBlocks();
+
+    // 活跃变量分析
+    computeLiveness();
+
+    // 活跃区间计算
+    buildIntervals();
+
+    // 线性扫描分配寄存器
+    linearScan();
+}
+
+///
+/// @brief 根据活跃变量信息计算每个Value的活跃区间
+///
+void LinearScanRegisterAllocator::buildIntervals()
+{
+    int32_t valueNum = (int32_t) values.size();
+
+    intervals.resize(valueNum);
+    for (int32_t id = 0; id < valueNum; ++id) {
+        intervals[id] = LiveInterval{values[id], INT32_MAX, -1};
+    }
+
+    auto extend = [&](int32_t id, int32_t pos) {
+        LiveInterval & interval = intervals[id];
+        interval.start = std::min(interval.start, pos);
+        interval.end = std::max(interval.end, pos);
+    };
+
+    std::vector<Value *> uses;
+
+    for (auto & block: blocks) {
+
+        int32_t blockStart = block.first * 2;
+        int32_t blockEnd = block.last * 2 + 1;
+
+        // 基本块入口活跃的Value覆盖基本块的开始，出口活跃的覆盖基本块的结束
+        for (int32_t id = 0; id < valueNum; ++id) {
+            if (block.liveIn.get(id)) {
+                extend(id, blockStart);
+            }
+            if (block.liveOut.get(id)) {
+                extend(id, blockEnd);
+            }
+        }
+
+        // 使用点为指令序号的两倍，定值点为两倍加一，使得源操作数与结果可共用同一寄存器
+        for (int32_t k = block.first; k <= block.last; ++k) {
+
+            Value * def = getUseDef(insts[k], uses);
+
+            for (auto use: uses) {
+                int32_t id = valueIndex(use);
+                if (id != -1) {
+                    extend(id, k * 2);
+                }
+            }
+
+            int32_t id = valueIndex(def);
+            if (id != -1) {
+                extend(id, k * 2 + 1);
+            }
+        }
+    }
+}
+
+///
+/// @brief 按照区间起点次序线性扫描分配寄存器
+///
+void LinearScanRegisterAllocator::linearScan()
+{
+    std::vector<LiveInterval *> sorted;
+    for (auto & interval: intervals) {
+
+        // 先清除之前的分配结果
+        interval.val->setRegId(-1);
+
+        if (interval.end != -1) {
+            sorted.push_back(&interval);
+        }
+    }
+
+    std::sort(sorted.begin(), sorted.end(), [](LiveInterval * a, LiveInterval * b) {
+        return (a->start < b->start) || ((a->start == b->start) && (a->end < b->end));
+    });
+
+    // 当前占用寄存器的区间，按照终点从小到大排列
+    std::vector<LiveInterval *> active;
+
+    // 寄存器是否空闲
+    bool regFree[PlatformArm32::maxRegNum] = {false};
+    bool regUsed[PlatformArm32::maxRegNum] = {false};
+    for (int32_t reg = ARM32_ALLOC_REG_FIRST; reg <= ARM32_ALLOC_REG_LAST; ++reg) {
+        regFree[reg] = true;
+    }
+
+    auto addActive = [&](LiveInterval * interval) {
+        auto pos = std::upper_bound(active.begin(), active.end(), interval, [](LiveInterval * a, LiveInterval * b) {
+            return a->end < b->end;
+        });
+        active.insert(pos, interval);
+    };
+
+    for (auto interval: sorted) {
+
+        // 终点在当前起点之前的区间已经结束，释放其寄存器
+        while (!active.empty() && (active.front()->end < interval->start)) {
+            regFree[active.front()->val->getRegId()] = true;
+            active.erase(active.begin());
+        }
+
+        // 选取编号最小的空闲寄存器，减少需要保护的寄存器个数
+        int32_t freeReg = -1;
+        for (int32_t reg = ARM32_ALLOC_REG_FIRST; reg <= ARM32_ALLOC_REG_LAST; ++reg) {
+            if (regFree[reg]) {
+                freeReg = reg;
+                break;
+            }
+        }
+
+        if (freeReg != -1) {
+            regFree[freeReg] = false;
+            regUsed[freeReg] = true;
+            interval->val->setRegId(freeReg);
+            addActive(interval);
+            continue;
+        }
+
+        // 没有空闲寄存器，溢出终点最远的区间
+        LiveInterval * spill = active.back();
+        if (spill->end > interval->end) {
+
+            // 当前区间抢占溢出区间的寄存器
+            interval->val->setRegId(spill->val->getRegId());
+            spill->val->setRegId(-1);
+            active.pop_back();
+            addActive(interval);
+        }
+
+        // 否则当前区间溢出，不分配寄存器，后续由栈空间分配处理
+    }
+
+    usedRegs.clear();
+    for (int32_t reg = ARM32_ALLOC_REG_FIRST; reg <= ARM32_ALLOC_REG_LAST; ++reg) {
+        if (regUsed[reg]) {
+            usedRegs.push_back(reg);
+        }
+    }
+}
@@ -0,0 +1,68 @@
+///
+/// @file LinearScanRegisterAllocator.h
+/// @brief 基于活跃区间的线性扫描寄存器分配器
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，r4-r10的线性扫描寄存器分配
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "GlobalRegisterAllocator.h"
+
+///
+/// @brief 线性扫描寄存器分配器
+///
+/// 根据活跃变量分析的结果得到每个局部变量与临时变量的活跃区间，然后按照区间起点的次序扫描，
+/// 为其分配r4-r10寄存器。寄存器不够时选择区间终点最远的溢出，溢出的Value不设置寄存器编号。
+///
+class LinearScanRegisterAllocator : public GlobalRegisterAllocator {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 要分配寄存器的函数
+    ///
+    explicit LinearScanRegisterAllocator(Function * _func);
+
+    ///
+    /// @brief 执行寄存器分配，分配成功的Value设置寄存器编号
+    ///
+    void run() override;
+
+protected:
+    ///
+    /// @brief 活跃区间，位置采用指令序号的两倍，使用点为偶数，定值点为奇数
+    ///
+    struct LiveInterval {
+        Value * val;
+        int32_t start;
+        int32_t end;
+    };
+
+    ///
+    /// @brief 根据活跃变量信息计算每个Value的活跃区间
+    ///
+    void buildIntervals();
+
+    ///
+    /// @brief 按照区间起点次序线性扫描分配寄存器
+    ///
+    void linearScan();
+
+private:
+    ///
+    /// @brief 每个Value的活跃区间，下标为Value编号
+    ///
+    std::vector<LiveInterval> intervals;
+};
@@ -0,0 +1,288 @@
+///
+/// @file MachineInstr.cpp
+/// @brief ARM32的机器指令表示的实现
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，类型化的机器指令，替代字符串形式的ArmInst
+/// </table>
+///
+#include "MachineInstr.h"
+#include "PlatformArm32.h"
+
+/// @brief 操作码助记符，次序与ArmOp一致
+static const char * const opNames[] = {
+    "",    ".label", "@",    "mov", "mvn", "movw", "movt", "add", "sub", "rsb", "mul",
+    "mla", "mls",    "sdiv", "smmul", "and", "orr", "eor", "bic", "lsl", "lsr", "asr",
+    "cmp", "cmn",    "ldr",  "str", "b",   "bl",   "bx",   "push", "pop",
+};
+
+/// @brief 条件码后缀，次序与ArmCond一致
+static const char * const condNames[] = {
+    "eq", "ne", "hs", "lo", "mi", "pl", "vs", "vc", "hi", "ls", "ge", "lt", "gt", "le", "",
+};
+
+/// @brief 移位操作助记符，次序与ArmShift一致
+static const char * const shiftNames[] = {"lsl", "lsr", "asr", "ror"};
+
+///
+/// @brief 获取操作码的助记符
+/// @param op 操作码
+/// @return const char* 助记符
+///
+const char * armOpName(ArmOp op)
+{
+    return opNames[(uint8_t) op];
+}
+
+///
+/// @brief 获取条件码的后缀，无条件执行时为空串
+/// @param cond 条件码
+/// @return const char* 后缀
+///
+const char * armCondName(ArmCond cond)
+{
+    return condNames[(uint8_t) cond];
+}
+
+MachineOperand MachineOperand::reg(int32_t regNo)
+{
+    MachineOperand operand;
+    operand.kind = Reg;
+    operand.regNo = (uint8_t) regNo;
+    return operand;
+}
+
+MachineOperand MachineOperand::immediate(int32_t num)
+{
+    MachineOperand operand;
+    operand.kind = Imm;
+    operand.imm = num;
+    return operand;
+}
+
+MachineOperand MachineOperand::shifted(int32_t regNo, ArmShift shift, int32_t amount)
+{
+    MachineOperand operand;
+    operand.kind = ShiftedReg;
+    operand.regNo = (uint8_t) regNo;
+    operand.shift = shift;
+    operand.imm = amount;
+    return operand;
+}
+
+MachineOperand MachineOperand::mem(int32_t baseRegNo, int32_t disp)
+{
+    MachineOperand operand;
+    operand.kind = Mem;
+    operand.regNo = (uint8_t) baseRegNo;
+    operand.imm = disp;
+    return operand;
+}
+
+MachineOperand MachineOperand::memIndex(int32_t baseRegNo, int32_t indexRegNo)
+{
+    MachineOperand operand;
+    operand.kind = MemIndex;
+    operand.regNo = (uint8_t) baseRegNo;
+    operand.indexNo = (uint8_t) indexRegNo;
+    return operand;
+}
+
+MachineOperand MachineOperand::label(const char * name)
+{
+    MachineOperand operand;
+    operand.kind = Label;
+    operand.sym = name;
+    return operand;
+}
+
+MachineOperand MachineOperand::half(Kind kind, int32_t num)
+{
+    MachineOperand operand;
+    operand.kind = kind;
+    operand.imm = num;
+    return operand;
+}
+
+MachineOperand MachineOperand::half(Kind kind, const char * name)
+{
+    MachineOperand operand;
+    operand.kind = kind;
+    operand.sym = name;
+    return operand;
+}
+
+MachineOperand MachineOperand::regList(uint32_t mask)
+{
+    MachineOperand operand;
+    operand.kind = RegList;
+    operand.regMask = mask;
+    return operand;
+}
+
+MachineOperand MachineOperand::text(const char * str)
+{
+    MachineOperand operand;
+    operand.kind = Text;
+    operand.sym = str;
+    return operand;
+}
+
+///
+/// @brief 操作数是否相同
+///
+bool MachineOperand::operator==(const MachineOperand & other) const
+{
+    if (kind != other.kind) {
+        return false;
+    }
+
+    switch (kind) {
+        case None:
+            return true;
+        case Reg:
+            return regNo == other.regNo;
+        case Imm:
+            return imm == other.imm;
+        case ShiftedReg:
+            return (regNo == other.regNo) && (shift == other.shift) && (imm == other.imm);
+        case Mem:
+            return (regNo == other.regNo) && (imm == other.imm);
+        case MemIndex:
+            return (regNo == other.regNo) && (indexNo == other.indexNo);
+        case RegList:
+            return regMask == other.regMask;
+        case Lower16:
+        case Upper16:
+            return (sym == other.sym) && (sym || (imm == other.imm));
+        default:
+            return sym == other.sym;
+    }
+}
+
+///
+/// @brief 输出操作数的汇编文本
+/// @param writer 汇编输出
+///
+void MachineOperand::print(AsmWriter & writer) const
+{
+    switch (kind) {
+        case None:
+            break;
+        case Reg:
+            writer << PlatformArm32::regName[regNo];
+            break;
+        case Imm:
+            writer << '#' << imm;
+            break;
+        case ShiftedReg:
+            // r1,lsl #2
+            writer << PlatformArm32::regName[regNo] << ',' << shiftNames[(uint8_t) shift] << " #" << imm;
+            break;
+        case Mem:
+            // [fp,#-16] [fp]
+            writer << '[' << PlatformArm32::regName[regNo];
+            if (imm != 0) {
+                writer << ",#" << imm;
+            }
+            writer << ']';
+            break;
+        case MemIndex:
+            // [fp,r8]
+            writer << '[' << PlatformArm32::regName[regNo] << ',' << PlatformArm32::regName[indexNo] << ']';
+            break;
+        case Lower16:
+        case Upper16:
+            writer << ((kind == Lower16) ? "#:lower16:" : "#:upper16:");
+            if (sym) {
+                writer << sym;
+            } else {
+                writer << imm;
+            }
+            break;
+        case RegList: {
+            writer << '{';
+            bool first = true;
+            for (int32_t k = 0; k < PlatformArm32::maxRegNum; ++k) {
+                if (regMask & (1u << k)) {
+                    if (!first) {
+                        writer << ',';
+                    }
+                    writer << PlatformArm32::regName[k];
+                    first = false;
+                }
+            }
+            writer << '}';
+            break;
+        }
+        default:
+            writer << sym;
+            break;
+    }
+}
+
+///
+/// @brief 构造函数，操作数的种类为None时不计入
+///
+MachineInstr::MachineInstr(ArmOp op,
+                           const MachineOperand & op0,
+                           const MachineOperand & op1,
+                           const MachineOperand & op2,
+                           const MachineOperand & op3)
+{
+    replace(op, op0, op1, op2, op3);
+}
+
+///
+/// @brief 替换操作码与操作数，条件码不变
+///
+void MachineInstr::replace(ArmOp op,
+                           const MachineOperand & op0,
+                           const MachineOperand & op1,
+                           const MachineOperand & op2,
+                           const MachineOperand & op3)
+{
+    opcode = op;
+    operands[0] = op0;
+    operands[1] = op1;
+    operands[2] = op2;
+    operands[3] = op3;
+
+    numOperands = 0;
+    while ((numOperands < maxOperands) && (operands[numOperands].kind != MachineOperand::None)) {
+        numOperands++;
+    }
+}
+
+///
+/// @brief 输出指令的汇编文本，不含缩进与换行，无效指令与NOP不输出
+/// @param writer 汇编输出
+///
+void MachineInstr::print(AsmWriter & writer) const
+{
+    if (dead || (opcode == ArmOp::NOP)) {
+        return;
+    }
+
+    if (opcode == ArmOp::LABEL) {
+        // .L1:
+        operands[0].print(writer);
+        writer << ':';
+        return;
+    }
+
+    // blt .L1 或 add r0,r1,#1
+    writer << armOpName(opcode) << armCondName(cond);
+
+    for (int32_t k = 0; k < numOperands; ++k) {
+        writer << ((k == 0) ? ' ' : ',');
+        operands[k].print(writer);
+    }
+}
@@ -0,0 +1,305 @@
+///
+/// @file MachineInstr.h
+/// @brief ARM32的机器指令表示，操作码、条件码与操作数都是类型化的
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，类型化的机器指令，替代字符串形式的ArmInst
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+
+#include "AsmWriter.h"
+
+///
+/// @brief ARM32操作码
+///
+enum class ArmOp : uint8_t {
+    /// @brief 占位指令，不输出
+    NOP,
+    /// @brief Label，操作数为Label名称
+    LABEL,
+    /// @brief 注释，操作数为注释内容
+    COMMENT,
+
+    MOV,
+    MVN,
+    MOVW,
+    MOVT,
+
+    ADD,
+    SUB,
+    RSB,
+    MUL,
+    MLA,
+    MLS,
+    SDIV,
+    SMMUL,
+
+    AND,
+    ORR,
+    EOR,
+    BIC,
+
+    LSL,
+    LSR,
+    ASR,
+
+    CMP,
+    CMN,
+
+    LDR,
+    STR,
+
+    B,
+    BL,
+    BX,
+
+    PUSH,
+    POP,
+};
+
+///
+/// @brief 条件码，取值与指令编码的cond域一致，相邻的两个互为相反条件
+///
+enum class ArmCond : uint8_t {
+    EQ,
+    NE,
+    HS,
+    LO,
+    MI,
+    PL,
+    VS,
+    VC,
+    HI,
+    LS,
+    GE,
+    LT,
+    GT,
+    LE,
+    /// @brief 无条件执行
+    AL,
+};
+
+///
+/// @brief 移位操作，取值与指令编码的shift域一致
+///
+enum class ArmShift : uint8_t {
+    LSL,
+    LSR,
+    ASR,
+    ROR,
+};
+
+///
+/// @brief 条件码取反，如lt变为ge
+/// @param cond 条件码，不能是AL
+/// @return ArmCond 取反后的条件码
+///
+inline ArmCond invertCond(ArmCond cond)
+{
+    return (ArmCond) ((uint8_t) cond ^ 1);
+}
+
+///
+/// @brief 获取操作码的助记符
+/// @param op 操作码
+/// @return const char* 助记符
+///
+const char * armOpName(ArmOp op);
+
+///
+/// @brief 获取条件码的后缀，无条件执行时为空串
+/// @param cond 条件码
+/// @return const char* 后缀
+///
+const char * armCondName(ArmCond cond);
+
+///
+/// @brief 机器指令的操作数
+///
+/// 寄存器、立即数、Label等都是定长的值，Label与符号名称是ILocArm32区域内驻留的字符串，
+/// 同名的符号指针相同，可以直接比较指针。
+///
+struct MachineOperand {
+
+    ///
+    /// @brief 操作数的种类
+    ///
+    enum Kind : uint8_t {
+        /// @brief 没有操作数
+        None,
+        /// @brief 寄存器 r0
+        Reg,
+        /// @brief 立即数 #100
+        Imm,
+        /// @brief 移位的寄存器 r1,lsl #2
+        ShiftedReg,
+        /// @brief 基址加偏移的内存 [fp,#-16]
+        Mem,
+        /// @brief 基址加变址寄存器的内存 [fp,r8]
+        MemIndex,
+        /// @brief Label或函数名
+        Label,
+        /// @brief 常量或符号的低16位 #:lower16:a
+        Lower16,
+        /// @brief 常量或符号的高16位 #:upper16:a
+        Upper16,
+        /// @brief 寄存器列表 {r4,fp,lr}
+        RegList,
+        /// @brief 注释文本
+        Text,
+    };
+
+    /// @brief 种类
+    Kind kind = None;
+
+    /// @brief 寄存器，或者内存的基址寄存器
+    uint8_t regNo = 0;
+
+    /// @brief 内存的变址寄存器
+    uint8_t indexNo = 0;
+
+    /// @brief 移位的寄存器的移位操作
+    ArmShift shift = ArmShift::LSL;
+
+    union {
+        /// @brief 立即数、内存偏移、移位位数，或者Lower16/Upper16的常量
+        int32_t imm = 0;
+
+        /// @brief 寄存器列表的位图，第k位表示rk
+        uint32_t regMask;
+    };
+
+    /// @brief Label、符号名称或者注释文本，Lower16/Upper16为空时表示常量
+    const char * sym = nullptr;
+
+    /// @brief 寄存器
+    static MachineOperand reg(int32_t regNo);
+
+    /// @brief 立即数
+    static MachineOperand immediate(int32_t num);
+
+    /// @brief 移位的寄存器
+    static MachineOperand shifted(int32_t regNo, ArmShift shift, int32_t amount);
+
+    /// @brief 基址加偏移的内存
+    static MachineOperand mem(int32_t baseRegNo, int32_t disp = 0);
+
+    /// @brief 基址加变址寄存器的内存
+    static MachineOperand memIndex(int32_t baseRegNo, int32_t indexRegNo);
+
+    /// @brief Label或函数名
+    static MachineOperand label(const char * name);
+
+    /// @brief 常量的低16位或高16位
+    static MachineOperand half(Kind kind, int32_t num);
+
+    /// @brief 符号的低16位或高16位
+    static MachineOperand half(Kind kind, const char * name);
+
+    /// @brief 寄存器列表
+    static MachineOperand regList(uint32_t mask);
+
+    /// @brief 注释文本
+    static MachineOperand text(const char * str);
+
+    ///
+    /// @brief 是否是指定的寄存器
+    /// @param no 寄存器编号
+    ///
+    bool isReg(int32_t no) const
+    {
+        return (kind == Reg) && (regNo == no);
+    }
+
+    ///
+    /// @brief 操作数是否相同
+    ///
+    bool operator==(const MachineOperand & other) const;
+
+    bool operator!=(const MachineOperand & other) const
+    {
+        return !(*this == other);
+    }
+
+    ///
+    /// @brief 输出操作数的汇编文本
+    /// @param writer 汇编输出
+    ///
+    void print(AsmWriter & writer) const;
+};
+
+///
+/// @brief ARM32机器指令，在ILocArm32的区域内分配，只在输出时生成汇编文本
+///
+struct MachineInstr {
+
+    /// @brief 最多的操作数个数，如mls rd,rn,rm,ra
+    static const int32_t maxOperands = 4;
+
+    /// @brief 操作码
+    ArmOp opcode;
+
+    /// @brief 条件码
+    ArmCond cond = ArmCond::AL;
+
+    /// @brief 操作数个数
+    uint8_t numOperands = 0;
+
+    /// @brief 标识指令是否无效
+    bool dead = false;
+
+    /// @brief 操作数，第一个一般是结果
+    MachineOperand operands[maxOperands];
+
+    ///
+    /// @brief 构造函数，操作数的种类为None时不计入
+    ///
+    MachineInstr(ArmOp op,
+                 const MachineOperand & op0 = MachineOperand(),
+                 const MachineOperand & op1 = MachineOperand(),
+                 const MachineOperand & op2 = MachineOperand(),
+                 const MachineOperand & op3 = MachineOperand());
+
+    ///
+    /// @brief 替换操作码与操作数，条件码不变
+    ///
+    void replace(ArmOp op,
+                 const MachineOperand & op0 = MachineOperand(),
+                 const MachineOperand & op1 = MachineOperand(),
+                 const MachineOperand & op2 = MachineOperand(),
+                 const MachineOperand & op3 = MachineOperand());
+
+    /// @brief 设置死指令
+    void setDead()
+    {
+        dead = true;
+    }
+
+    /// @brief 是否是Label指令
+    bool isLabel() const
+    {
+        return opcode == ArmOp::LABEL;
+    }
+
+    /// @brief 是否是条件或无条件跳转到Label的指令
+    bool isBranch() const
+    {
+        return opcode == ArmOp::B;
+    }
+
+    ///
+    /// @brief 输出指令的汇编文本，不含缩进与换行，无效指令与NOP不输出
+    /// @param writer 汇编输出
+    ///
+    void print(AsmWriter & writer) const;
+};
@@ -0,0 +1,223 @@
+///
+/// @file PeepholeArm32.cpp
+/// @brief ARM32汇编指令序列上的窥孔优化
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，表驱动的窥孔优化
+/// </table>
+///
+#include "PeepholeArm32.h"
+#include "PlatformArm32.h"
+
+/// @brief 规则表，按照顺序尝试
+const std::vector<PeepholeArm32::Rule> PeepholeArm32::rules = {
+    {"store-load", 2, &PeepholeArm32::storeLoad},
+    {"self-move", 1, &PeepholeArm32::selfMove},
+    {"repeated-move", 2, &PeepholeArm32::repeatedMove},
+    {"jump-to-next", 2, &PeepholeArm32::jumpToNext},
+    {"branch-over-branch", 3, &PeepholeArm32::branchOverBranch},
+    {"wide-immediate", 2, &PeepholeArm32::wideImmediate},
+};
+
+/// @brief 检查是否是无条件执行的指定操作码的指令
+/// @param inst 指令
+/// @param op 操作码
+/// @return true 是 false 不是
+static bool isPlain(MachineInstr * inst, ArmOp op)
+{
+    return (inst->opcode == op) && (inst->cond == ArmCond::AL);
+}
+
+///
+/// @brief 构造函数
+/// @param _iloc 汇编指令序列
+///
+PeepholeArm32::PeepholeArm32(ILocArm32 & _iloc) : code(_iloc.getCode())
+{}
+
+///
+/// @brief 执行窥孔优化
+/// @return true 有指令被改写 false 没有改变
+///
+bool PeepholeArm32::run()
+{
+    bool everChanged = false;
+    bool changed = true;
+
+    while (changed) {
+        changed = false;
+
+        // 注释与无效指令不参与匹配
+        std::vector<MachineInstr *> insts;
+        for (auto inst: code) {
+            if (!inst->dead && (inst->opcode != ArmOp::NOP) && (inst->opcode != ArmOp::COMMENT)) {
+                insts.push_back(inst);
+            }
+        }
+
+        std::vector<MachineInstr *> window;
+        for (size_t k = 0; k < insts.size(); ++k) {
+
+            for (auto & rule: rules) {
+
+                if (k + rule.size > insts.size()) {
+                    continue;
+                }
+
+                // 本轮前面的改写可能使窗口内的指令失效
+                window.assign(insts.begin() + k, insts.begin() + k + rule.size);
+                bool valid = true;
+                for (auto inst: window) {
+                    valid = valid && !inst->dead;
+                }
+
+                if (valid && rule.apply(window)) {
+                    changed = true;
+                }
+            }
+        }
+
+        everChanged |= changed;
+    }
+
+    return everChanged;
+}
+
+///
+/// @brief str rX,[addr]后紧跟ldr rY,[addr]时，ldr改为mov rY,rX或删除
+///
+bool PeepholeArm32::storeLoad(std::vector<MachineInstr *> & window)
+{
+    MachineInstr * store = window[0];
+    MachineInstr * load = window[1];
+
+    if (!isPlain(store, ArmOp::STR) || !isPlain(load, ArmOp::LDR) || (store->operands[1] != load->operands[1])) {
+        return false;
+    }
+
+    if (store->operands[0] == load->operands[0]) {
+        load->setDead();
+    } else {
+        load->replace(ArmOp::MOV, load->operands[0], store->operands[0]);
+    }
+
+    return true;
+}
+
+///
+/// @brief 删除mov rX,rX
+///
+bool PeepholeArm32::selfMove(std::vector<MachineInstr *> & window)
+{
+    MachineInstr * inst = window[0];
+
+    if ((inst->opcode != ArmOp::MOV) || (inst->numOperands != 2) || (inst->operands[0] != inst->operands[1])) {
+        return false;
+    }
+
+    inst->setDead();
+    return true;
+}
+
+///
+/// @brief 删除重复的mov rX,op，op不是rX
+///
+bool PeepholeArm32::repeatedMove(std::vector<MachineInstr *> & window)
+{
+    MachineInstr * first = window[0];
+    MachineInstr * second = window[1];
+
+    if (!isPlain(first, ArmOp::MOV) || !isPlain(second, ArmOp::MOV)) {
+        return false;
+    }
+
+    if ((first->operands[0] != second->operands[0]) || (first->operands[1] != second->operands[1]) ||
+        (first->operands[0] == first->operands[1])) {
+        return false;
+    }
+
+    second->setDead();
+    return true;
+}
+
+///
+/// @brief 删除跳转到紧随其后的Label的跳转
+///
+bool PeepholeArm32::jumpToNext(std::vector<MachineInstr *> & window)
+{
+    MachineInstr * jump = window[0];
+    MachineInstr * label = window[1];
+
+    if (!jump->isBranch() || !label->isLabel() || (jump->operands[0] != label->operands[0])) {
+        return false;
+    }
+
+    jump->setDead();
+    return true;
+}
+
+///
+/// @brief b<c> L1; b L2; L1: 改为 b<!c> L2; L1:
+///
+bool PeepholeArm32::branchOverBranch(std::vector<MachineInstr *> & window)
+{
+    MachineInstr * branch = window[0];
+    MachineInstr * jump = window[1];
+    MachineInstr * label = window[2];
+
+    if (!branch->isBranch() || (branch->cond == ArmCond::AL) || !isPlain(jump, ArmOp::B) || !label->isLabel() ||
+        (branch->operands[0] != label->operands[0])) {
+        return false;
+    }
+
+    branch->cond = invertCond(branch->cond);
+    branch->operands[0] = jump->operands[0];
+    jump->setDead();
+
+    return true;
+}
+
+///
+/// @brief movw/movt加载的常量可编码为立即数时改为一条mov或mvn
+///
+bool PeepholeArm32::wideImmediate(std::vector<MachineInstr *> & window)
+{
+    MachineInstr * movw = window[0];
+    MachineInstr * movt = window[1];
+
+    // 符号的地址在链接时才确定
+    const MachineOperand & low = movw->operands[1];
+    if (!isPlain(movw, ArmOp::MOVW) || (low.kind != MachineOperand::Lower16) || low.sym) {
+        return false;
+    }
+    int32_t num = low.imm;
+
+    // 没有紧随的movt时高16位为0
+    const MachineOperand & high = movt->operands[1];
+    bool hasMovt = isPlain(movt, ArmOp::MOVT) && (movt->operands[0] == movw->operands[0]) &&
+                   (high.kind == MachineOperand::Upper16) && !high.sym && (high.imm == num);
+    if (!hasMovt) {
+        num &= 0xFFFF;
+    }
+
+    if (PlatformArm32::isImm(num)) {
+        movw->replace(ArmOp::MOV, movw->operands[0], MachineOperand::immediate(num));
+    } else if (PlatformArm32::isImm(~num)) {
+        movw->replace(ArmOp::MVN, movw->operands[0], MachineOperand::immediate(~num));
+    } else {
+        return false;
+    }
+
+    if (hasMovt) {
+        movt->setDead();
+    }
+
+    return true;
+}
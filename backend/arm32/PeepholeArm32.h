@@ -0,0 +1,100 @@
+///
+/// @file PeepholeArm32.h
+/// @brief ARM32汇编指令序列上的窥孔优化
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，表驱动的窥孔优化
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ILocArm32.h"
+
+///
+/// @brief ARM32的窥孔优化
+///
+/// 在相邻的有效指令（跳过注释与无效指令，Label也在窗口内）上按照规则表逐条匹配，
+/// 匹配成功的规则就地改写或删除窗口内的指令，反复进行直到没有规则可以匹配。
+///
+class PeepholeArm32 {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _iloc 汇编指令序列
+    ///
+    explicit PeepholeArm32(ILocArm32 & _iloc);
+
+    ///
+    /// @brief 执行窥孔优化
+    /// @return true 有指令被改写 false 没有改变
+    ///
+    bool run();
+
+protected:
+    ///
+    /// @brief 窥孔规则，窗口内的指令都有效时调用，改写成功返回true
+    ///
+    struct Rule {
+
+        /// @brief 规则名称
+        const char * name;
+
+        /// @brief 窗口大小
+        int32_t size;
+
+        /// @brief 匹配与改写函数
+        bool (*apply)(std::vector<MachineInstr *> & window);
+    };
+
+    ///
+    /// @brief str rX,[addr]后紧跟ldr rY,[addr]时，ldr改为mov rY,rX或删除
+    ///
+    static bool storeLoad(std::vector<MachineInstr *> & window);
+
+    ///
+    /// @brief 删除mov rX,rX
+    ///
+    static bool selfMove(std::vector<MachineInstr *> & window);
+
+    ///
+    /// @brief 删除重复的mov rX,op，op不是rX
+    ///
+    static bool repeatedMove(std::vector<MachineInstr *> & window);
+
+    ///
+    /// @brief 删除跳转到紧随其后的Label的跳转
+    ///
+    static bool jumpToNext(std::vector<MachineInstr *> & window);
+
+    ///
+    /// @brief b<c> L1; b L2; L1: 改为 b<!c> L2; L1:
+    ///
+    static bool branchOverBranch(std::vector<MachineInstr *> & window);
+
+    ///
+    /// @brief movw/movt加载的常量可编码为立即数时改为一条mov或mvn
+    ///
+    static bool wideImmediate(std::vector<MachineInstr *> & window);
+
+    ///
+    /// @brief 规则表
+    ///
+    static const std::vector<Rule> rules;
+
+private:
+    ///
+    /// @brief 汇编指令序列
+    ///
+    std::vector<MachineInstr *> & code;
+};
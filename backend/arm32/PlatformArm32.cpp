@@ -26,12 +26,11 @@ const std::string PlatformArm32::regName[PlatformArm32::maxRegNum] = {
     "r5",  // 需要栈保护
     "r6",  // 需要栈保护
     "r7",  // 需要栈保护
-    "r8",  // 用于加载操作数1,保存表达式结果
-    "r9",  // 用于加载操作数2,写回表达式结果,立即数，标签地址
-    "r10", // 用于保存乘法结果，虽然mul
-           // r8,r8,r9也能正常执行，但是避免交叉编译提示错误！
+    "r8",  // 需要栈保护
+    "r9",  // 需要栈保护
+    "r10", // 需要栈保护
     "fp",  // r11,局部变量寻址
-    "ip",  // r12，临时寄存器
+    "ip",  // r12，临时寄存器，用于立即数过大的寻址以及标签地址等
     "sp",  // r13，堆栈指针寄存器
     "lr", // r14，链接寄存器。LR存储子程序调用的返回地址。当执行BL指令时，PC的当前值会被保存到LR中。
     "pc", // r15，程序计数器。PC 存储着下一条将要执行的指令的地址。在执行分支指令时，PC会更新为新的地址。
@@ -96,6 +95,14 @@ bool PlatformArm32::constExpr(int num)
     return __constExpr(num) || __constExpr(-num);
 }
 
+/// @brief 判断num能否直接编码为数据处理指令的立即数，不考虑取负
+/// @param num
+/// @return
+bool PlatformArm32::isImm(int num)
+{
+    return __constExpr(num);
+}
+
 /// @brief 判定是否是合法的偏移
 /// @param num
 /// @return
@@ -19,8 +19,12 @@
 
 #include "RegVariable.h"
 
-// 在操作过程中临时借助的寄存器为ARM32_TMP_REG_NO
-#define ARM32_TMP_REG_NO 10
+// 在操作过程中临时借助的寄存器为ARM32_TMP_REG_NO，采用不需要保护的ip寄存器
+#define ARM32_TMP_REG_NO 12
+
+// 全局寄存器分配可使用的寄存器范围r4-r10，均需要栈保护
+#define ARM32_ALLOC_REG_FIRST 4
+#define ARM32_ALLOC_REG_LAST 10
 
 // 栈寄存器SP和FP
 #define ARM32_SP_REG_NO 13
@@ -47,6 +51,11 @@ public:
     /// @return
     static bool constExpr(int num);
 
+    /// @brief 判断num能否直接编码为数据处理指令的立即数，不考虑取负
+    /// @param num
+    /// @return
+    static bool isImm(int num);
+
     /// @brief 判定是否是合法的偏移
     /// @param num
     /// @return
@@ -37,7 +37,7 @@ int SimpleRegisterAllocator::Allocate(Value * var, int32_t no)
     int32_t regno = -1;
 
     // 尝试指定的寄存器是否可用
-    if ((no != -1) && !regBitmap.test(no)) {
+    if ((no != -1) && !regBitmap.test(no) && !reservedBitmap.test(no)) {
 
         // 可用
         regno = no;
@@ -46,7 +46,7 @@ int SimpleRegisterAllocator::Allocate(Value * var, int32_t no)
         // 查询空闲的寄存器
         for (int k = 0; k < PlatformArm32::maxUsableRegNum; ++k) {
 
-            if (!regBitmap.test(k)) {
+            if (!regBitmap.test(k) && !reservedBitmap.test(k)) {
 
                 // 找到空闲寄存器
                 regno = k;
@@ -147,6 +147,36 @@ void SimpleRegisterAllocator::free(int32_t no)
     }
 }
 
+///
+/// @brief 预留寄存器，被全局寄存器分配占用的寄存器不能再作为临时寄存器分配
+/// @param no 寄存器编号
+///
+void SimpleRegisterAllocator::reserve(int32_t no)
+{
+    if ((no >= 0) && (no < PlatformArm32::maxUsableRegNum)) {
+        reservedBitmap.set(no);
+    }
+}
+
+///
+/// @brief 取消寄存器的预留，可再作为临时寄存器分配
+/// @param no 寄存器编号
+///
+void SimpleRegisterAllocator::unreserve(int32_t no)
+{
+    if ((no >= 0) && (no < PlatformArm32::maxUsableRegNum)) {
+        reservedBitmap.reset(no);
+    }
+}
+
+///
+/// @brief 清除所有的预留寄存器，每个函数处理前需要清除
+///
+void SimpleRegisterAllocator::clearReserved()
+{
+    reservedBitmap = BitMap<PlatformArm32::maxUsableRegNum>();
+}
+
 ///
 /// @brief 寄存器被置位，使用过的寄存器被置位
 /// @param no
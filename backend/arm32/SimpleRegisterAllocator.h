@@ -56,6 +56,23 @@ public:
     ///
     void free(int32_t);
 
+    ///
+    /// @brief 预留寄存器，被全局寄存器分配占用的寄存器不能再作为临时寄存器分配
+    /// @param no 寄存器编号
+    ///
+    void reserve(int32_t no);
+
+    ///
+    /// @brief 取消寄存器的预留，可再作为临时寄存器分配
+    /// @param no 寄存器编号
+    ///
+    void unreserve(int32_t no);
+
+    ///
+    /// @brief 清除所有的预留寄存器，每个函数处理前需要清除
+    ///
+    void clearReserved();
+
 protected:
     ///
     /// @brief 寄存器被置位，使用过的寄存器被置位
@@ -69,6 +86,11 @@ protected:
     ///
     BitMap<PlatformArm32::maxUsableRegNum> regBitmap;
 
+    ///
+    /// @brief 预留寄存器位图：1已被全局寄存器分配占用，不参与临时分配
+    ///
+    BitMap<PlatformArm32::maxUsableRegNum> reservedBitmap;
+
     ///
     /// @brief 寄存器被那个Value占用。按照时间次序加入
     ///
@@ -0,0 +1,371 @@
+///
+/// @file ElfWriter.cpp
+/// @brief ELF32小端可重定位目标文件(.o)的生成的实现
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，ELF32可重定位目标文件的节、符号与重定位的输出
+/// </table>
+///
+#include <algorithm>
+
+#include "ElfWriter.h"
+
+/// @brief ELF文件头的大小
+static const uint32_t elfHeaderSize = 52;
+
+/// @brief 节头的大小
+static const uint32_t sectionHeaderSize = 40;
+
+/// @brief 符号表项的大小
+static const uint32_t symbolEntrySize = 16;
+
+/// @brief REL重定位项的大小
+static const uint32_t relEntrySize = 8;
+
+/// @brief 节的类型：符号表、字符串表、REL重定位
+#define ELF_SHT_SYMTAB 2
+#define ELF_SHT_STRTAB 3
+#define ELF_SHT_REL 9
+
+/// @brief 重定位节的sh_info是节的编号
+#define ELF_SHF_INFO_LINK 0x40
+
+/// @brief 追加小端的16位整数
+static void put16(std::vector<uint8_t> & out, uint32_t value)
+{
+    out.push_back((uint8_t) value);
+    out.push_back((uint8_t) (value >> 8));
+}
+
+/// @brief 追加小端的32位整数
+static void put32(std::vector<uint8_t> & out, uint32_t value)
+{
+    put16(out, value & 0xFFFF);
+    put16(out, value >> 16);
+}
+
+/// @brief 用0填充到指定的对齐
+static void padTo(std::vector<uint8_t> & out, uint32_t align)
+{
+    while (out.size() % align) {
+        out.push_back(0);
+    }
+}
+
+/// @brief 字符串加入字符串表
+/// @return uint32_t 字符串在表内的偏移
+static uint32_t addString(std::string & table, const std::string & str)
+{
+    if (str.empty()) {
+        return 0;
+    }
+
+    uint32_t offset = (uint32_t) table.size();
+    table += str;
+    table += '\0';
+
+    return offset;
+}
+
+///
+/// @brief 构造函数
+/// @param _machine 机器类型，如ELF_EM_ARM
+/// @param _flags 处理器相关的标志
+///
+ElfWriter::ElfWriter(uint16_t _machine, uint32_t _flags) : machine(_machine), flags(_flags)
+{}
+
+///
+/// @brief 添加节
+/// @param name 节名，如.text
+/// @param type 节的类型，NOBITS的节没有内容，只有大小
+/// @param attributes 节的属性
+/// @param align 对齐字节数
+/// @return int32_t 节的编号
+///
+int32_t ElfWriter::addSection(const std::string & name, uint32_t type, uint32_t attributes, uint32_t align)
+{
+    Section section;
+    section.name = name;
+    section.type = type;
+    section.flags = attributes;
+    section.align = align;
+    sections.push_back(section);
+
+    return (int32_t) sections.size();
+}
+
+///
+/// @brief 获取节的内容，用于追加数据
+/// @param section 节的编号
+/// @return std::vector<uint8_t>& 节的内容
+///
+std::vector<uint8_t> & ElfWriter::getContent(int32_t section)
+{
+    return sections[section - 1].content;
+}
+
+///
+/// @brief 节的当前大小按指定字节数对齐，有内容的节用0填充
+/// @param section 节的编号
+/// @param align 对齐字节数
+/// @return uint32_t 对齐后的大小，即下一个数据的偏移
+///
+uint32_t ElfWriter::alignSection(int32_t section, uint32_t align)
+{
+    Section & sec = sections[section - 1];
+
+    if (align > sec.align) {
+        sec.align = align;
+    }
+
+    if (sec.type == ELF_SHT_NOBITS) {
+        sec.size = (sec.size + align - 1) / align * align;
+        return sec.size;
+    }
+
+    padTo(sec.content, align);
+    return (uint32_t) sec.content.size();
+}
+
+///
+/// @brief 扩大NOBITS节的大小
+/// @param section 节的编号
+/// @param size 增加的字节数
+///
+void ElfWriter::growSection(int32_t section, uint32_t size)
+{
+    sections[section - 1].size += size;
+}
+
+///
+/// @brief 查找全局符号，不存在时创建一个未定义的符号
+/// @param name 符号名
+/// @return int32_t 符号的编号
+///
+int32_t ElfWriter::getSymbol(const std::string & name)
+{
+    auto pIter = globalSymbols.find(name);
+    if (pIter != globalSymbols.end()) {
+        return pIter->second;
+    }
+
+    int32_t index = (int32_t) symbols.size();
+    symbols.push_back(Symbol{name, ELF_STB_GLOBAL, ELF_STT_NOTYPE, 0, 0, 0});
+    globalSymbols.emplace(name, index);
+
+    return index;
+}
+
+///
+/// @brief 定义全局符号
+/// @param name 符号名
+/// @param type 符号的类型，如ELF_STT_FUNC
+/// @param section 所在节的编号
+/// @param value 节内偏移
+/// @param size 大小
+/// @return int32_t 符号的编号
+///
+int32_t ElfWriter::defineSymbol(const std::string & name, uint8_t type, int32_t section, uint32_t value, uint32_t size)
+{
+    int32_t index = getSymbol(name);
+
+    Symbol & symbol = symbols[index];
+    symbol.type = type;
+    symbol.section = section;
+    symbol.value = value;
+    symbol.size = size;
+
+    return index;
+}
+
+///
+/// @brief 添加局部符号，如ARM的映射符号$a
+/// @param name 符号名
+/// @param section 所在节的编号
+/// @param value 节内偏移
+///
+void ElfWriter::addLocalSymbol(const std::string & name, int32_t section, uint32_t value)
+{
+    symbols.push_back(Symbol{name, ELF_STB_LOCAL, ELF_STT_NOTYPE, section, value, 0});
+}
+
+///
+/// @brief 添加重定位
+/// @param section 被修改的节的编号
+/// @param offset 被修改的位置
+/// @param symbol 引用的符号编号
+/// @param type 重定位类型
+///
+void ElfWriter::addRelocation(int32_t section, uint32_t offset, int32_t symbol, uint32_t type)
+{
+    relocations.push_back(Relocation{section, offset, symbol, type});
+}
+
+///
+/// @brief 写出目标文件
+///
+/// 文件的布局依次为：文件头、各节内容、重定位节、符号表、字符串表、节名字符串表、节头表。
+///
+/// @param writer 输出
+///
+void ElfWriter::write(AsmWriter & writer)
+{
+    int32_t numSections = (int32_t) sections.size();
+
+    // 符号表中局部符号在前，0号为空符号
+    std::vector<uint32_t> symbolMap(symbols.size());
+    uint32_t numLocals = 1;
+    for (size_t k = 0; k < symbols.size(); ++k) {
+        if (symbols[k].bind == ELF_STB_LOCAL) {
+            symbolMap[k] = numLocals++;
+        }
+    }
+    uint32_t numSymbols = numLocals;
+    for (size_t k = 0; k < symbols.size(); ++k) {
+        if (symbols[k].bind != ELF_STB_LOCAL) {
+            symbolMap[k] = numSymbols++;
+        }
+    }
+
+    // 有重定位的节各自对应一个.rel节，紧跟在普通节之后
+    std::vector<std::vector<uint8_t>> relContents(numSections + 1);
+    for (auto & reloc: relocations) {
+        put32(relContents[reloc.section], reloc.offset);
+        put32(relContents[reloc.section], (symbolMap[reloc.symbol] << 8) | (reloc.type & 0xFF));
+    }
+
+    // 符号表与字符串表
+    std::string strtab(1, '\0');
+    std::vector<uint8_t> symtab(symbolEntrySize, 0);
+    std::vector<const Symbol *> ordered(numSymbols, nullptr);
+    for (size_t k = 0; k < symbols.size(); ++k) {
+        ordered[symbolMap[k]] = &symbols[k];
+    }
+    for (uint32_t k = 1; k < numSymbols; ++k) {
+        const Symbol * symbol = ordered[k];
+        put32(symtab, addString(strtab, symbol->name));
+        put32(symtab, symbol->value);
+        put32(symtab, symbol->size);
+        symtab.push_back((uint8_t) ((symbol->bind << 4) | symbol->type));
+        symtab.push_back(0);
+        put16(symtab, (uint32_t) symbol->section);
+    }
+
+    // 节头的信息，0号为空节
+    struct Header {
+        uint32_t name, type, flags, offset, size, link, info, align, entsize;
+    };
+    std::vector<Header> headers(1, Header{0, 0, 0, 0, 0, 0, 0, 0, 0});
+    std::string shstrtab(1, '\0');
+
+    std::vector<uint8_t> out;
+    out.resize(elfHeaderSize);
+
+    for (auto & section: sections) {
+        padTo(out, section.align);
+        uint32_t offset = (uint32_t) out.size();
+        uint32_t size = section.size;
+        if (section.type != ELF_SHT_NOBITS) {
+            out.insert(out.end(), section.content.begin(), section.content.end());
+            size = (uint32_t) section.content.size();
+        }
+        headers.push_back(
+            Header{addString(shstrtab, section.name), section.type, section.flags, offset, size, 0, 0, section.align, 0});
+    }
+
+    // 符号表的节编号在重定位节之后
+    uint32_t symtabIndex = (uint32_t) numSections + 1;
+    for (int32_t k = 1; k <= numSections; ++k) {
+        if (!relContents[k].empty()) {
+            symtabIndex++;
+        }
+    }
+
+    for (int32_t k = 1; k <= numSections; ++k) {
+        if (relContents[k].empty()) {
+            continue;
+        }
+        padTo(out, 4);
+        uint32_t offset = (uint32_t) out.size();
+        out.insert(out.end(), relContents[k].begin(), relContents[k].end());
+        headers.push_back(Header{addString(shstrtab, ".rel" + sections[k - 1].name),
+                                 ELF_SHT_REL,
+                                 ELF_SHF_INFO_LINK,
+                                 offset,
+                                 (uint32_t) relContents[k].size(),
+                                 symtabIndex,
+                                 (uint32_t) k,
+                                 4,
+                                 relEntrySize});
+    }
+
+    padTo(out, 4);
+    headers.push_back(Header{addString(shstrtab, ".symtab"),
+                             ELF_SHT_SYMTAB,
+                             0,
+                             (uint32_t) out.size(),
+                             (uint32_t) symtab.size(),
+                             symtabIndex + 1,
+                             numLocals,
+                             4,
+                             symbolEntrySize});
+    out.insert(out.end(), symtab.begin(), symtab.end());
+
+    headers.push_back(Header{addString(shstrtab, ".strtab"),
+                             ELF_SHT_STRTAB,
+                             0,
+                             (uint32_t) out.size(),
+                             (uint32_t) strtab.size(),
+                             0,
+                             0,
+                             1,
+                             0});
+    out.insert(out.end(), strtab.begin(), strtab.end());
+
+    uint32_t shstrtabName = addString(shstrtab, ".shstrtab");
+    headers.push_back(
+        Header{shstrtabName, ELF_SHT_STRTAB, 0, (uint32_t) out.size(), (uint32_t) shstrtab.size(), 0, 0, 1, 0});
+    out.insert(out.end(), shstrtab.begin(), shstrtab.end());
+
+    padTo(out, 4);
+    uint32_t sectionHeaderOffset = (uint32_t) out.size();
+    for (auto & header: headers) {
+        put32(out, header.name);
+        put32(out, header.type);
+        put32(out, header.flags);
+        put32(out, 0);
+        put32(out, header.offset);
+        put32(out, header.size);
+        put32(out, header.link);
+        put32(out, header.info);
+        put32(out, header.align);
+        put32(out, header.entsize);
+    }
+
+    // 文件头：32位、小端、当前版本、可重定位文件
+    std::vector<uint8_t> header = {0x7F, 'E', 'L', 'F', 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    put16(header, 1);
+    put16(header, machine);
+    put32(header, 1);
+    put32(header, 0);
+    put32(header, 0);
+    put32(header, sectionHeaderOffset);
+    put32(header, flags);
+    put16(header, elfHeaderSize);
+    put16(header, 0);
+    put16(header, 0);
+    put16(header, sectionHeaderSize);
+    put16(header, (uint32_t) headers.size());
+    put16(header, (uint32_t) headers.size() - 1);
+    std::copy(header.begin(), header.end(), out.begin());
+
+    writer.write(reinterpret_cast<const char *>(out.data()), out.size());
+}
@@ -0,0 +1,192 @@
+///
+/// @file ElfWriter.h
+/// @brief ELF32小端可重定位目标文件(.o)的生成
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，ELF32可重定位目标文件的节、符号与重定位的输出
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "AsmWriter.h"
+
+/// @brief ELF的机器类型ARM
+#define ELF_EM_ARM 40
+
+/// @brief ARM的EABI版本5
+#define ELF_EF_ARM_EABI_VER5 0x05000000
+
+/// @brief 节的类型
+#define ELF_SHT_PROGBITS 1
+#define ELF_SHT_NOBITS 8
+
+/// @brief 节的属性：可写、占用内存、可执行
+#define ELF_SHF_WRITE 0x1
+#define ELF_SHF_ALLOC 0x2
+#define ELF_SHF_EXECINSTR 0x4
+
+/// @brief 符号的绑定
+#define ELF_STB_LOCAL 0
+#define ELF_STB_GLOBAL 1
+
+/// @brief 符号的类型
+#define ELF_STT_NOTYPE 0
+#define ELF_STT_OBJECT 1
+#define ELF_STT_FUNC 2
+
+/// @brief ARM的重定位类型，REL格式，加数保存在指令中
+#define ELF_R_ARM_CALL 28
+#define ELF_R_ARM_JUMP24 29
+#define ELF_R_ARM_MOVW_ABS_NC 43
+#define ELF_R_ARM_MOVT_ABS 44
+
+///
+/// @brief ELF32小端可重定位目标文件的生成
+///
+/// 调用者添加节、符号与重定位，最后一次性写出。符号可以先引用后定义，
+/// 写出时仍未定义的符号作为外部符号。局部符号在写出时自动排在全局符号之前。
+///
+class ElfWriter {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _machine 机器类型，如ELF_EM_ARM
+    /// @param _flags 处理器相关的标志
+    ///
+    ElfWriter(uint16_t _machine, uint32_t _flags);
+
+    ///
+    /// @brief 添加节
+    /// @param name 节名，如.text
+    /// @param type 节的类型，NOBITS的节没有内容，只有大小
+    /// @param attributes 节的属性
+    /// @param align 对齐字节数
+    /// @return int32_t 节的编号
+    ///
+    int32_t addSection(const std::string & name, uint32_t type, uint32_t attributes, uint32_t align);
+
+    ///
+    /// @brief 获取节的内容，用于追加数据
+    /// @param section 节的编号
+    /// @return std::vector<uint8_t>& 节的内容
+    ///
+    std::vector<uint8_t> & getContent(int32_t section);
+
+    ///
+    /// @brief 节的当前大小按指定字节数对齐，有内容的节用0填充
+    /// @param section 节的编号
+    /// @param align 对齐字节数
+    /// @return uint32_t 对齐后的大小，即下一个数据的偏移
+    ///
+    uint32_t alignSection(int32_t section, uint32_t align);
+
+    ///
+    /// @brief 扩大NOBITS节的大小
+    /// @param section 节的编号
+    /// @param size 增加的字节数
+    ///
+    void growSection(int32_t section, uint32_t size);
+
+    ///
+    /// @brief 查找全局符号，不存在时创建一个未定义的符号
+    /// @param name 符号名
+    /// @return int32_t 符号的编号
+    ///
+    int32_t getSymbol(const std::string & name);
+
+    ///
+    /// @brief 定义全局符号
+    /// @param name 符号名
+    /// @param type 符号的类型，如ELF_STT_FUNC
+    /// @param section 所在节的编号
+    /// @param value 节内偏移
+    /// @param size 大小
+    /// @return int32_t 符号的编号
+    ///
+    int32_t defineSymbol(const std::string & name, uint8_t type, int32_t section, uint32_t value, uint32_t size);
+
+    ///
+    /// @brief 添加局部符号，如ARM的映射符号$a
+    /// @param name 符号名
+    /// @param section 所在节的编号
+    /// @param value 节内偏移
+    ///
+    void addLocalSymbol(const std::string & name, int32_t section, uint32_t value);
+
+    ///
+    /// @brief 添加重定位
+    /// @param section 被修改的节的编号
+    /// @param offset 被修改的位置
+    /// @param symbol 引用的符号编号
+    /// @param type 重定位类型
+    ///
+    void addRelocation(int32_t section, uint32_t offset, int32_t symbol, uint32_t type);
+
+    ///
+    /// @brief 写出目标文件
+    /// @param writer 输出
+    ///
+    void write(AsmWriter & writer);
+
+private:
+    /// @brief 节
+    struct Section {
+        std::string name;
+        uint32_t type;
+        uint32_t flags;
+        uint32_t align;
+        /// @brief NOBITS节的大小
+        uint32_t size = 0;
+        /// @brief 节的内容
+        std::vector<uint8_t> content;
+    };
+
+    /// @brief 符号，section为0时表示未定义
+    struct Symbol {
+        std::string name;
+        uint8_t bind;
+        uint8_t type;
+        int32_t section;
+        uint32_t value;
+        uint32_t size;
+    };
+
+    /// @brief 重定位
+    struct Relocation {
+        int32_t section;
+        uint32_t offset;
+        int32_t symbol;
+        uint32_t type;
+    };
+
+    /// @brief 机器类型
+    uint16_t machine;
+
+    /// @brief 处理器相关的标志
+    uint32_t flags;
+
+    /// @brief 节，编号从1开始，0号是ELF规定的空节
+    std::vector<Section> sections;
+
+    /// @brief 符号
+    std::vector<Symbol> symbols;
+
+    /// @brief 全局符号名到编号的映射
+    std::unordered_map<std::string, int32_t> globalSymbols;
+
+    /// @brief 重定位
+    std::vector<Relocation> relocations;
+};
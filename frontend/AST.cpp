@@ -12,11 +12,18 @@
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// <tr><td>2024-11-23 <td>1.1     <td>zenglj  <td>表达式版增强
+/// <tr><td>2026-10-15 <td>1.2     <td>agent   <td>AST节点改为区域分配
+/// <tr><td>2026-10-15 <td>1.3     <td>agent   <td>AST节点紧凑布局，名字改为编号
 /// </table>
 ///
 #include <cstdarg>
 #include <cstdint>
+#include <cstring>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "AST.h"
 #include "AttrType.h"
@@ -26,11 +33,77 @@
 /* 整个AST的根节点 */
 ast_node * ast_root = nullptr;
 
+/* AST的区域，所有的节点、孩子列表以及名字都在其中分配，free_ast时整体释放 */
+static Arena ast_arena;
+
+/* 已创建的节点个数，用于分配节点编号 */
+static uint32_t ast_node_count = 0;
+
+/* 名字表，下标为名字的编号，编号0为空名字 */
+static std::vector<const char *> ast_names{""};
+
+/* 名字到编号的映射，名字存放在AST的区域中 */
+static std::unordered_map<std::string_view, uint32_t> ast_name_ids;
+
+/// @brief 名字加入名字表，相同的名字只保存一份
+/// @param str 名字
+/// @param len 名字的长度
+/// @return 名字的编号
+static uint32_t intern_ast_name(const char * str, size_t len)
+{
+    if (len == 0) {
+        return 0;
+    }
+
+    auto pIter = ast_name_ids.find(std::string_view(str, len));
+    if (pIter != ast_name_ids.end()) {
+        return pIter->second;
+    }
+
+    const char * name = ast_arena.copyString(str, len);
+    uint32_t id = (uint32_t) ast_names.size();
+    ast_names.push_back(name);
+    ast_name_ids.emplace(std::string_view(name, len), id);
+
+    return id;
+}
+
+/// @brief 在AST的区域中创建节点
+/// @param args 构造函数的参数
+/// @return 创建的节点
+template <typename... Args>
+static ast_node * new_ast_node(Args &&... args)
+{
+    return ast_arena.create<ast_node>(std::forward<Args>(args)...);
+}
+
+/// @brief 在尾部追加孩子
+/// @param arena 孩子列表所在的区域
+/// @param node 孩子节点
+void ast_node_list::push_back(Arena & arena, ast_node * node)
+{
+    if (count == capacity) {
+
+        // 大部分内部节点的孩子不超过4个
+        uint32_t newCapacity = capacity ? capacity * 2 : 4;
+
+        auto newItems = static_cast<ast_node **>(arena.allocate(newCapacity * sizeof(ast_node *), alignof(ast_node *)));
+        if (count) {
+            std::memcpy(newItems, items, count * sizeof(ast_node *));
+        }
+
+        items = newItems;
+        capacity = newCapacity;
+    }
+
+    items[count++] = node;
+}
+
 /// @brief 创建指定节点类型的节点
 /// @param _node_type 节点类型
 /// @param _line_no 行号
 ast_node::ast_node(ast_operator_type _node_type, Type * _type, int64_t _line_no)
-    : node_type(_node_type), line_no(-1), type(_type)
+    : node_type(_node_type), id(ast_node_count++), line_no((int32_t) _line_no), type(_type)
 {}
 
 /// @brief 构造函数
@@ -51,7 +124,7 @@ ast_node::ast_node(digit_int_attr attr)
 /// @param attr 字符型字面量
 ast_node::ast_node(var_id_attr attr) : ast_node(ast_operator_type::AST_OP_LEAF_VAR_ID, VoidType::getType(), attr.lineno)
 {
-    name = attr.id;
+    name_id = intern_ast_name(attr.id, strlen(attr.id));
 }
 
 /// @brief 针对标识符ID的叶子构造函数
@@ -60,7 +133,7 @@ ast_node::ast_node(var_id_attr attr) : ast_node(ast_operator_type::AST_OP_LEAF_V
 ast_node::ast_node(std::string _id, int64_t _line_no)
     : ast_node(ast_operator_type::AST_OP_LEAF_VAR_ID, VoidType::getType(), _line_no)
 {
-    name = _id;
+    name_id = intern_ast_name(_id.c_str(), _id.size());
 }
 
 /// @brief 判断是否是叶子节点
@@ -84,6 +157,13 @@ bool ast_node::isLeafNode()
     return is_leaf;
 }
 
+/// @brief 获取变量名或者函数名
+/// @return 名字，没有名字时为空串
+const char * ast_node::getName() const
+{
+    return ast_names[name_id];
+}
+
 /// @brief 创建指定节点类型的节点，请注意在指定有效的孩子后必须追加一个空指针nullptr，表明可变参数结束
 /// @param type 节点类型
 /// @param son_num 孩子节点的个数
@@ -92,7 +172,7 @@ bool ast_node::isLeafNode()
 /// @return 创建的节点
 ast_node * ast_node::New(ast_operator_type type, ...)
 {
-    ast_node * parent_node = new ast_node(type);
+    ast_node * parent_node = new_ast_node(type);
 
     va_list valist;
 
@@ -125,8 +205,7 @@ ast_node * ast_node::insert_son_node(ast_node * node)
     if (node) {
 
         // 孩子节点有效时加入，主要为了避免空语句等时会返回空指针
-        node->parent = this;
-        this->sons.push_back(node);
+        this->sons.push_back(ast_arena, node);
     }
 
     return this;
@@ -136,7 +215,7 @@ ast_node * ast_node::insert_son_node(ast_node * node)
 /// @param attr 无符号整数字面量
 ast_node * ast_node::New(digit_int_attr attr)
 {
-    ast_node * node = new ast_node(attr);
+    ast_node * node = new_ast_node(attr);
 
     return node;
 }
@@ -145,7 +224,7 @@ ast_node * ast_node::New(digit_int_attr attr)
 /// @param attr 字符型字面量
 ast_node * ast_node::New(var_id_attr attr)
 {
-    ast_node * node = new ast_node(attr);
+    ast_node * node = new_ast_node(attr);
 
     return node;
 }
@@ -155,7 +234,7 @@ ast_node * ast_node::New(var_id_attr attr)
 /// @param line_no 行号
 ast_node * ast_node::New(std::string id, int64_t lineno)
 {
-    ast_node * node = new ast_node(id, lineno);
+    ast_node * node = new_ast_node(id, lineno);
 
     return node;
 }
@@ -166,35 +245,31 @@ ast_node * ast_node::New(std::string id, int64_t lineno)
 /// @return 创建的节点
 ast_node * ast_node::New(Type * type)
 {
-    ast_node * node = new ast_node(type);
+    ast_node * node = new_ast_node(type);
 
     return node;
 }
 
-/// @brief 递归清理抽象语法树
-/// @param node AST的节点
-void ast_node::Delete(ast_node * node)
+///
+/// @brief AST资源清理，节点都可平凡析构，不需要遍历，直接释放AST的区域
+/// @param root AST的根节点
+///
+void free_ast(ast_node * root)
 {
-    if (node) {
+    (void) root;
 
-        for (auto child: node->sons) {
-            ast_node::Delete(child);
-        }
-
-        // 这里没有必要清理孩子，由于下面就要删除该节点
-        // node->sons.clear();
-    }
-
-    // 清理node资源
-    delete node;
+    ast_arena.reset();
+    ast_node_count = 0;
+    ast_names.resize(1);
+    ast_name_ids.clear();
+    ast_root = nullptr;
 }
 
-///
-/// @brief AST资源清理
-///
-void free_ast(ast_node * root)
+/// @brief 获取已创建的AST节点个数，节点编号都小于该值
+/// @return 节点个数
+uint32_t get_ast_node_count()
 {
-    ast_node::Delete(root);
+    return ast_node_count;
 }
 
 /// @brief 创建函数定义类型的内部AST节点
@@ -205,19 +280,19 @@ void free_ast(ast_node * root)
 /// @return 创建的节点
 ast_node * create_func_def(ast_node * type_node, ast_node * name_node, ast_node * block_node, ast_node * params_node)
 {
-    ast_node * node = new ast_node(ast_operator_type::AST_OP_FUNC_DEF, type_node->type, name_node->line_no);
+    ast_node * node = new_ast_node(ast_operator_type::AST_OP_FUNC_DEF, type_node->type, name_node->line_no);
 
     // 设置函数名
-    node->name = name_node->name;
+    node->name_id = name_node->name_id;
 
     // 如果没有参数，则创建参数节点
     if (!params_node) {
-        params_node = new ast_node(ast_operator_type::AST_OP_FUNC_FORMAL_PARAMS);
+        params_node = new_ast_node(ast_operator_type::AST_OP_FUNC_FORMAL_PARAMS);
     }
 
     // 如果没有函数体，则创建函数体，也就是语句块
     if (!block_node) {
-        block_node = new ast_node(ast_operator_type::AST_OP_BLOCK);
+        block_node = new_ast_node(ast_operator_type::AST_OP_BLOCK);
     }
 
     (void) node->insert_son_node(type_node);
@@ -260,7 +335,7 @@ ast_node * create_contain_node(ast_operator_type node_type,
                                ast_node * second_child,
                                ast_node * third_child)
 {
-    ast_node * node = new ast_node(node_type);
+    ast_node * node = new_ast_node(node_type);
 
     if (first_child) {
         (void) node->insert_son_node(first_child);
@@ -304,14 +379,14 @@ ast_node * create_type_node(type_attr & attr)
 /// @return 创建的节点
 ast_node * create_func_call(ast_node * funcname_node, ast_node * params_node)
 {
-    ast_node * node = new ast_node(ast_operator_type::AST_OP_FUNC_CALL);
+    ast_node * node = new_ast_node(ast_operator_type::AST_OP_FUNC_CALL);
 
     // 设置调用函数名
-    node->name = funcname_node->name;
+    node->name_id = funcname_node->name_id;
 
     // 如果没有参数，则创建参数节点
     if (!params_node) {
-        params_node = new ast_node(ast_operator_type::AST_OP_FUNC_REAL_PARAMS);
+        params_node = new_ast_node(ast_operator_type::AST_OP_FUNC_REAL_PARAMS);
     }
 
     (void) node->insert_son_node(funcname_node);
@@ -12,6 +12,8 @@
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// <tr><td>2024-11-23 <td>1.1     <td>zenglj  <td>表达式版增强
+/// <tr><td>2026-10-15 <td>1.2     <td>agent   <td>AST节点改为区域分配
+/// <tr><td>2026-10-15 <td>1.3     <td>agent   <td>AST节点紧凑布局，名字改为编号
 /// </table>
 ///
 #pragma once
@@ -19,17 +21,15 @@
 #include <cstdint>
 #include <cstdio>
 #include <string>
-#include <vector>
 
+#include "Arena.h"
 #include "AttrType.h"
-#include "IRCode.h"
-#include "Value.h"
 #include "VoidType.h"
 
 ///
 /// @brief AST节点的类型。C++专门因为枚举类来区分C语言的结构体
 ///
-enum class ast_operator_type : int {
+enum class ast_operator_type : uint8_t {
 
     /* 以下为AST的叶子节点 */
 
@@ -118,53 +118,98 @@ enum class ast_operator_type : int {
     AST_OP_MAX,
 };
 
+class ast_node;
+
 ///
-/// @brief 抽象语法树AST的节点描述类
+/// @brief AST节点的孩子列表，存放在AST的区域中
 ///
-class ast_node {
+/// 容量不够时在区域中重新分配两倍的空间，旧的空间随区域一起释放。
+///
+class ast_node_list {
 public:
-    /// @brief 分支语句的真标签
-    std::string true_label;
+    /// @brief 第一个孩子的位置
+    ast_node ** begin() const
+    {
+        return items;
+    }
+
+    /// @brief 最后一个孩子之后的位置
+    ast_node ** end() const
+    {
+        return items + count;
+    }
+
+    /// @brief 孩子的个数
+    size_t size() const
+    {
+        return count;
+    }
+
+    /// @brief 是否没有孩子
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    /// @brief 获取第pos个孩子
+    ast_node * operator[](size_t pos) const
+    {
+        return items[pos];
+    }
 
-    /// @brief 分支语句的假标签
-    std::string false_label;
+    ///
+    /// @brief 在尾部追加孩子
+    /// @param arena 孩子列表所在的区域
+    /// @param node 孩子节点
+    ///
+    void push_back(Arena & arena, ast_node * node);
 
-    /// @brief 分支语句的结束标签
-    std::string end_label;
-    /// @brief 节点类型
-    ast_operator_type node_type;
+private:
+    /// @brief 孩子数组
+    ast_node ** items = nullptr;
 
-    /// @brief 行号信息，主要针对叶子节点有用
-    int64_t line_no;
+    /// @brief 孩子的个数
+    uint32_t count = 0;
 
-    /// @brief 节点值的类型，可用于函数返回值类型
-    Type * type;
+    /// @brief 孩子数组的容量
+    uint32_t capacity = 0;
+};
 
-    /// @brief 无符号整数字面量值
-    uint32_t integer_val;
+///
+/// @brief 抽象语法树AST的节点描述类
+///
+/// 节点都在AST的区域中分配，成员必须可平凡析构。为了减少每个节点占用的内存，名字以在名字表中的编号保存，
+/// 字面量的值放在联合体中。线性IR产生过程中的指令块、Value等信息不放在节点中，
+/// 由IRGenerator以节点编号为下标另行保存。
+///
+class ast_node {
+public:
+    /// @brief 节点类型
+    ast_operator_type node_type;
 
-    /// @brief float类型字面量值
-    float float_val;
+    /// @brief 节点编号，按创建的次序从0开始，可作为旁路表的下标
+    uint32_t id;
 
-    /// @brief 变量名，或者函数名
-    std::string name;
+    /// @brief 行号信息，主要针对叶子节点有用
+    int32_t line_no;
 
-    /// @brief 父节点
-    ast_node * parent = nullptr;
+    /// @brief 变量名或者函数名在名字表中的编号，0为空名字
+    uint32_t name_id = 0;
 
-    /// @brief 孩子节点
-    std::vector<ast_node *> sons;
+    /// @brief 字面量的值
+    union {
+        /// @brief 无符号整数字面量值
+        uint32_t integer_val = 0;
 
-    /// @brief 线性IR指令块，可包含多条IR指令，用于线性IR指令产生用
-    InterCode blockInsts;
+        /// @brief float类型字面量值
+        float float_val;
+    };
 
-    /// @brief 线性IR指令或者运行产生的Value，用于线性IR指令产生用
-    Value * val = nullptr;
+    /// @brief 节点值的类型，可用于函数返回值类型
+    Type * type;
 
-    ///
-    /// @brief 在进入block等节点时是否要进行作用域管理。默认要做。
-    ///
-    bool needScope = true;
+    /// @brief 孩子节点
+    ast_node_list sons;
 
     /// @brief 创建指定节点类型的节点
     /// @param _node_type 节点类型
@@ -192,6 +237,10 @@ public:
     /// @return true：是叶子节点 false：内部节点
     bool isLeafNode();
 
+    /// @brief 获取变量名或者函数名
+    /// @return 名字，没有名字时为空串
+    const char * getName() const;
+
     /// @brief 向父节点插入一个节点
     /// @param parent 父节点
     /// @param node 节点
@@ -223,20 +272,19 @@ public:
     /// @param line_no 行号
     /// @return 创建的节点
     static ast_node * New(Type * type);
-
-    ///
-    /// @brief 释放节点
-    /// @param node
-    ///
-    static void Delete(ast_node * node);
 };
 
-/// @brief AST资源清理
+/// @brief AST资源清理，所有的节点随AST的区域一起释放
+/// @param root AST的根节点
 void free_ast(ast_node * root);
 
 /// @brief抽象语法树的根节点指针
 extern ast_node * ast_root;
 
+/// @brief 获取已创建的AST节点个数，节点编号都小于该值
+/// @return 节点个数
+uint32_t get_ast_node_count();
+
 /// @brief 创建AST的内部节点，请注意可追加孩子节点，请按次序依次加入，最多3个
 /// @param node_type 节点类型
 /// @param first_child 第一个孩子节点
@@ -40,7 +40,7 @@ string getNodeName(ast_node * astnode)
             nodeName = to_string(astnode->float_val);
             break;
         case ast_operator_type::AST_OP_LEAF_VAR_ID:
-            nodeName = astnode->name;
+            nodeName = astnode->getName();
             break;
         case ast_operator_type::AST_OP_LEAF_TYPE:
             nodeName = astnode->type->toString();
@@ -195,8 +195,8 @@ Agnode_t * genInternalGraphNode(Agraph_t * g, ast_node * astnode)
     // }
 
     // 遍历AST内部结点的孩子，获取创建孩子的图形结点，递归
-    // 这里用到了C++向量的容器遍历方法之一，从头开始到尾部
-    std::vector<ast_node *>::iterator pIter;
+    // 孩子列表支持指针形式的迭代，从头开始到尾部
+    ast_node ** pIter;
     for (pIter = astnode->sons.begin(); pIter != astnode->sons.end(); ++pIter) {
 
         Agnode_t * son_node = graph_visit_ast_node(g, *pIter);
@@ -0,0 +1,104 @@
+///
+/// @file BasicBlock.cpp
+/// @brief 基本块，控制流图的结点
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，控制流图的基本块
+/// </table>
+///
+#include "BasicBlock.h"
+
+///
+/// @brief 构造函数
+/// @param _index 基本块在线性IR中的次序编号
+///
+BasicBlock::BasicBlock(int32_t _index) : index(_index)
+{}
+
+///
+/// @brief 获取基本块在线性IR中的次序编号
+/// @return int32_t 编号，入口基本块为0
+///
+int32_t BasicBlock::getIndex() const
+{
+    return index;
+}
+
+///
+/// @brief 获取基本块在逆后序中的编号
+/// @return int32_t 编号，从入口不可达的基本块为-1
+///
+int32_t BasicBlock::getRPONumber() const
+{
+    return rpoNumber;
+}
+
+///
+/// @brief 获取基本块内的指令
+/// @return std::vector<Instruction *>& 指令序列
+///
+std::vector<Instruction *> & BasicBlock::getInsts()
+{
+    return insts;
+}
+
+///
+/// @brief 获取基本块开始的Label指令
+/// @return Instruction* Label指令，不以Label开始时返回nullptr
+///
+Instruction * BasicBlock::getLabel() const
+{
+    if (!insts.empty() && (insts.front()->getOp() == IRInstOperator::IRINST_OP_LABEL)) {
+        return insts.front();
+    }
+
+    return nullptr;
+}
+
+///
+/// @brief 获取基本块的最后一条指令
+/// @return Instruction* 最后一条指令，可能是跳转指令，也可能是顺序执行到下一基本块的指令
+///
+Instruction * BasicBlock::getTerminator() const
+{
+    return insts.empty() ? nullptr : insts.back();
+}
+
+///
+/// @brief 获取前驱基本块
+/// @return std::vector<BasicBlock *>& 前驱列表
+///
+std::vector<BasicBlock *> & BasicBlock::getPreds()
+{
+    return preds;
+}
+
+///
+/// @brief 获取后继基本块，条件跳转时第一个为跳转目标
+/// @return std::vector<BasicBlock *>& 后继列表
+///
+std::vector<BasicBlock *> & BasicBlock::getSuccs()
+{
+    return succs;
+}
+
+///
+/// @brief 基本块的名字，用于调试输出，有Label时为Label的名字
+/// @return std::string 名字
+///
+std::string BasicBlock::getName() const
+{
+    Instruction * label = getLabel();
+    if (label && !label->getIRName().empty()) {
+        return label->getIRName();
+    }
+
+    return "bb" + std::to_string(index);
+}
@@ -0,0 +1,111 @@
+///
+/// @file BasicBlock.h
+/// @brief 基本块，控制流图的结点
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，控制流图的基本块
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Instruction.h"
+
+///
+/// @brief 基本块，由线性IR中连续的若干条指令组成，只能从第一条指令进入，从最后一条指令离开
+///
+class BasicBlock {
+
+    friend class ControlFlowGraph;
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _index 基本块在线性IR中的次序编号
+    ///
+    explicit BasicBlock(int32_t _index);
+
+    ///
+    /// @brief 获取基本块在线性IR中的次序编号
+    /// @return int32_t 编号，入口基本块为0
+    ///
+    [[nodiscard]] int32_t getIndex() const;
+
+    ///
+    /// @brief 获取基本块在逆后序中的编号
+    /// @return int32_t 编号，从入口不可达的基本块为-1
+    ///
+    [[nodiscard]] int32_t getRPONumber() const;
+
+    ///
+    /// @brief 获取基本块内的指令
+    /// @return std::vector<Instruction *>& 指令序列
+    ///
+    std::vector<Instruction *> & getInsts();
+
+    ///
+    /// @brief 获取基本块开始的Label指令
+    /// @return Instruction* Label指令，不以Label开始时返回nullptr
+    ///
+    [[nodiscard]] Instruction * getLabel() const;
+
+    ///
+    /// @brief 获取基本块的最后一条指令
+    /// @return Instruction* 最后一条指令，可能是跳转指令，也可能是顺序执行到下一基本块的指令
+    ///
+    [[nodiscard]] Instruction * getTerminator() const;
+
+    ///
+    /// @brief 获取前驱基本块
+    /// @return std::vector<BasicBlock *>& 前驱列表
+    ///
+    std::vector<BasicBlock *> & getPreds();
+
+    ///
+    /// @brief 获取后继基本块，条件跳转时第一个为跳转目标
+    /// @return std::vector<BasicBlock *>& 后继列表
+    ///
+    std::vector<BasicBlock *> & getSuccs();
+
+    ///
+    /// @brief 基本块的名字，用于调试输出，有Label时为Label的名字
+    /// @return std::string 名字
+    ///
+    [[nodiscard]] std::string getName() const;
+
+private:
+    ///
+    /// @brief 线性IR中的次序编号
+    ///
+    int32_t index;
+
+    ///
+    /// @brief 逆后序编号
+    ///
+    int32_t rpoNumber = -1;
+
+    ///
+    /// @brief 基本块内的指令
+    ///
+    std::vector<Instruction *> insts;
+
+    ///
+    /// @brief 前驱基本块
+    ///
+    std::vector<BasicBlock *> preds;
+
+    ///
+    /// @brief 后继基本块
+    ///
+    std::vector<BasicBlock *> succs;
+};
@@ -0,0 +1,254 @@
+///
+/// @file ControlFlowGraph.cpp
+/// @brief 函数的控制流图
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，函数按需构建的控制流图
+/// </table>
+///
+#include <algorithm>
+#include <utility>
+
+#include "ControlFlowGraph.h"
+#include "Function.h"
+#include "GotoInstruction.h"
+#include "BranchInstruction.h"
+
+///
+/// @brief 构造函数，根据函数的线性IR构建控制流图
+/// @param _func 所属函数
+///
+ControlFlowGraph::ControlFlowGraph(Function * _func) : func(_func)
+{
+    buildBlocks();
+    buildEdges();
+    computeReversePostOrder();
+}
+
+///
+/// @brief 析构函数，释放基本块
+///
+ControlFlowGraph::~ControlFlowGraph()
+{
+    for (auto block: blocks) {
+        delete block;
+    }
+}
+
+///
+/// @brief 获取所有的基本块，按照线性IR中的先后次序
+/// @return std::vector<BasicBlock *>& 基本块列表
+///
+std::vector<BasicBlock *> & ControlFlowGraph::getBlocks()
+{
+    return blocks;
+}
+
+///
+/// @brief 获取入口基本块
+/// @return BasicBlock* 入口基本块，函数没有指令时为nullptr
+///
+BasicBlock * ControlFlowGraph::getEntry()
+{
+    return blocks.empty() ? nullptr : blocks.front();
+}
+
+///
+/// @brief 获取出口基本块，即exit指令所在的基本块
+/// @return BasicBlock* 出口基本块，没有exit指令时为nullptr
+///
+BasicBlock * ControlFlowGraph::getExit()
+{
+    return exitBlock;
+}
+
+///
+/// @brief 获取逆后序的基本块列表，只包含从入口可达的基本块
+/// @return std::vector<BasicBlock *>& 逆后序基本块列表
+///
+std::vector<BasicBlock *> & ControlFlowGraph::getReversePostOrder()
+{
+    return rpo;
+}
+
+///
+/// @brief 获取指令所在的基本块
+/// @param inst 指令，可以是Label指令
+/// @return BasicBlock* 基本块，指令不在函数内时为nullptr
+///
+BasicBlock * ControlFlowGraph::getBlock(Instruction * inst)
+{
+    auto pIter = instBlock.find(inst);
+    if (pIter == instBlock.end()) {
+        return nullptr;
+    }
+
+    return pIter->second;
+}
+
+///
+/// @brief 构建时线性IR的修改计数，用于检查控制流图是否过期
+/// @return uint32_t 修改计数
+///
+uint32_t ControlFlowGraph::getModCount() const
+{
+    return modCount;
+}
+
+///
+/// @brief 按Label与跳转指令划分基本块
+///
+void ControlFlowGraph::buildBlocks()
+{
+    InterCode & insts = func->getInterCode();
+
+    modCount = insts.getModCount();
+
+    bool leader = true;
+    for (auto inst: insts) {
+
+        // Label指令以及跳转指令的下一条指令是基本块的入口
+        if (leader || (inst->getOp() == IRInstOperator::IRINST_OP_LABEL)) {
+            blocks.push_back(new BasicBlock((int32_t) blocks.size()));
+        }
+
+        BasicBlock * block = blocks.back();
+        block->insts.push_back(inst);
+        instBlock[inst] = block;
+
+        switch (inst->getOp()) {
+            case IRInstOperator::IRINST_OP_GOTO:
+            case IRInstOperator::IRINST_OP_BC:
+            case IRInstOperator::IRINST_OP_BT:
+            case IRInstOperator::IRINST_OP_BF:
+                leader = true;
+                break;
+            case IRInstOperator::IRINST_OP_EXIT:
+                exitBlock = block;
+                leader = true;
+                break;
+            default:
+                leader = false;
+                break;
+        }
+    }
+}
+
+///
+/// @brief 根据基本块的最后一条指令建立前驱与后继关系
+///
+void ControlFlowGraph::buildEdges()
+{
+    auto addEdge = [&](BasicBlock * from, Instruction * target) {
+        // 跳转目标不在本函数内时忽略
+        BasicBlock * to = getBlock(target);
+        if (to && (std::find(from->succs.begin(), from->succs.end(), to) == from->succs.end())) {
+            from->succs.push_back(to);
+            to->preds.push_back(from);
+        }
+    };
+
+    for (auto block: blocks) {
+
+        Instruction * lastInst = block->getTerminator();
+        bool fallThrough = true;
+
+        switch (lastInst->getOp()) {
+            case IRInstOperator::IRINST_OP_GOTO:
+                addEdge(block, static_cast<GotoInstruction *>(lastInst)->getTarget());
+                fallThrough = false;
+                break;
+            case IRInstOperator::IRINST_OP_BC:
+                addEdge(block, static_cast<BranchInstruction *>(lastInst)->getTrueTarget());
+                addEdge(block, static_cast<BranchInstruction *>(lastInst)->getFalseTarget());
+                fallThrough = false;
+                break;
+            case IRInstOperator::IRINST_OP_BT:
+            case IRInstOperator::IRINST_OP_BF:
+                addEdge(block, static_cast<BranchInstruction *>(lastInst)->getTarget());
+                break;
+            case IRInstOperator::IRINST_OP_EXIT:
+                fallThrough = false;
+                break;
+            default:
+                break;
+        }
+
+        // 顺序执行到下一个基本块
+        if (fallThrough && (block->index + 1 < (int32_t) blocks.size())) {
+            addEdge(block, blocks[block->index + 1]->insts.front());
+        }
+    }
+}
+
+///
+/// @brief 从入口进行深度优先遍历，计算逆后序
+///
+void ControlFlowGraph::computeReversePostOrder()
+{
+    if (blocks.empty()) {
+        return;
+    }
+
+    std::vector<bool> visited(blocks.size(), false);
+
+    // 非递归的深度优先遍历，栈中记录基本块以及下一个要访问的后继序号
+    std::vector<std::pair<BasicBlock *, size_t>> stack;
+    stack.emplace_back(blocks.front(), 0);
+    visited[0] = true;
+
+    while (!stack.empty()) {
+
+        BasicBlock * block = stack.back().first;
+        size_t & next = stack.back().second;
+
+        if (next < block->succs.size()) {
+            BasicBlock * succ = block->succs[next++];
+            if (!visited[succ->index]) {
+                visited[succ->index] = true;
+                stack.emplace_back(succ, 0);
+            }
+        } else {
+            // 所有后继访问完毕，加入后序
+            rpo.push_back(block);
+            stack.pop_back();
+        }
+    }
+
+    std::reverse(rpo.begin(), rpo.end());
+
+    for (int32_t k = 0; k < (int32_t) rpo.size(); ++k) {
+        rpo[k]->rpoNumber = k;
+    }
+}
+
+///
+/// @brief 控制流图转换成字符串，用于调试输出
+/// @param str 字符串
+///
+void ControlFlowGraph::toString(std::string & str)
+{
+    for (auto block: blocks) {
+
+        str += block->getName() + ": preds(";
+
+        for (size_t k = 0; k < block->preds.size(); ++k) {
+            str += (k ? ", " : "") + block->preds[k]->getName();
+        }
+
+        str += ") succs(";
+
+        for (size_t k = 0; k < block->succs.size(); ++k) {
+            str += (k ? ", " : "") + block->succs[k]->getName();
+        }
+
+        str += ") rpo " + std::to_string(block->rpoNumber) + "\n";
+    }
+}
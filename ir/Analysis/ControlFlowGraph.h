@@ -0,0 +1,137 @@
+///
+/// @file ControlFlowGraph.h
+/// @brief 函数的控制流图
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，函数按需构建的控制流图
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "BasicBlock.h"
+#include "Instruction.h"
+
+class Function;
+
+///
+/// @brief 控制流图，基于函数的线性IR划分基本块并建立前驱后继关系
+///
+/// 控制流图只是线性IR的一个视图，由Function::getCFG()按需创建。
+/// 构建时记录线性IR的修改计数，线性IR修改后Function::getCFG()会重新构建。
+///
+class ControlFlowGraph {
+
+public:
+    ///
+    /// @brief 构造函数，根据函数的线性IR构建控制流图
+    /// @param _func 所属函数
+    ///
+    explicit ControlFlowGraph(Function * _func);
+
+    ///
+    /// @brief 析构函数，释放基本块
+    ///
+    ~ControlFlowGraph();
+
+    ///
+    /// @brief 获取所有的基本块，按照线性IR中的先后次序
+    /// @return std::vector<BasicBlock *>& 基本块列表
+    ///
+    std::vector<BasicBlock *> & getBlocks();
+
+    ///
+    /// @brief 获取入口基本块
+    /// @return BasicBlock* 入口基本块，函数没有指令时为nullptr
+    ///
+    BasicBlock * getEntry();
+
+    ///
+    /// @brief 获取出口基本块，即exit指令所在的基本块
+    /// @return BasicBlock* 出口基本块，没有exit指令时为nullptr
+    ///
+    BasicBlock * getExit();
+
+    ///
+    /// @brief 获取逆后序的基本块列表，只包含从入口可达的基本块
+    /// @return std::vector<BasicBlock *>& 逆后序基本块列表
+    ///
+    std::vector<BasicBlock *> & getReversePostOrder();
+
+    ///
+    /// @brief 获取指令所在的基本块
+    /// @param inst 指令，可以是Label指令
+    /// @return BasicBlock* 基本块，指令不在函数内时为nullptr
+    ///
+    BasicBlock * getBlock(Instruction * inst);
+
+    ///
+    /// @brief 构建时线性IR的修改计数，用于检查控制流图是否过期
+    /// @return uint32_t 修改计数
+    ///
+    [[nodiscard]] uint32_t getModCount() const;
+
+    ///
+    /// @brief 控制流图转换成字符串，用于调试输出
+    /// @param str 字符串
+    ///
+    void toString(std::string & str);
+
+protected:
+    ///
+    /// @brief 按Label与跳转指令划分基本块
+    ///
+    void buildBlocks();
+
+    ///
+    /// @brief 根据基本块的最后一条指令建立前驱与后继关系
+    ///
+    void buildEdges();
+
+    ///
+    /// @brief 从入口进行深度优先遍历，计算逆后序
+    ///
+    void computeReversePostOrder();
+
+private:
+    ///
+    /// @brief 所属函数
+    ///
+    Function * func;
+
+    ///
+    /// @brief 基本块列表，按照线性IR中的先后次序
+    ///
+    std::vector<BasicBlock *> blocks;
+
+    ///
+    /// @brief 逆后序的基本块列表
+    ///
+    std::vector<BasicBlock *> rpo;
+
+    ///
+    /// @brief 出口基本块
+    ///
+    BasicBlock * exitBlock = nullptr;
+
+    ///
+    /// @brief 指令到所在基本块的映射
+    ///
+    std::unordered_map<Instruction *, BasicBlock *> instBlock;
+
+    ///
+    /// @brief 构建时线性IR的修改计数
+    ///
+    uint32_t modCount = 0;
+};
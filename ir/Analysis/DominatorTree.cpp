@@ -0,0 +1,185 @@
+///
+/// @file DominatorTree.cpp
+/// @brief 支配树与支配边界
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，SSA构造使用的支配树与支配边界
+/// </table>
+///
+#include <algorithm>
+
+#include "DominatorTree.h"
+
+///
+/// @brief 构造函数，计算控制流图的支配树与支配边界
+/// @param _cfg 控制流图
+///
+DominatorTree::DominatorTree(ControlFlowGraph * _cfg) : cfg(_cfg)
+{
+    size_t blockNum = cfg->getBlocks().size();
+
+    idom.assign(blockNum, nullptr);
+    children.assign(blockNum, std::vector<BasicBlock *>());
+    frontier.assign(blockNum, std::vector<BasicBlock *>());
+
+    computeIDom();
+    computeFrontier();
+}
+
+///
+/// @brief 获取直接支配者
+/// @param block 基本块
+/// @return BasicBlock* 直接支配者，入口基本块以及不可达基本块为nullptr
+///
+BasicBlock * DominatorTree::getIDom(BasicBlock * block)
+{
+    BasicBlock * dom = idom[block->getIndex()];
+
+    // 入口基本块的直接支配者在计算时设置为自身
+    return (dom == block) ? nullptr : dom;
+}
+
+///
+/// @brief 获取支配树上的孩子，即直接支配者为该基本块的基本块
+/// @param block 基本块
+/// @return std::vector<BasicBlock *>& 孩子列表
+///
+std::vector<BasicBlock *> & DominatorTree::getChildren(BasicBlock * block)
+{
+    return children[block->getIndex()];
+}
+
+///
+/// @brief 获取支配边界
+/// @param block 基本块
+/// @return std::vector<BasicBlock *>& 支配边界
+///
+std::vector<BasicBlock *> & DominatorTree::getFrontier(BasicBlock * block)
+{
+    return frontier[block->getIndex()];
+}
+
+///
+/// @brief 检查a是否支配b，基本块支配自身
+/// @param a 基本块
+/// @param b 基本块
+/// @return true 支配
+/// @return false 不支配
+///
+bool DominatorTree::dominates(BasicBlock * a, BasicBlock * b)
+{
+    if ((a->getRPONumber() == -1) || (b->getRPONumber() == -1)) {
+        return false;
+    }
+
+    // 支配者的逆后序编号一定更小，沿支配树向上查找
+    while (b->getRPONumber() > a->getRPONumber()) {
+        b = idom[b->getIndex()];
+    }
+
+    return a == b;
+}
+
+///
+/// @brief 沿支配树向上求两个基本块最近的公共支配者
+/// @param a 基本块
+/// @param b 基本块
+/// @return BasicBlock* 公共支配者
+///
+BasicBlock * DominatorTree::intersect(BasicBlock * a, BasicBlock * b)
+{
+    while (a != b) {
+        while (a->getRPONumber() > b->getRPONumber()) {
+            a = idom[a->getIndex()];
+        }
+        while (b->getRPONumber() > a->getRPONumber()) {
+            b = idom[b->getIndex()];
+        }
+    }
+
+    return a;
+}
+
+///
+/// @brief 迭代计算直接支配者
+///
+void DominatorTree::computeIDom()
+{
+    std::vector<BasicBlock *> & rpo = cfg->getReversePostOrder();
+    if (rpo.empty()) {
+        return;
+    }
+
+    BasicBlock * entry = rpo.front();
+    idom[entry->getIndex()] = entry;
+
+    // 按逆后序迭代，直接支配者为所有已处理前驱的最近公共支配者
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        for (size_t k = 1; k < rpo.size(); ++k) {
+
+            BasicBlock * block = rpo[k];
+            BasicBlock * newIDom = nullptr;
+
+            for (auto pred: block->getPreds()) {
+                if (idom[pred->getIndex()] == nullptr) {
+                    // 前驱尚未处理或者不可达
+                    continue;
+                }
+                newIDom = newIDom ? intersect(pred, newIDom) : pred;
+            }
+
+            if (idom[block->getIndex()] != newIDom) {
+                idom[block->getIndex()] = newIDom;
+                changed = true;
+            }
+        }
+    }
+
+    for (size_t k = 1; k < rpo.size(); ++k) {
+        children[idom[rpo[k]->getIndex()]->getIndex()].push_back(rpo[k]);
+    }
+}
+
+///
+/// @brief 根据直接支配者计算支配边界
+///
+void DominatorTree::computeFrontier()
+{
+    // 汇合点的每个前驱沿支配树向上直到汇合点的直接支配者，途经的基本块的支配边界包含该汇合点
+    for (auto block: cfg->getReversePostOrder()) {
+
+        if (block->getPreds().size() < 2) {
+            continue;
+        }
+
+        BasicBlock * blockIDom = idom[block->getIndex()];
+
+        for (auto pred: block->getPreds()) {
+
+            if (pred->getRPONumber() == -1) {
+                continue;
+            }
+
+            BasicBlock * runner = pred;
+            while (runner != blockIDom) {
+
+                std::vector<BasicBlock *> & df = frontier[runner->getIndex()];
+                if (std::find(df.begin(), df.end(), block) == df.end()) {
+                    df.push_back(block);
+                }
+
+                runner = idom[runner->getIndex()];
+            }
+        }
+    }
+}
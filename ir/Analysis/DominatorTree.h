@@ -0,0 +1,106 @@
+///
+/// @file DominatorTree.h
+/// @brief 支配树与支配边界
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，SSA构造使用的支配树与支配边界
+/// </table>
+///
+#pragma once
+
+#include <vector>
+
+#include "BasicBlock.h"
+#include "ControlFlowGraph.h"
+
+///
+/// @brief 支配树，采用Cooper-Harvey-Kennedy的迭代算法计算直接支配者，并计算支配边界
+///
+/// 只有从入口可达的基本块才在支配树中，不可达基本块的直接支配者为nullptr。
+///
+class DominatorTree {
+
+public:
+    ///
+    /// @brief 构造函数，计算控制流图的支配树与支配边界
+    /// @param _cfg 控制流图
+    ///
+    explicit DominatorTree(ControlFlowGraph * _cfg);
+
+    ///
+    /// @brief 获取直接支配者
+    /// @param block 基本块
+    /// @return BasicBlock* 直接支配者，入口基本块以及不可达基本块为nullptr
+    ///
+    BasicBlock * getIDom(BasicBlock * block);
+
+    ///
+    /// @brief 获取支配树上的孩子，即直接支配者为该基本块的基本块
+    /// @param block 基本块
+    /// @return std::vector<BasicBlock *>& 孩子列表
+    ///
+    std::vector<BasicBlock *> & getChildren(BasicBlock * block);
+
+    ///
+    /// @brief 获取支配边界
+    /// @param block 基本块
+    /// @return std::vector<BasicBlock *>& 支配边界
+    ///
+    std::vector<BasicBlock *> & getFrontier(BasicBlock * block);
+
+    ///
+    /// @brief 检查a是否支配b，基本块支配自身
+    /// @param a 基本块
+    /// @param b 基本块
+    /// @return true 支配
+    /// @return false 不支配
+    ///
+    bool dominates(BasicBlock * a, BasicBlock * b);
+
+protected:
+    ///
+    /// @brief 迭代计算直接支配者
+    ///
+    void computeIDom();
+
+    ///
+    /// @brief 根据直接支配者计算支配边界
+    ///
+    void computeFrontier();
+
+    ///
+    /// @brief 沿支配树向上求两个基本块最近的公共支配者
+    /// @param a 基本块
+    /// @param b 基本块
+    /// @return BasicBlock* 公共支配者
+    ///
+    BasicBlock * intersect(BasicBlock * a, BasicBlock * b);
+
+private:
+    ///
+    /// @brief 控制流图
+    ///
+    ControlFlowGraph * cfg;
+
+    ///
+    /// @brief 直接支配者，下标为基本块编号
+    ///
+    std::vector<BasicBlock *> idom;
+
+    ///
+    /// @brief 支配树上的孩子，下标为基本块编号
+    ///
+    std::vector<std::vector<BasicBlock *>> children;
+
+    ///
+    /// @brief 支配边界，下标为基本块编号
+    ///
+    std::vector<std::vector<BasicBlock *>> frontier;
+};
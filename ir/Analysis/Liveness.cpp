@@ -0,0 +1,167 @@
+///
+/// @file Liveness.cpp
+/// @brief 基本块粒度的活跃变量分析
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，SSA形式上基本块粒度的活跃变量分析
+/// </table>
+///
+#include "Common.h"
+#include "Liveness.h"
+#include "Instruction.h"
+#include "LocalVariable.h"
+#include "FormalParam.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 构造函数，对控制流图进行活跃变量分析
+/// @param _cfg 控制流图
+///
+Liveness::Liveness(ControlFlowGraph * _cfg) : cfg(_cfg)
+{
+    size_t blockNum = cfg->getBlocks().size();
+
+    use.resize(blockNum);
+    def.resize(blockNum);
+    phiUse.resize(blockNum);
+    liveIn.resize(blockNum);
+    liveOut.resize(blockNum);
+
+    computeUseDef();
+    solve();
+}
+
+///
+/// @brief 获取基本块入口处活跃的Value
+/// @param block 基本块
+/// @return std::unordered_set<Value *>& 活跃Value集合
+///
+std::unordered_set<Value *> & Liveness::getLiveIn(BasicBlock * block)
+{
+    return liveIn[block->getIndex()];
+}
+
+///
+/// @brief 获取基本块出口处活跃的Value
+/// @param block 基本块
+/// @return std::unordered_set<Value *>& 活跃Value集合
+///
+std::unordered_set<Value *> & Liveness::getLiveOut(BasicBlock * block)
+{
+    return liveOut[block->getIndex()];
+}
+
+///
+/// @brief 检查Value是否参与活跃变量分析
+/// @param val Value
+/// @return true 参与
+/// @return false 不参与
+///
+bool Liveness::isTracked(Value * val)
+{
+    if (dynamic_cast<LocalVariable *>(val) || dynamic_cast<FormalParam *>(val)) {
+        return true;
+    }
+
+    Instanceof(inst, Instruction *, val);
+
+    return inst && (inst->getOp() != IRInstOperator::IRINST_OP_LABEL) && inst->hasResultValue();
+}
+
+///
+/// @brief 计算每个基本块的use与def集合
+///
+void Liveness::computeUseDef()
+{
+    for (auto block: cfg->getBlocks()) {
+
+        auto & blockUse = use[block->getIndex()];
+        auto & blockDef = def[block->getIndex()];
+
+        for (auto inst: block->getInsts()) {
+
+            Instanceof(phi, PhiInstruction *, inst);
+            if (phi) {
+
+                // phi指令的操作数在对应前驱基本块的出口处使用
+                auto & incomingBlocks = phi->getIncomingBlocks();
+                for (int32_t k = 0; k < phi->getOperandsNum(); ++k) {
+                    BasicBlock * pred = cfg->getBlock(incomingBlocks[k]);
+                    if (pred && isTracked(phi->getOperand(k))) {
+                        phiUse[pred->getIndex()].insert(phi->getOperand(k));
+                    }
+                }
+
+                blockDef.insert(phi);
+                continue;
+            }
+
+            // 赋值指令的第一个操作数是定值
+            bool isAssign = inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN;
+
+            for (int32_t k = isAssign ? 1 : 0; k < inst->getOperandsNum(); ++k) {
+                Value * val = inst->getOperand(k);
+                if (isTracked(val) && !blockDef.count(val)) {
+                    blockUse.insert(val);
+                }
+            }
+
+            if (isAssign) {
+                if (isTracked(inst->getOperand(0))) {
+                    blockDef.insert(inst->getOperand(0));
+                }
+            } else if (isTracked(inst)) {
+                blockDef.insert(inst);
+            }
+        }
+    }
+}
+
+///
+/// @brief 逆向迭代求解数据流方程
+///
+void Liveness::solve()
+{
+    auto & rpo = cfg->getReversePostOrder();
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        // 逆向数据流按照逆后序的反序遍历收敛较快
+        for (auto pIter = rpo.rbegin(); pIter != rpo.rend(); ++pIter) {
+
+            BasicBlock * block = *pIter;
+            int32_t index = block->getIndex();
+
+            // liveOut = 后继的liveIn的并集，再加上后继phi指令来自本基本块的操作数
+            std::unordered_set<Value *> out = phiUse[index];
+            for (auto succ: block->getSuccs()) {
+                auto & succIn = liveIn[succ->getIndex()];
+                out.insert(succIn.begin(), succIn.end());
+            }
+
+            // liveIn = use ∪ (liveOut - def)
+            std::unordered_set<Value *> in = use[index];
+            for (auto val: out) {
+                if (!def[index].count(val)) {
+                    in.insert(val);
+                }
+            }
+
+            if (in.size() != liveIn[index].size()) {
+                liveIn[index] = std::move(in);
+                changed = true;
+            }
+
+            liveOut[index] = std::move(out);
+        }
+    }
+}
@@ -0,0 +1,103 @@
+///
+/// @file Liveness.h
+/// @brief 基本块粒度的活跃变量分析
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，SSA形式上基本块粒度的活跃变量分析
+/// </table>
+///
+#pragma once
+
+#include <unordered_set>
+#include <vector>
+
+#include "BasicBlock.h"
+#include "ControlFlowGraph.h"
+#include "Value.h"
+
+///
+/// @brief 活跃变量分析，计算每个基本块入口与出口处活跃的Value
+///
+/// 分析的对象是有结果的指令、局部变量与形参，常量与全局变量不参与。
+/// phi指令的操作数视为在对应前驱基本块的出口处活跃，而不是在phi指令所在基本块的入口处活跃。
+///
+class Liveness {
+
+public:
+    ///
+    /// @brief 构造函数，对控制流图进行活跃变量分析
+    /// @param _cfg 控制流图
+    ///
+    explicit Liveness(ControlFlowGraph * _cfg);
+
+    ///
+    /// @brief 获取基本块入口处活跃的Value
+    /// @param block 基本块
+    /// @return std::unordered_set<Value *>& 活跃Value集合
+    ///
+    std::unordered_set<Value *> & getLiveIn(BasicBlock * block);
+
+    ///
+    /// @brief 获取基本块出口处活跃的Value
+    /// @param block 基本块
+    /// @return std::unordered_set<Value *>& 活跃Value集合
+    ///
+    std::unordered_set<Value *> & getLiveOut(BasicBlock * block);
+
+    ///
+    /// @brief 检查Value是否参与活跃变量分析
+    /// @param val Value
+    /// @return true 参与
+    /// @return false 不参与
+    ///
+    static bool isTracked(Value * val);
+
+protected:
+    ///
+    /// @brief 计算每个基本块的use与def集合
+    ///
+    void computeUseDef();
+
+    ///
+    /// @brief 逆向迭代求解数据流方程
+    ///
+    void solve();
+
+private:
+    ///
+    /// @brief 控制流图
+    ///
+    ControlFlowGraph * cfg;
+
+    ///
+    /// @brief 基本块内先使用后定值的Value，下标为基本块编号
+    ///
+    std::vector<std::unordered_set<Value *>> use;
+
+    ///
+    /// @brief 基本块内定值的Value，下标为基本块编号
+    ///
+    std::vector<std::unordered_set<Value *>> def;
+
+    ///
+    /// @brief 后继基本块的phi指令来自本基本块的操作数，下标为基本块编号
+    ///
+    std::vector<std::unordered_set<Value *>> phiUse;
+
+    ///
+    /// @brief 入口处活跃的Value，下标为基本块编号
+    ///
+    std::vector<std::unordered_set<Value *>> liveIn;
+
+    ///
+    /// @brief 出口处活跃的Value，下标为基本块编号
+    ///
+    std::vector<std::unordered_set<Value *>> liveOut;
+};
@@ -0,0 +1,210 @@
+///
+/// @file LoopInfo.cpp
+/// @brief 自然循环的识别
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，基于回边识别自然循环
+/// </table>
+///
+#include <algorithm>
+
+#include "LoopInfo.h"
+
+///
+/// @brief 获取循环头
+/// @return BasicBlock* 循环头
+///
+BasicBlock * Loop::getHeader()
+{
+    return header;
+}
+
+///
+/// @brief 获取循环内的基本块，按照逆后序排列，第一个是循环头
+/// @return std::vector<BasicBlock *>& 基本块列表
+///
+std::vector<BasicBlock *> & Loop::getBlocks()
+{
+    return blocks;
+}
+
+///
+/// @brief 获取回边的源基本块
+/// @return std::vector<BasicBlock *>& 基本块列表
+///
+std::vector<BasicBlock *> & Loop::getLatches()
+{
+    return latches;
+}
+
+///
+/// @brief 获取外层循环
+/// @return Loop* 外层循环，最外层循环为nullptr
+///
+Loop * Loop::getParent()
+{
+    return parent;
+}
+
+///
+/// @brief 获取直接内嵌的循环
+/// @return std::vector<Loop *>& 内层循环列表
+///
+std::vector<Loop *> & Loop::getChildren()
+{
+    return children;
+}
+
+///
+/// @brief 获取循环的嵌套深度，最外层循环为1
+/// @return int32_t 嵌套深度
+///
+int32_t Loop::getDepth() const
+{
+    return depth;
+}
+
+///
+/// @brief 检查基本块是否在循环内
+/// @param block 基本块
+/// @return true 在循环内 false 不在
+///
+bool Loop::contains(BasicBlock * block)
+{
+    return inLoop[block->getIndex()];
+}
+
+///
+/// @brief 构造函数，识别控制流图中的自然循环
+/// @param _cfg 控制流图
+/// @param domTree 支配树
+///
+LoopInfo::LoopInfo(ControlFlowGraph * _cfg, DominatorTree * domTree) : cfg(_cfg)
+{
+    size_t blockNum = cfg->getBlocks().size();
+
+    blockLoop.assign(blockNum, nullptr);
+
+    // 按照逆后序查找循环头，即回边的目标
+    for (auto header: cfg->getReversePostOrder()) {
+
+        std::vector<BasicBlock *> latches;
+        for (auto pred: header->getPreds()) {
+            if ((pred->getRPONumber() != -1) && domTree->dominates(header, pred)) {
+                latches.push_back(pred);
+            }
+        }
+
+        if (latches.empty()) {
+            continue;
+        }
+
+        Loop * loop = new Loop();
+        loop->header = header;
+        loop->latches = latches;
+        loop->inLoop.assign(blockNum, false);
+        loop->inLoop[header->getIndex()] = true;
+
+        // 从回边的源基本块出发逆向遍历到循环头，经过的基本块都在循环内
+        std::vector<BasicBlock *> workList = latches;
+        while (!workList.empty()) {
+
+            BasicBlock * block = workList.back();
+            workList.pop_back();
+
+            if (loop->inLoop[block->getIndex()]) {
+                continue;
+            }
+
+            loop->inLoop[block->getIndex()] = true;
+
+            for (auto pred: block->getPreds()) {
+                if (pred->getRPONumber() != -1) {
+                    workList.push_back(pred);
+                }
+            }
+        }
+
+        for (auto block: cfg->getReversePostOrder()) {
+            if (loop->inLoop[block->getIndex()]) {
+                loop->blocks.push_back(block);
+            }
+        }
+
+        loops.push_back(loop);
+    }
+
+    // 循环头按逆后序排列，外层循环的循环头在前，因此后处理的循环覆盖先处理的循环就是最内层循环
+    for (auto loop: loops) {
+        for (auto block: loop->blocks) {
+
+            Loop * outer = blockLoop[block->getIndex()];
+            if ((block == loop->header) && outer) {
+                loop->parent = outer;
+            }
+
+            blockLoop[block->getIndex()] = loop;
+        }
+    }
+
+    for (auto loop: loops) {
+        if (loop->parent) {
+            loop->parent->children.push_back(loop);
+        }
+    }
+
+    // 逆后序中外层循环在前，计算深度后反转使得内层循环在前
+    for (auto loop: loops) {
+        loop->depth = loop->parent ? loop->parent->depth + 1 : 1;
+    }
+
+    std::reverse(loops.begin(), loops.end());
+}
+
+///
+/// @brief 析构函数
+///
+LoopInfo::~LoopInfo()
+{
+    for (auto loop: loops) {
+        delete loop;
+    }
+}
+
+///
+/// @brief 获取所有的循环，内层循环排在外层循环之前
+/// @return std::vector<Loop *>& 循环列表
+///
+std::vector<Loop *> & LoopInfo::getLoops()
+{
+    return loops;
+}
+
+///
+/// @brief 获取基本块所在的最内层循环
+/// @param block 基本块
+/// @return Loop* 循环，不在循环内时为nullptr
+///
+Loop * LoopInfo::getLoopFor(BasicBlock * block)
+{
+    return blockLoop[block->getIndex()];
+}
+
+///
+/// @brief 获取基本块的循环嵌套深度
+/// @param block 基本块
+/// @return int32_t 嵌套深度，不在循环内时为0
+///
+int32_t LoopInfo::getLoopDepth(BasicBlock * block)
+{
+    Loop * loop = blockLoop[block->getIndex()];
+
+    return loop ? loop->depth : 0;
+}
@@ -0,0 +1,165 @@
+///
+/// @file LoopInfo.h
+/// @brief 自然循环的识别
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，基于回边识别自然循环
+/// </table>
+///
+#pragma once
+
+#include <vector>
+
+#include "BasicBlock.h"
+#include "ControlFlowGraph.h"
+#include "DominatorTree.h"
+
+///
+/// @brief 自然循环
+///
+class Loop {
+
+    friend class LoopInfo;
+
+public:
+    ///
+    /// @brief 获取循环头
+    /// @return BasicBlock* 循环头
+    ///
+    BasicBlock * getHeader();
+
+    ///
+    /// @brief 获取循环内的基本块，按照逆后序排列，第一个是循环头
+    /// @return std::vector<BasicBlock *>& 基本块列表
+    ///
+    std::vector<BasicBlock *> & getBlocks();
+
+    ///
+    /// @brief 获取回边的源基本块
+    /// @return std::vector<BasicBlock *>& 基本块列表
+    ///
+    std::vector<BasicBlock *> & getLatches();
+
+    ///
+    /// @brief 获取外层循环
+    /// @return Loop* 外层循环，最外层循环为nullptr
+    ///
+    Loop * getParent();
+
+    ///
+    /// @brief 获取直接内嵌的循环
+    /// @return std::vector<Loop *>& 内层循环列表
+    ///
+    std::vector<Loop *> & getChildren();
+
+    ///
+    /// @brief 获取循环的嵌套深度，最外层循环为1
+    /// @return int32_t 嵌套深度
+    ///
+    [[nodiscard]] int32_t getDepth() const;
+
+    ///
+    /// @brief 检查基本块是否在循环内
+    /// @param block 基本块
+    /// @return true 在循环内 false 不在
+    ///
+    bool contains(BasicBlock * block);
+
+private:
+    ///
+    /// @brief 循环头
+    ///
+    BasicBlock * header = nullptr;
+
+    ///
+    /// @brief 循环内的基本块
+    ///
+    std::vector<BasicBlock *> blocks;
+
+    ///
+    /// @brief 基本块是否在循环内，下标为基本块编号
+    ///
+    std::vector<bool> inLoop;
+
+    ///
+    /// @brief 回边的源基本块
+    ///
+    std::vector<BasicBlock *> latches;
+
+    ///
+    /// @brief 外层循环
+    ///
+    Loop * parent = nullptr;
+
+    ///
+    /// @brief 内层循环
+    ///
+    std::vector<Loop *> children;
+
+    ///
+    /// @brief 嵌套深度
+    ///
+    int32_t depth = 1;
+};
+
+///
+/// @brief 函数内的循环信息，根据回边识别自然循环，同一循环头的回边合并为一个循环
+///
+class LoopInfo {
+
+public:
+    ///
+    /// @brief 构造函数，识别控制流图中的自然循环
+    /// @param _cfg 控制流图
+    /// @param domTree 支配树
+    ///
+    LoopInfo(ControlFlowGraph * _cfg, DominatorTree * domTree);
+
+    ///
+    /// @brief 析构函数
+    ///
+    ~LoopInfo();
+
+    ///
+    /// @brief 获取所有的循环，内层循环排在外层循环之前
+    /// @return std::vector<Loop *>& 循环列表
+    ///
+    std::vector<Loop *> & getLoops();
+
+    ///
+    /// @brief 获取基本块所在的最内层循环
+    /// @param block 基本块
+    /// @return Loop* 循环，不在循环内时为nullptr
+    ///
+    Loop * getLoopFor(BasicBlock * block);
+
+    ///
+    /// @brief 获取基本块的循环嵌套深度
+    /// @param block 基本块
+    /// @return int32_t 嵌套深度，不在循环内时为0
+    ///
+    int32_t getLoopDepth(BasicBlock * block);
+
+private:
+    ///
+    /// @brief 控制流图
+    ///
+    ControlFlowGraph * cfg;
+
+    ///
+    /// @brief 所有的循环，内层在前
+    ///
+    std::vector<Loop *> loops;
+
+    ///
+    /// @brief 基本块所在的最内层循环，下标为基本块编号
+    ///
+    std::vector<Loop *> blockLoop;
+};
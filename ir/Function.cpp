@@ -19,6 +19,7 @@
 
 #include "IRConstant.h"
 #include "Function.h"
+#include "ControlFlowGraph.h"
 
 /// @brief 指定函数名字、函数类型的构造函数
 /// @param _name 函数名称
@@ -63,6 +64,43 @@ InterCode & Function::getInterCode()
     return code;
 }
 
+///
+/// @brief 获取函数的控制流图，不存在或者已过期时重新构建
+/// @return ControlFlowGraph* 控制流图
+///
+ControlFlowGraph * Function::getCFG()
+{
+    // 修改计数发生变化，说明线性IR已修改，需要重新构建
+    if (cfg && (cfg->getModCount() != code.getModCount())) {
+        invalidateCFG();
+    }
+
+    if (!cfg) {
+        cfg = new ControlFlowGraph(this);
+        cfgVersion++;
+    }
+
+    return cfg;
+}
+
+///
+/// @brief 使控制流图失效，线性IR的指令发生变化后必须调用
+///
+void Function::invalidateCFG()
+{
+    delete cfg;
+    cfg = nullptr;
+}
+
+///
+/// @brief 获取控制流图的版本号，每次重新构建控制流图时加1，用于判断基于控制流图的分析是否过期
+/// @return uint32_t 版本号
+///
+uint32_t Function::getCFGVersion()
+{
+    return cfgVersion;
+}
+
 /// @brief 判断该函数是否是内置函数
 /// @return true: 内置函数，false：用户自定义
 bool Function::isBuiltin()
@@ -117,7 +155,7 @@ void Function::toString(std::string & str)
 
     // 输出临时变量的declare形式
     // 遍历所有的线性IR指令，文本输出
-    for (auto & inst: code.getInsts()) {
+    for (auto inst: code) {
 
         if (inst->hasResultValue()) {
 
@@ -127,7 +165,7 @@ void Function::toString(std::string & str)
     }
 
     // 遍历所有的线性IR指令，文本输出
-    for (auto & inst: code.getInsts()) {
+    for (auto inst: code) {
 
         std::string instStr;
         inst->toString(instStr);
@@ -265,7 +303,8 @@ MemVariable * Function::newMemVariable(Type * type)
 /// @brief 清理函数内申请的资源
 void Function::Delete()
 {
-    // 清理IR指令
+    // 清理控制流图与IR指令
+    invalidateCFG();
     code.Delete();
 
     // 清理Value
@@ -300,7 +339,7 @@ void Function::renameIR()
     }
 
     // 遍历所有的指令进行命名
-    for (auto inst: this->getInterCode().getInsts()) {
+    for (auto inst: this->getInterCode()) {
         if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
             inst->setIRName(IR_LABEL_PREFIX + std::to_string(nameIndex++));
         } else if (inst->hasResultValue()) {
@@ -25,6 +25,8 @@
 #include "MemVariable.h"
 #include "IRCode.h"
 
+class ControlFlowGraph;
+
 ///
 /// @brief 描述函数信息的类，是全局静态存储，其Value的类型为FunctionType
 ///
@@ -55,6 +57,23 @@ public:
     /// @return IR指令代码
     InterCode & getInterCode();
 
+    ///
+    /// @brief 获取函数的控制流图，不存在或者已过期时重新构建
+    /// @return ControlFlowGraph* 控制流图
+    ///
+    ControlFlowGraph * getCFG();
+
+    ///
+    /// @brief 使控制流图失效，线性IR的指令发生变化后必须调用
+    ///
+    void invalidateCFG();
+
+    ///
+    /// @brief 获取控制流图的版本号，每次重新构建控制流图时加1，用于判断基于控制流图的分析是否过期
+    /// @return uint32_t 版本号
+    ///
+    uint32_t getCFGVersion();
+
     /// @brief 判断该函数是否是内置函数
     /// @return true: 内置函数，false：用户自定义
     bool isBuiltin();
@@ -191,6 +210,16 @@ private:
     ///
     InterCode code;
 
+    ///
+    /// @brief 控制流图，按需构建
+    ///
+    ControlFlowGraph * cfg = nullptr;
+
+    ///
+    /// @brief 控制流图的版本号
+    ///
+    uint32_t cfgVersion = 0;
+
     ///
     /// @brief 函数内变量的向量表，可能重名，请注意
     ///
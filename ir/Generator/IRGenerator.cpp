@@ -36,11 +36,13 @@
 #include "MoveInstruction.h"
 #include "GotoInstruction.h"
 #include "UnaryInstruction.h"
+#include "ConstantFolder.h"
 
 /// @brief 构造函数
 /// @param _root AST的根
 /// @param _module 符号表
-IRGenerator::IRGenerator(ast_node * _root, Module * _module) : root(_root), module(_module)
+IRGenerator::IRGenerator(ast_node * _root, Module * _module)
+    : root(_root), module(_module), nodeInfos(get_ast_node_count())
 {
     /* 叶子节点 */
     ast2ir_handlers[ast_operator_type::AST_OP_LEAF_LITERAL_UINT] = &IRGenerator::ir_leaf_node_uint;
@@ -107,6 +109,14 @@ bool IRGenerator::run()
     return node != nullptr;
 }
 
+/// @brief 指令加入到当前函数的指令序列尾部。各节点按求值的次序翻译，指令直接按最终的次序产生，
+/// 不再先保存在AST节点中再逐层拼接，IR产生的时间与AST的大小成线性关系
+/// @param inst 指令
+void IRGenerator::emit(Instruction * inst)
+{
+    module->getCurrentFunction()->getInterCode().addInst(inst);
+}
+
 /// @brief 根据AST的节点运算符查找对应的翻译函数并执行翻译动作
 /// @param node AST节点
 /// @return 成功返回node节点，否则返回nullptr
@@ -198,7 +208,7 @@ bool IRGenerator::ir_function_define(ast_node * node)
     ast_node * block_node = node->sons[3];
 
     // 创建一个新的函数定义
-    Function * newFunc = module->newFunction(name_node->name, type_node->type);
+    Function * newFunc = module->newFunction(name_node->getName(), type_node->type);
     if (!newFunc) {
         // 新定义的函数已经存在，则失败返回。
         // TODO 自行追加语义错误处理
@@ -225,14 +235,13 @@ bool IRGenerator::ir_function_define(ast_node * node)
     // 函数出口指令保存到函数信息中，因为在语义分析函数体时return语句需要跳转到函数尾部，需要这个label指令
     newFunc->setExitLabel(exitLabelInst);
 
-    // 遍历形参，没有IR指令，不需要追加
+    // 遍历形参，产生形参拷贝到局部变量的赋值指令
     result = ir_function_formal_params(param_node);
     if (!result) {
         // 形参解析失败
         // TODO 自行追加语义错误处理
         return false;
     }
-    node->blockInsts.addInst(param_node->blockInsts);
 
     // 新建一个Value，用于保存函数的返回值，如果没有返回值可不用申请
     LocalVariable * retValue = nullptr;
@@ -246,7 +255,7 @@ bool IRGenerator::ir_function_define(ast_node * node)
     // 这里最好设置返回值变量的初值为0，以便在没有返回值时能够返回0
 
     // 函数内已经进入作用域，内部不再需要做变量的作用域管理
-    block_node->needScope = false;
+    info(block_node).needScope = false;
 
     // 遍历block
     result = ir_block(block_node);
@@ -256,12 +265,6 @@ bool IRGenerator::ir_function_define(ast_node * node)
         return false;
     }
 
-    // IR指令追加到当前的节点中
-    node->blockInsts.addInst(block_node->blockInsts);
-
-    // node节点的指令移动到函数的IR指令列表中
-    irCode.addInst(node->blockInsts);
-
     // 添加函数出口Label指令，主要用于return语句跳转到这里进行函数的退出
     irCode.addInst(exitLabelInst);
 
@@ -282,12 +285,25 @@ bool IRGenerator::ir_function_define(ast_node * node)
 /// @return 翻译是否成功，true：成功，false：失败
 bool IRGenerator::ir_function_formal_params(ast_node * node)
 {
-    // TODO 目前形参还不支持，直接返回true
+    Function * currentFunc = module->getCurrentFunction();
 
     // 每个形参变量都创建对应的临时变量，用于表达实参转递的值
     // 而真实的形参则创建函数内的局部变量。
     // 然后产生赋值指令，用于把表达实参值的临时变量拷贝到形参局部变量上。
-    // 请注意这些指令要放在Entry指令后面，因此处理的先后上要注意。
+    // 请注意这些指令要放在Entry指令后面，调用前Entry指令已经加入。
+    for (auto son: node->sons) {
+
+        FormalParam * param = new FormalParam(son->type, son->getName());
+        currentFunc->getParams().push_back(param);
+
+        // 形参对应的局部变量，函数体内对形参的访问都使用该变量
+        Value * var = module->newVarValue(son->type, son->getName());
+        if (!var) {
+            return false;
+        }
+
+        currentFunc->getInterCode().addInst(new MoveInstruction(currentFunc, var, param));
+    }
 
     return true;
 }
@@ -306,7 +322,7 @@ bool IRGenerator::ir_function_call(ast_node * node)
     // 第一个节点：函数名节点
     // 第二个节点：实参列表节点
 
-    std::string funcName = node->sons[0]->name;
+    std::string funcName = node->sons[0]->getName();
     int64_t lineno = node->sons[0]->line_no;
 
     ast_node * paramsNode = node->sons[1];
@@ -343,8 +359,7 @@ bool IRGenerator::ir_function_call(ast_node * node)
                 return false;
             }
 
-            realParams.push_back(temp->val);
-            node->blockInsts.addInst(temp->blockInsts);
+            realParams.push_back(info(temp).val);
         }
     }
 
@@ -361,10 +376,10 @@ bool IRGenerator::ir_function_call(ast_node * node)
     FuncCallInstruction * funcCallInst = new FuncCallInstruction(currentFunc, calledFunction, realParams, type);
 
     // 创建函数调用指令
-    node->blockInsts.addInst(funcCallInst);
+    emit(funcCallInst);
 
     // 函数调用结果Value保存到node中，可能为空，上层节点可利用这个值
-    node->val = funcCallInst;
+    info(node).val = funcCallInst;
 
     return true;
 }
@@ -375,11 +390,11 @@ bool IRGenerator::ir_function_call(ast_node * node)
 bool IRGenerator::ir_block(ast_node * node)
 {
     // 进入作用域
-    if (node->needScope) {
+    if (info(node).needScope) {
         module->enterScope();
     }
 
-    std::vector<ast_node *>::iterator pIter;
+    ast_node ** pIter;
     for (pIter = node->sons.begin(); pIter != node->sons.end(); ++pIter) {
 
         // 遍历Block的每个语句，进行显示或者运算
@@ -387,98 +402,98 @@ bool IRGenerator::ir_block(ast_node * node)
         if (!temp) {
             return false;
         }
-
-        node->blockInsts.addInst(temp->blockInsts);
     }
 
     // 离开作用域
-    if (node->needScope) {
+    if (info(node).needScope) {
         module->leaveScope();
     }
 
     return true;
 }
 
+/// @brief if语句AST节点翻译成线性中间IR，条件直接翻译为跳转
+/// @param node AST节点
+/// @return 翻译是否成功，true：成功，false：失败
 bool IRGenerator::ir_if(ast_node * node)
 {
     Function * currentFunc = module->getCurrentFunction();
     if (!currentFunc)
         return false;
 
-    std::string true_label = generateLabel();  // 真分支标签
-    std::string false_label = generateLabel(); // 假分支标签
-    std::string end_label = generateLabel();   // 结束标签
+    bool hasElse = node->sons.size() > 2;
+
+    auto trueLabelInst = new LabelInstruction(currentFunc, generateLabel());
+    auto endLabelInst = new LabelInstruction(currentFunc, generateLabel());
+
+    // 没有else分支时条件为假直接跳转到结束标签
+    auto falseLabelInst = hasElse ? new LabelInstruction(currentFunc, generateLabel()) : endLabelInst;
 
-    // 条件表达式（此处假设true为常量1，false为0）
+    // 条件表达式为真跳转到真分支，为假跳转到假分支
     ast_node * condNode = node->sons[0];
-    ir_visit_ast_node(condNode);
-
-    // 创建标签对象
-    auto trueLabelInst = new LabelInstruction(currentFunc, true_label);
-    auto falseLabelInst = new LabelInstruction(currentFunc, false_label);
-    auto endLabelInst = new LabelInstruction(currentFunc, end_label);
-    // std::cerr << true_label << ' ' << false_label << ' ' << end_label << std::endl;
-    //  生成 BF 指令：如果条件为假，跳转到假分支
-    node->blockInsts.addInst(condNode->blockInsts);
-    node->blockInsts.addInst(
-        new BranchInstruction(currentFunc, IRInstOperator::IRINST_OP_BF, condNode->val, falseLabelInst));
+    if (!ir_cond(condNode, trueLabelInst, falseLabelInst)) {
+        return false;
+    }
 
     // 真分支
-    node->blockInsts.addInst(trueLabelInst);
-    ir_visit_ast_node(node->sons[1]);
-    node->blockInsts.addInst(node->sons[1]->blockInsts);
-    // 真分支语句（a=48）
-    node->blockInsts.addInst(new GotoInstruction(currentFunc, endLabelInst)); // 跳转到结束标签
+    emit(trueLabelInst);
+    if (!ir_visit_ast_node(node->sons[1])) {
+        return false;
+    }
+    emit(new GotoInstruction(currentFunc, endLabelInst));
 
     // 假分支
-    node->blockInsts.addInst(falseLabelInst);
-    if (node->sons.size() > 2) {
-        ir_visit_ast_node(node->sons[2]);
-        node->blockInsts.addInst(node->sons[2]->blockInsts);
+    if (hasElse) {
+        emit(falseLabelInst);
+        if (!ir_visit_ast_node(node->sons[2])) {
+            return false;
+        }
+        emit(new GotoInstruction(currentFunc, endLabelInst));
     }
-    node->blockInsts.addInst(new GotoInstruction(currentFunc, endLabelInst)); // 跳转到结束标签
 
     // 结束标签
-    node->blockInsts.addInst(endLabelInst);
+    emit(endLabelInst);
     return true;
 }
 
+/// @brief while语句AST节点翻译成线性中间IR，条件直接翻译为跳转
+/// @param node AST节点
+/// @return 翻译是否成功，true：成功，false：失败
 bool IRGenerator::ir_while(ast_node * node)
 {
     Function * currentFunc = module->getCurrentFunction();
     if (!currentFunc)
         return false;
 
-    std::string loop_entry_label = generateLabel();
-    std::string loop_body_label = generateLabel();
-    std::string loop_exit_label = generateLabel();
+    // 循环入口、循环体与循环出口标签
+    auto loopEntryLabel = new LabelInstruction(currentFunc, generateLabel());
+    auto loopBodyLabel = new LabelInstruction(currentFunc, generateLabel());
+    auto loopExitLabel = new LabelInstruction(currentFunc, generateLabel());
 
-    loop_contexts.push({loop_entry_label, loop_body_label, loop_exit_label});
+    loop_contexts.push({loopEntryLabel, loopExitLabel});
 
     // 循环入口标签
-    auto loopEntryLabel = new LabelInstruction(currentFunc, loop_entry_label);
-    node->blockInsts.addInst(loopEntryLabel);
+    emit(loopEntryLabel);
 
-    // 条件表达式
+    // 条件为真进入循环体，为假跳转到循环出口
     ast_node * condNode = node->sons[0];
-    ir_visit_ast_node(condNode);
-    node->blockInsts.addInst(condNode->blockInsts);
-    // 生成BT指令：条件为真时跳转到循环体
-    auto loopBodyLabel = new LabelInstruction(currentFunc, loop_body_label);
-    node->blockInsts.addInst(
-        new BranchInstruction(currentFunc, IRInstOperator::IRINST_OP_BT, condNode->val, loopBodyLabel));
-
-    // 循环出口标签（条件为假时直接到达）
-    auto loopExitLabel = new LabelInstruction(currentFunc, loop_exit_label);
-    node->blockInsts.addInst(loopExitLabel);
+    if (!ir_cond(condNode, loopBodyLabel, loopExitLabel)) {
+        loop_contexts.pop();
+        return false;
+    }
 
     // 循环体入口标签
-    node->blockInsts.addInst(loopBodyLabel);
-    ir_visit_ast_node(node->sons[1]); // 循环体
-    node->blockInsts.addInst(node->sons[1]->blockInsts);
+    emit(loopBodyLabel);
+    if (!ir_visit_ast_node(node->sons[1])) {
+        loop_contexts.pop();
+        return false;
+    }
 
     // 无条件跳转到循环条件判断
-    node->blockInsts.addInst(new GotoInstruction(currentFunc, loopEntryLabel));
+    emit(new GotoInstruction(currentFunc, loopEntryLabel));
+
+    // 循环出口标签
+    emit(loopExitLabel);
 
     loop_contexts.pop();
     return true;
@@ -492,12 +507,8 @@ bool IRGenerator::ir_break(ast_node * node)
         return false;
     }
 
-    // 获取循环出口标签
-    const LoopContext & context = loop_contexts.top();
-    auto loopExitLabel = new LabelInstruction(currentFunc, context.loop_exit_label);
-
-    // 生成跳转到出口标签的指令
-    node->blockInsts.addInst(new GotoInstruction(currentFunc, loopExitLabel));
+    // 生成跳转到当前循环出口标签的指令
+    emit(new GotoInstruction(currentFunc, loop_contexts.top().exitLabel));
     return true;
 }
 
@@ -509,109 +520,144 @@ bool IRGenerator::ir_continue(ast_node * node)
         return false;
     }
 
-    // 获取循环入口标签
-    const LoopContext & context = loop_contexts.top();
-    auto loopEntryLabel = new LabelInstruction(currentFunc, context.loop_entry_label);
-
-    // 生成跳转到入口标签的指令
-    node->blockInsts.addInst(new GotoInstruction(currentFunc, loopEntryLabel));
+    // 生成跳转到当前循环入口标签的指令
+    emit(new GotoInstruction(currentFunc, loop_contexts.top().entryLabel));
     return true;
 }
 
-bool IRGenerator::ir_and(ast_node * node)
+/// @brief 条件表达式翻译成跳转代码，为真跳转到trueLabel，为假跳转到falseLabel
+/// @param node 条件表达式AST节点
+/// @param trueLabel 条件为真的跳转目标
+/// @param falseLabel 条件为假的跳转目标
+/// @return 翻译是否成功，true：成功，false：失败
+bool IRGenerator::ir_cond(ast_node * node, LabelInstruction * trueLabel, LabelInstruction * falseLabel)
 {
     Function * currentFunc = module->getCurrentFunction();
-    if (!currentFunc)
+
+    switch (node->node_type) {
+        case ast_operator_type::AST_OP_AND:
+        case ast_operator_type::AST_OP_OR: {
+
+            // 短路求值：&&的左操作数为假、||的左操作数为真时直接跳转，否则计算右操作数
+            bool isAnd = node->node_type == ast_operator_type::AST_OP_AND;
+            auto rightLabel = new LabelInstruction(currentFunc, generateLabel());
+
+            ast_node * left = node->sons[0];
+            ast_node * right = node->sons[1];
+
+            if (!ir_cond(left, isAnd ? rightLabel : trueLabel, isAnd ? falseLabel : rightLabel)) {
+                return false;
+            }
+
+            emit(rightLabel);
+            if (!ir_cond(right, trueLabel, falseLabel)) {
+                return false;
+            }
+
+            return true;
+        }
+        case ast_operator_type::AST_OP_NOT: {
+
+            // 交换真假出口
+            ast_node * son = node->sons[0];
+            if (!ir_cond(son, falseLabel, trueLabel)) {
+                return false;
+            }
+
+            return true;
+        }
+        default:
+            break;
+    }
+
+    // 关系表达式以及其它表达式先求值
+    if (!ir_visit_ast_node(node)) {
         return false;
+    }
 
-    std::string left_true_label = generateLabel();
-    std::string left_false_label = generateLabel();
-    std::string end_label = generateLabel();
-
-    // 左操作数：计算后若为假，跳转到false_label
-    ast_node * left = node->sons[0];
-    ir_visit_ast_node(left);
-    node->blockInsts.addInst(left->blockInsts);
-    auto falseLabel = new LabelInstruction(currentFunc, left_false_label);
-    node->blockInsts.addInst(new BranchInstruction(currentFunc, IRInstOperator::IRINST_OP_BF, left->val, falseLabel));
-
-    // 左操作数为真，计算右操作数
-    auto trueLabel = new LabelInstruction(currentFunc, left_true_label);
-    node->blockInsts.addInst(trueLabel);
-    auto endLabel = new LabelInstruction(currentFunc, end_label);
-    ast_node * right = node->sons[1];
-    ir_visit_ast_node(right);
-    node->blockInsts.addInst(right->blockInsts);
-    // 右操作数若为假，跳转到false_label
-    node->blockInsts.addInst(new BranchInstruction(currentFunc, IRInstOperator::IRINST_OP_BF, right->val, falseLabel));
+    Value * cond = info(node).val;
 
-    // 结果为真
-    node->blockInsts.addInst(trueLabel); // 复用左操作数的trueLabel
-    LocalVariable * result = static_cast<LocalVariable *>(module->newVarValue(IntegerType::getTypeInt()));
-    node->blockInsts.addInst(new MoveInstruction(currentFunc, result, new ConstInt(1)));
-    node->blockInsts.addInst(new GotoInstruction(currentFunc, endLabel));
+    // 常量条件直接跳转
+    Instanceof(constCond, ConstInt *, cond);
+    if (constCond) {
+        emit(new GotoInstruction(currentFunc, constCond->getVal() ? trueLabel : falseLabel));
+        return true;
+    }
 
-    // 结果为假
-    node->blockInsts.addInst(falseLabel);
-    node->blockInsts.addInst(new MoveInstruction(currentFunc, result, new ConstInt(0)));
-    node->blockInsts.addInst(new GotoInstruction(currentFunc, endLabel));
+    // 整数值与0比较得到条件
+    if (!cond->getType()->isInt1Byte()) {
+        BinaryInstruction * cmpInst = new BinaryInstruction(currentFunc,
+                                                            IRInstOperator::IRINST_OP_NE_I,
+                                                            cond,
+                                                            module->newConstInt(0),
+                                                            IntegerType::getTypeBool());
+        emit(cmpInst);
+        cond = cmpInst;
+    }
+
+    emit(new BranchInstruction(currentFunc, IRInstOperator::IRINST_OP_BC, cond, trueLabel, falseLabel));
 
-    // 结束标签
-    node->blockInsts.addInst(new LabelInstruction(currentFunc, end_label));
-    node->val = result;
     return true;
 }
 
-bool IRGenerator::ir_or(ast_node * node)
+/// @brief 逻辑运算作为值使用时，通过跳转代码给结果变量赋值1或0
+/// @param node AST节点
+/// @return 翻译是否成功，true：成功，false：失败
+bool IRGenerator::ir_logic_value(ast_node * node)
 {
     Function * currentFunc = module->getCurrentFunction();
     if (!currentFunc)
         return false;
 
-    std::string left_true_label = generateLabel();
-    std::string left_false_label = generateLabel();
-    std::string end_label = generateLabel();
-
-    // 左操作数：计算后若为真，跳转到true_label
-    ast_node * left = node->sons[0];
-    ir_visit_ast_node(left);
-    node->blockInsts.addInst(left->blockInsts);
-    auto trueLabel = new LabelInstruction(currentFunc, left_true_label);
-    node->blockInsts.addInst(new BranchInstruction(currentFunc, IRInstOperator::IRINST_OP_BT, left->val, trueLabel));
-
-    // 左操作数为假，计算右操作数
-    auto falseLabel = new LabelInstruction(currentFunc, left_false_label);
-    auto endLabel = new LabelInstruction(currentFunc, end_label);
-    node->blockInsts.addInst(falseLabel);
-    ast_node * right = node->sons[1];
-    ir_visit_ast_node(right);
-    node->blockInsts.addInst(right->blockInsts);
-    // 右操作数若为真，跳转到true_label
-    node->blockInsts.addInst(new BranchInstruction(currentFunc, IRInstOperator::IRINST_OP_BT, right->val, trueLabel));
+    auto trueLabel = new LabelInstruction(currentFunc, generateLabel());
+    auto falseLabel = new LabelInstruction(currentFunc, generateLabel());
+    auto endLabel = new LabelInstruction(currentFunc, generateLabel());
+
+    if (!ir_cond(node, trueLabel, falseLabel)) {
+        return false;
+    }
 
-    // 结果为真
-    node->blockInsts.addInst(trueLabel);
     LocalVariable * result = static_cast<LocalVariable *>(module->newVarValue(IntegerType::getTypeInt()));
-    node->blockInsts.addInst(new MoveInstruction(currentFunc, result, new ConstInt(1)));
-    node->blockInsts.addInst(new GotoInstruction(currentFunc, endLabel));
+
+    // 结果为真
+    emit(trueLabel);
+    emit(new MoveInstruction(currentFunc, result, module->newConstInt(1)));
+    emit(new GotoInstruction(currentFunc, endLabel));
 
     // 结果为假
-    node->blockInsts.addInst(new LabelInstruction(currentFunc, end_label));
-    node->blockInsts.addInst(new MoveInstruction(currentFunc, result, new ConstInt(0)));
+    emit(falseLabel);
+    emit(new MoveInstruction(currentFunc, result, module->newConstInt(0)));
+    emit(new GotoInstruction(currentFunc, endLabel));
+
+    // 结束标签
+    emit(endLabel);
+    info(node).val = result;
 
-    node->val = result;
     return true;
 }
 
+/// @brief 逻辑与AST节点作为值使用时翻译成线性中间IR
+/// @param node AST节点
+/// @return 翻译是否成功，true：成功，false：失败
+bool IRGenerator::ir_and(ast_node * node)
+{
+    return ir_logic_value(node);
+}
+
+/// @brief 逻辑或AST节点作为值使用时翻译成线性中间IR
+/// @param node AST节点
+/// @return 翻译是否成功，true：成功，false：失败
+bool IRGenerator::ir_or(ast_node * node)
+{
+    return ir_logic_value(node);
+}
+
+/// @brief 逻辑非AST节点作为值使用时翻译成线性中间IR
+/// @param node AST节点
+/// @return 翻译是否成功，true：成功，false：失败
 bool IRGenerator::ir_not(ast_node * node)
 {
-    Function * currentFunc = module->getCurrentFunction();
-    if (!currentFunc)
-        return false;
-    // 交换真假出口标签
-    std::swap(node->true_label, node->false_label);
-    // 递归处理操作数
-    return ir_visit_ast_node(node->sons[0]);
+    return ir_logic_value(node);
 }
 
 // 等于（==）
@@ -661,21 +707,63 @@ bool IRGenerator::ir_relop(ast_node * node, IRInstOperator op)
     if (!left || !right)
         return false;
 
+    // 两个操作数都是常量时比较结果也是常量
+    info(node).val = foldBinary(op, info(left).val, info(right).val);
+    if (info(node).val) {
+        return true;
+    }
+
     // 生成比较指令，直接将指令作为结果值
     BinaryInstruction * cmpInst =
-        new BinaryInstruction(currentFunc, op, left->val, right->val, IntegerType::getTypeBool());
-
-    // 将子节点的指令和当前比较指令添加到block中
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(cmpInst);
+        new BinaryInstruction(currentFunc, op, info(left).val, info(right).val, IntegerType::getTypeBool());
+    emit(cmpInst);
 
     // 直接将指令作为结果值
-    node->val = cmpInst;
+    info(node).val = cmpInst;
 
     return true;
 }
 
+/// @brief 两个操作数都是整数常量时直接计算运算结果，不再产生指令
+/// @param op 指令操作码
+/// @param left 左操作数
+/// @param right 右操作数
+/// @return 结果常量，不能折叠时返回nullptr
+Value * IRGenerator::foldBinary(IRInstOperator op, Value * left, Value * right)
+{
+    Instanceof(leftConst, ConstInt *, left);
+    Instanceof(rightConst, ConstInt *, right);
+    if (!leftConst || !rightConst) {
+        return nullptr;
+    }
+
+    int32_t result;
+    if (!ConstantFolder::foldBinary(op, leftConst->getVal(), rightConst->getVal(), result)) {
+        return nullptr;
+    }
+
+    return module->newConstInt(result);
+}
+
+/// @brief 操作数是整数常量时直接计算运算结果，不再产生指令
+/// @param op 指令操作码
+/// @param src 操作数
+/// @return 结果常量，不能折叠时返回nullptr
+Value * IRGenerator::foldUnary(IRInstOperator op, Value * src)
+{
+    Instanceof(srcConst, ConstInt *, src);
+    if (!srcConst) {
+        return nullptr;
+    }
+
+    int32_t result;
+    if (!ConstantFolder::foldUnary(op, srcConst->getVal(), result)) {
+        return nullptr;
+    }
+
+    return module->newConstInt(result);
+}
+
 /// @brief 整数加法AST节点翻译成线性中间IR
 /// @param node AST节点
 /// @return 翻译是否成功，true：成功，false：失败
@@ -702,18 +790,23 @@ bool IRGenerator::ir_add(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
+    // 两个操作数都是常量时直接计算结果
+    Value * folded = foldBinary(IRInstOperator::IRINST_OP_ADD_I, info(left).val, info(right).val);
+    if (folded) {
+        info(node).val = folded;
+        return true;
+    }
+
     BinaryInstruction * addInst = new BinaryInstruction(module->getCurrentFunction(),
                                                         IRInstOperator::IRINST_OP_ADD_I,
-                                                        left->val,
-                                                        right->val,
+                                                        info(left).val,
+                                                        info(right).val,
                                                         IntegerType::getTypeInt());
 
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(addInst);
+    emit(addInst);
 
-    node->val = addInst;
+    info(node).val = addInst;
 
     return true;
 }
@@ -744,18 +837,23 @@ bool IRGenerator::ir_sub(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
+    // 两个操作数都是常量时直接计算结果
+    Value * folded = foldBinary(IRInstOperator::IRINST_OP_SUB_I, info(left).val, info(right).val);
+    if (folded) {
+        info(node).val = folded;
+        return true;
+    }
+
     BinaryInstruction * subInst = new BinaryInstruction(module->getCurrentFunction(),
                                                         IRInstOperator::IRINST_OP_SUB_I,
-                                                        left->val,
-                                                        right->val,
+                                                        info(left).val,
+                                                        info(right).val,
                                                         IntegerType::getTypeInt());
 
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(subInst);
+    emit(subInst);
 
-    node->val = subInst;
+    info(node).val = subInst;
 
     return true;
 }
@@ -774,16 +872,21 @@ bool IRGenerator::ir_mul(ast_node * node)
     if (!right)
         return false;
 
+    // 两个操作数都是常量时直接计算结果
+    Value * folded = foldBinary(IRInstOperator::IRINST_OP_MUL_I, info(left).val, info(right).val);
+    if (folded) {
+        info(node).val = folded;
+        return true;
+    }
+
     BinaryInstruction * mulInst = new BinaryInstruction(module->getCurrentFunction(),
                                                         IRInstOperator::IRINST_OP_MUL_I,
-                                                        left->val,
-                                                        right->val,
+                                                        info(left).val,
+                                                        info(right).val,
                                                         IntegerType::getTypeInt());
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(mulInst);
-    node->val = mulInst;
+    emit(mulInst);
+    info(node).val = mulInst;
     return true;
 }
 
@@ -801,16 +904,21 @@ bool IRGenerator::ir_div(ast_node * node)
     if (!right)
         return false;
 
+    // 两个操作数都是常量时直接计算结果
+    Value * folded = foldBinary(IRInstOperator::IRINST_OP_DIV_I, info(left).val, info(right).val);
+    if (folded) {
+        info(node).val = folded;
+        return true;
+    }
+
     BinaryInstruction * divInst = new BinaryInstruction(module->getCurrentFunction(),
                                                         IRInstOperator::IRINST_OP_DIV_I,
-                                                        left->val,
-                                                        right->val,
+                                                        info(left).val,
+                                                        info(right).val,
                                                         IntegerType::getTypeInt());
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(divInst);
-    node->val = divInst;
+    emit(divInst);
+    info(node).val = divInst;
     return true;
 }
 
@@ -828,16 +936,21 @@ bool IRGenerator::ir_mod(ast_node * node)
     if (!right)
         return false;
 
+    // 两个操作数都是常量时直接计算结果
+    Value * folded = foldBinary(IRInstOperator::IRINST_OP_MOD_I, info(left).val, info(right).val);
+    if (folded) {
+        info(node).val = folded;
+        return true;
+    }
+
     BinaryInstruction * modInst = new BinaryInstruction(module->getCurrentFunction(),
                                                         IRInstOperator::IRINST_OP_MOD_I,
-                                                        left->val,
-                                                        right->val,
+                                                        info(left).val,
+                                                        info(right).val,
                                                         IntegerType::getTypeInt());
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(modInst);
-    node->val = modInst;
+    emit(modInst);
+    info(node).val = modInst;
     return true;
 }
 
@@ -853,14 +966,21 @@ bool IRGenerator::ir_neg(ast_node * node)
     ast_node * operand = ir_visit_ast_node(src_node);
     if (!operand)
         return false;
+
+    // 操作数是常量时直接计算结果
+    Value * folded = foldUnary(IRInstOperator::IRINST_OP_NEG_I, info(operand).val);
+    if (folded) {
+        info(node).val = folded;
+        return true;
+    }
+
     UnaryInstruction * negInst = new UnaryInstruction(module->getCurrentFunction(),
                                                       IRInstOperator::IRINST_OP_NEG_I,
-                                                      operand->val,
+                                                      info(operand).val,
                                                       IntegerType::getTypeInt());
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(operand->blockInsts);
-    node->blockInsts.addInst(negInst);
-    node->val = negInst;
+    emit(negInst);
+    info(node).val = negInst;
     return true;
 }
 
@@ -872,34 +992,32 @@ bool IRGenerator::ir_assign(ast_node * node)
     ast_node * son1_node = node->sons[0];
     ast_node * son2_node = node->sons[1];
 
-    // 赋值节点，自右往左运算
+    // 赋值节点，自右往左运算，指令按运算的次序直接加入到当前函数中
 
-    // 赋值运算符的左侧操作数
-    ast_node * left = ir_visit_ast_node(son1_node);
-    if (!left) {
+    // 赋值运算符的右侧操作数
+    ast_node * right = ir_visit_ast_node(son2_node);
+    if (!right) {
         // 某个变量没有定值
-        // 这里缺省设置变量不存在则创建，因此这里不会错误
         return false;
     }
 
-    // 赋值运算符的右侧操作数
-    ast_node * right = ir_visit_ast_node(son2_node);
-    if (!right) {
+    // 赋值运算符的左侧操作数
+    ast_node * left = ir_visit_ast_node(son1_node);
+    if (!left) {
         // 某个变量没有定值
+        // 这里缺省设置变量不存在则创建，因此这里不会错误
         return false;
     }
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
-    MoveInstruction * movInst = new MoveInstruction(module->getCurrentFunction(), left->val, right->val);
+    MoveInstruction * movInst = new MoveInstruction(module->getCurrentFunction(), info(left).val, info(right).val);
 
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(movInst);
+    emit(movInst);
 
     // 这里假定赋值的类型是一致的
-    node->val = movInst;
+    info(node).val = movInst;
 
     return true;
 }
@@ -916,7 +1034,7 @@ bool IRGenerator::ir_return(ast_node * node)
 
         ast_node * son_node = node->sons[0];
 
-        // 返回的表达式的指令保存在right节点中
+        // 返回的表达式的指令直接加入到当前函数中
         right = ir_visit_ast_node(son_node);
         if (!right) {
 
@@ -928,23 +1046,20 @@ bool IRGenerator::ir_return(ast_node * node)
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
     Function * currentFunc = module->getCurrentFunction();
 
-    // 返回值存在时则移动指令到node中
+    // 返回值存在时赋值到返回值变量
     if (right) {
 
-        // 创建临时变量保存IR的值，以及线性IR指令
-        node->blockInsts.addInst(right->blockInsts);
-
         // 返回值赋值到函数返回值变量上，然后跳转到函数的尾部
-        node->blockInsts.addInst(new MoveInstruction(currentFunc, currentFunc->getReturnValue(), right->val));
+        emit(new MoveInstruction(currentFunc, currentFunc->getReturnValue(), info(right).val));
 
-        node->val = right->val;
+        info(node).val = info(right).val;
     } else {
         // 没有返回值
-        node->val = nullptr;
+        info(node).val = nullptr;
     }
 
     // 跳转到函数的尾部出口指令上
-    node->blockInsts.addInst(new GotoInstruction(currentFunc, currentFunc->getExitLabel()));
+    emit(new GotoInstruction(currentFunc, currentFunc->getExitLabel()));
 
     return true;
 }
@@ -969,9 +1084,9 @@ bool IRGenerator::ir_leaf_node_var_id(ast_node * node)
     // 查找ID型Value
     // 变量，则需要在符号表中查找对应的值
 
-    val = module->findVarValue(node->name);
+    val = module->findVarValue(node->getName());
 
-    node->val = val;
+    info(node).val = val;
 
     return true;
 }
@@ -986,7 +1101,7 @@ bool IRGenerator::ir_leaf_node_uint(ast_node * node)
     // 新建一个整数常量Value
     val = module->newConstInt((int32_t) node->integer_val);
 
-    node->val = val;
+    info(node).val = val;
 
     return true;
 }
@@ -1019,7 +1134,7 @@ bool IRGenerator::ir_variable_declare(ast_node * node)
 
     // TODO 这里可强化类型等检查
 
-    node->val = module->newVarValue(node->sons[0]->type, node->sons[1]->name);
+    info(node).val = module->newVarValue(node->sons[0]->type, node->sons[1]->getName());
 
     return true;
 }
\ No newline at end of file
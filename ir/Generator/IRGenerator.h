@@ -18,8 +18,10 @@
 
 #include <unordered_map>
 #include <stack>
+#include <vector>
 #include "AST.h"
 #include "Module.h"
+#include "LabelInstruction.h"
 
 /// @brief AST遍历产生线性IR类
 class IRGenerator {
@@ -63,14 +65,43 @@ protected:
     /// @return 翻译是否成功，true：成功，false：失败
     bool ir_block(ast_node * node);
 
+    /// @brief if语句AST节点翻译成线性中间IR，条件直接翻译为跳转
+    /// @param node AST节点
+    /// @return 翻译是否成功，true：成功，false：失败
     bool ir_if(ast_node * node);
-    /// @brief 语句块中的whileAST节点翻译成线性中间IR
+
+    /// @brief while语句AST节点翻译成线性中间IR，条件直接翻译为跳转
+    /// @param node AST节点
+    /// @return 翻译是否成功，true：成功，false：失败
     bool ir_while(ast_node * node);
     bool ir_break(ast_node * node);
     bool ir_continue(ast_node * node);
 
+    /// @brief 条件表达式翻译成跳转代码，为真跳转到trueLabel，为假跳转到falseLabel
+    /// @param node 条件表达式AST节点，产生的指令保存在该节点中
+    /// @param trueLabel 条件为真的跳转目标
+    /// @param falseLabel 条件为假的跳转目标
+    /// @return 翻译是否成功，true：成功，false：失败
+    bool ir_cond(ast_node * node, LabelInstruction * trueLabel, LabelInstruction * falseLabel);
+
+    /// @brief 逻辑运算作为值使用时，通过跳转代码给结果变量赋值1或0
+    /// @param node AST节点
+    /// @return 翻译是否成功，true：成功，false：失败
+    bool ir_logic_value(ast_node * node);
+
+    /// @brief 逻辑与AST节点作为值使用时翻译成线性中间IR
+    /// @param node AST节点
+    /// @return 翻译是否成功，true：成功，false：失败
     bool ir_and(ast_node * node);
+
+    /// @brief 逻辑或AST节点作为值使用时翻译成线性中间IR
+    /// @param node AST节点
+    /// @return 翻译是否成功，true：成功，false：失败
     bool ir_or(ast_node * node);
+
+    /// @brief 逻辑非AST节点作为值使用时翻译成线性中间IR
+    /// @param node AST节点
+    /// @return 翻译是否成功，true：成功，false：失败
     bool ir_not(ast_node * node);
 
     bool ir_relop(ast_node * node, IRInstOperator op);
@@ -159,6 +190,40 @@ protected:
     /// @return 成功返回node节点，否则返回nullptr
     ast_node * ir_visit_ast_node(ast_node * node);
 
+    /// @brief 两个操作数都是整数常量时直接计算运算结果，不再产生指令
+    /// @param op 指令操作码
+    /// @param left 左操作数
+    /// @param right 右操作数
+    /// @return 结果常量，不能折叠时返回nullptr
+    Value * foldBinary(IRInstOperator op, Value * left, Value * right);
+
+    /// @brief 操作数是整数常量时直接计算运算结果，不再产生指令
+    /// @param op 指令操作码
+    /// @param src 操作数
+    /// @return 结果常量，不能折叠时返回nullptr
+    Value * foldUnary(IRInstOperator op, Value * src);
+
+    /// @brief AST节点在线性IR产生过程中的信息，不放在AST节点中
+    struct NodeInfo {
+        /// @brief 线性IR指令或者运行产生的Value
+        Value * val = nullptr;
+
+        /// @brief 在进入block等节点时是否要进行作用域管理。默认要做。
+        bool needScope = true;
+    };
+
+    /// @brief 获取AST节点在线性IR产生过程中的信息
+    /// @param node AST节点
+    /// @return 节点的信息
+    NodeInfo & info(ast_node * node)
+    {
+        return nodeInfos[node->id];
+    }
+
+    /// @brief 指令加入到当前函数的指令序列尾部
+    /// @param inst 指令
+    void emit(Instruction * inst);
+
     /// @brief AST的节点操作函数
     typedef bool (IRGenerator::*ast2ir_handler_t)(ast_node *);
 
@@ -171,10 +236,14 @@ private:
 
     /// @brief 符号表:模块
     Module * module;
+
+    /// @brief AST节点的信息，以节点编号为下标，构造时按节点个数分配，不再扩容
+    std::vector<NodeInfo> nodeInfos;
+
+    /// @brief 循环上下文，break跳转到出口，continue跳转到入口
     struct LoopContext {
-        std::string loop_entry_label;
-        std::string loop_body_label;
-        std::string loop_exit_label;
+        LabelInstruction * entryLabel;
+        LabelInstruction * exitLabel;
     };
 
     std::stack<LoopContext> loop_contexts; // 循环上下文栈
@@ -11,6 +11,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-15 <td>1.1     <td>agent   <td>指令序列改为侵入式双向链表
 /// </table>
 ///
 #include "IRCode.h"
@@ -25,41 +26,137 @@ InterCode::~InterCode()
 /// @param block 指令块，请注意加入后会自动清空block的指令
 void InterCode::addInst(InterCode & block)
 {
-    std::vector<Instruction *> & insert = block.getInsts();
+    if (block.empty()) {
+        return;
+    }
 
-    code.insert(code.end(), insert.begin(), insert.end());
+    // 整个链表接到尾部
+    block.head->prevInst = tail;
+    if (tail) {
+        tail->nextInst = block.head;
+    } else {
+        head = block.head;
+    }
+    tail = block.tail;
+    count += block.count;
+    modCount++;
 
     // InterCode析构会清理资源，因此移动指令到code中后必须清理，否则会释放多次导致程序例外
-    // 当然，这里也可不清理，但InterCode的析构函数不能清理，需专门的函数清理即可。
-    insert.clear();
+    block.head = nullptr;
+    block.tail = nullptr;
+    block.count = 0;
 }
 
 /// @brief 添加一条中间指令
 /// @param inst IR指令
 void InterCode::addInst(Instruction * inst)
 {
-    code.push_back(inst);
+    insert(end(), inst);
+}
+
+/// @brief 在指定位置之前插入指令
+/// @param pos 插入位置
+/// @param inst IR指令
+/// @return iterator 指向插入指令的迭代器
+InterCode::iterator InterCode::insert(iterator pos, Instruction * inst)
+{
+    insertBefore(*pos, inst);
+    return iterator(this, inst);
+}
+
+/// @brief 在指定指令之前插入指令
+/// @param pos 序列中的指令，nullptr时加入到尾部
+/// @param inst IR指令
+void InterCode::insertBefore(Instruction * pos, Instruction * inst)
+{
+    Instruction * prev = pos ? pos->prevInst : tail;
+
+    inst->prevInst = prev;
+    inst->nextInst = pos;
+
+    if (prev) {
+        prev->nextInst = inst;
+    } else {
+        head = inst;
+    }
+
+    if (pos) {
+        pos->prevInst = inst;
+    } else {
+        tail = inst;
+    }
+
+    count++;
+    modCount++;
+}
+
+/// @brief 在指定指令之后插入指令
+/// @param pos 序列中的指令
+/// @param inst IR指令
+void InterCode::insertAfter(Instruction * pos, Instruction * inst)
+{
+    insertBefore(pos->nextInst, inst);
+}
+
+/// @brief 从序列中移除指令，指令不释放
+/// @param pos 要移除的位置
+/// @return iterator 下一条指令的迭代器
+InterCode::iterator InterCode::erase(iterator pos)
+{
+    Instruction * next = (*pos)->nextInst;
+    remove(*pos);
+    return iterator(this, next);
+}
+
+/// @brief 从序列中移除指令，指令不释放
+/// @param inst 序列中的指令
+void InterCode::remove(Instruction * inst)
+{
+    if (inst->prevInst) {
+        inst->prevInst->nextInst = inst->nextInst;
+    } else {
+        head = inst->nextInst;
+    }
+
+    if (inst->nextInst) {
+        inst->nextInst->prevInst = inst->prevInst;
+    } else {
+        tail = inst->prevInst;
+    }
+
+    inst->prevInst = nullptr;
+    inst->nextInst = nullptr;
+
+    count--;
+    modCount++;
 }
 
-/// @brief 获取指令序列
-/// @return 指令序列
-std::vector<Instruction *> & InterCode::getInsts()
+/// @brief 移除所有指令，指令不释放
+void InterCode::clear()
 {
-    return code;
+    while (head) {
+        remove(head);
+    }
 }
 
 /// @brief 删除所有指令
 void InterCode::Delete()
 {
     // 不能直接删除指令，需要先清除操作数
-    for (auto inst: code) {
+    for (Instruction * inst = head; inst; inst = inst->nextInst) {
         inst->clearOperands();
     }
 
     // 资源清理
-    for (auto inst: code) {
+    Instruction * inst = head;
+    while (inst) {
+        Instruction * next = inst->nextInst;
         delete inst;
+        inst = next;
     }
 
-    code.clear();
+    head = nullptr;
+    tail = nullptr;
+    count = 0;
+    modCount++;
 }
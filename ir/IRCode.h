@@ -11,29 +11,107 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-15 <td>1.1     <td>agent   <td>指令序列改为侵入式双向链表
 /// </table>
 ///
 
 #pragma once
 
-#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 
 #include "Instruction.h"
 
+///
 /// @brief 中间IR指令序列管理类
+///
+/// 指令序列为侵入式的双向链表，前后指针保存在指令中，指令同时只能属于一个序列。
+/// 插入与删除都是O(1)的，迭代器指向指令本身，其它指令的插入与删除不会使其失效。
+/// 每次修改都使修改计数加1，控制流图等视图据此判断是否过期。
+///
 class InterCode {
 
-protected:
-    /// @brief 指令块的指令序列
-    std::vector<Instruction *> code;
-
 public:
+    /// @brief 指令序列的双向迭代器
+    class iterator {
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Instruction *;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Instruction **;
+        using reference = Instruction *;
+
+        /// @brief 构造函数
+        /// @param _list 所在的指令序列
+        /// @param _inst 指向的指令，nullptr为尾后位置
+        iterator(InterCode * _list = nullptr, Instruction * _inst = nullptr) : list(_list), inst(_inst)
+        {}
+
+        /// @brief 获取指向的指令
+        Instruction * operator*() const
+        {
+            return inst;
+        }
+
+        /// @brief 移到下一条指令
+        iterator & operator++()
+        {
+            inst = inst->getNext();
+            return *this;
+        }
+
+        /// @brief 移到下一条指令
+        iterator operator++(int)
+        {
+            iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        /// @brief 移到上一条指令，尾后位置移到最后一条指令
+        iterator & operator--()
+        {
+            inst = inst ? inst->getPrev() : list->back();
+            return *this;
+        }
+
+        /// @brief 移到上一条指令，尾后位置移到最后一条指令
+        iterator operator--(int)
+        {
+            iterator old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const iterator & other) const
+        {
+            return inst == other.inst;
+        }
+
+        bool operator!=(const iterator & other) const
+        {
+            return inst != other.inst;
+        }
+
+    private:
+        /// @brief 所在的指令序列
+        InterCode * list;
+
+        /// @brief 指向的指令
+        Instruction * inst;
+    };
+
     /// @brief 构造函数
     InterCode() = default;
 
     /// @brief 析构函数
     ~InterCode();
 
+    InterCode(const InterCode &) = delete;
+    InterCode & operator=(const InterCode &) = delete;
+
     /// @brief 添加一个指令块，添加到尾部，并清除原来指令块的内容
     /// @param block 指令块，请注意加入后会自动清空block的指令
     void addInst(InterCode & block);
@@ -42,10 +120,95 @@ public:
     /// @param inst IR指令
     void addInst(Instruction * inst);
 
-    /// @brief 获取指令序列
-    /// @return 指令序列
-    std::vector<Instruction *> & getInsts();
+    /// @brief 在指定位置之前插入指令
+    /// @param pos 插入位置
+    /// @param inst IR指令
+    /// @return iterator 指向插入指令的迭代器
+    iterator insert(iterator pos, Instruction * inst);
+
+    /// @brief 在指定指令之前插入指令
+    /// @param pos 序列中的指令，nullptr时加入到尾部
+    /// @param inst IR指令
+    void insertBefore(Instruction * pos, Instruction * inst);
+
+    /// @brief 在指定指令之后插入指令
+    /// @param pos 序列中的指令
+    /// @param inst IR指令
+    void insertAfter(Instruction * pos, Instruction * inst);
+
+    /// @brief 从序列中移除指令，指令不释放
+    /// @param pos 要移除的位置
+    /// @return iterator 下一条指令的迭代器
+    iterator erase(iterator pos);
+
+    /// @brief 从序列中移除指令，指令不释放
+    /// @param inst 序列中的指令
+    void remove(Instruction * inst);
+
+    /// @brief 移除所有指令，指令不释放
+    void clear();
+
+    /// @brief 第一条指令的迭代器
+    iterator begin()
+    {
+        return iterator(this, head);
+    }
+
+    /// @brief 尾后位置的迭代器
+    iterator end()
+    {
+        return iterator(this, nullptr);
+    }
+
+    /// @brief 获取指令条数
+    [[nodiscard]] size_t size() const
+    {
+        return count;
+    }
+
+    /// @brief 是否没有指令
+    [[nodiscard]] bool empty() const
+    {
+        return count == 0;
+    }
+
+    /// @brief 获取第一条指令
+    Instruction * front()
+    {
+        return head;
+    }
+
+    /// @brief 获取最后一条指令
+    Instruction * back()
+    {
+        return tail;
+    }
+
+    /// @brief 获取修改计数，指令的插入、删除以及跳转目标的修改都会使其加1
+    [[nodiscard]] uint32_t getModCount() const
+    {
+        return modCount;
+    }
+
+    /// @brief 指令序列之外的修改，如跳转指令改变目标，也会使控制流图过期，需调用该函数
+    void markModified()
+    {
+        modCount++;
+    }
 
     /// @brief 删除所有指令
     void Delete();
+
+protected:
+    /// @brief 第一条指令
+    Instruction * head = nullptr;
+
+    /// @brief 最后一条指令
+    Instruction * tail = nullptr;
+
+    /// @brief 指令条数
+    size_t count = 0;
+
+    /// @brief 修改计数
+    uint32_t modCount = 0;
 };
@@ -11,6 +11,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-15 <td>1.1     <td>agent   <td>指令内嵌指令序列的前后指针
 /// </table>
 ///
 #pragma once
@@ -18,6 +19,7 @@
 #include "User.h"
 
 class Function;
+class InterCode;
 
 /// @brief IR指令操作码
 enum class IRInstOperator : std::int8_t {
@@ -84,6 +86,9 @@ enum class IRInstOperator : std::int8_t {
     /// @brief 关系大于等于指令，二元运算
     IRINST_OP_GE_I,
 
+    /// @brief SSA形式的phi指令，根据前驱基本块选择操作数
+    IRINST_OP_PHI,
+
     /// @brief 最大指令码，也是无效指令
     IRINST_OP_MAX
 };
@@ -141,6 +146,15 @@ public:
         return regId;
     }
 
+    ///
+    /// @brief 设置寄存器编号，寄存器分配后指令的结果值可以寄存器寻址
+    /// @param _regId 寄存器编号
+    ///
+    void setRegId(int32_t _regId) override
+    {
+        this->regId = _regId;
+    }
+
     ///
     /// @brief @brief 如是内存变量型Value，则获取基址寄存器和偏移
     /// @param regId 寄存器编号
@@ -199,7 +213,37 @@ public:
         this->loadRegNo = regId;
     }
 
+    ///
+    /// @brief 获取指令序列中的前一条指令
+    /// @return Instruction* 前一条指令，没有时为nullptr
+    ///
+    Instruction * getPrev()
+    {
+        return prevInst;
+    }
+
+    ///
+    /// @brief 获取指令序列中的后一条指令
+    /// @return Instruction* 后一条指令，没有时为nullptr
+    ///
+    Instruction * getNext()
+    {
+        return nextInst;
+    }
+
 protected:
+    friend class InterCode;
+
+    ///
+    /// @brief 指令序列中的前一条指令，由InterCode维护
+    ///
+    Instruction * prevInst = nullptr;
+
+    ///
+    /// @brief 指令序列中的后一条指令，由InterCode维护
+    ///
+    Instruction * nextInst = nullptr;
+
     ///
     /// @brief IR指令操作码
     ///
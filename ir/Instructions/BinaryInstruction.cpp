@@ -56,6 +56,7 @@ void BinaryInstruction::toString(std::string & str)
         case IRInstOperator::IRINST_OP_DIV_I:
             // 除法指令，二元运算
             str = getIRName() + " = div " + src1->getIRName() + "," + src2->getIRName();
+            break;
         case IRInstOperator::IRINST_OP_MOD_I:
             // 取模指令，二元运算
             str = getIRName() + " = mod " + src1->getIRName() + "," + src2->getIRName();
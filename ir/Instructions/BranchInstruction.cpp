@@ -25,9 +25,11 @@ BranchInstruction::BranchInstruction(Function * _func,
                                      Value * _condVar,
                                      Instruction * _trueTarget,
                                      Instruction * _falseTarget)
-    : Instruction(_func, _op, VoidType::getType()), condVar(_condVar), trueTarget(_trueTarget),
-      falseTarget(_falseTarget), Target(nullptr)
+    : Instruction(_func, _op, VoidType::getType()), trueTarget(_trueTarget), falseTarget(_falseTarget), Target(nullptr)
 {
+    // 条件变量作为操作数，以便维护define-use链
+    addOperand(_condVar);
+
     // 验证条件变量类型为i1
     // assert(condVar->getType() == IntegerType::getTypeInt1() && "条件变量类型必须为i1");
     // assert(_op == IRInstOperator::IRINST_OP_BC && "双向构造函数仅适用于BC指令");
@@ -35,9 +37,11 @@ BranchInstruction::BranchInstruction(Function * _func,
 
 // 单向条件跳转构造函数（bt/bf）
 BranchInstruction::BranchInstruction(Function * _func, IRInstOperator _op, Value * _condVar, Instruction * _Target)
-    : Instruction(_func, _op, VoidType::getType()), condVar(_condVar), trueTarget(nullptr), falseTarget(nullptr),
-      Target(_Target)
+    : Instruction(_func, _op, VoidType::getType()), trueTarget(nullptr), falseTarget(nullptr), Target(_Target)
 {
+    // 条件变量作为操作数，以便维护define-use链
+    addOperand(_condVar);
+
     // 验证条件变量类型为i1
     // assert(condVar->getType() == IntegerType::getTypeInt1() && "条件变量类型必须为i1");
     // assert(_op == IRInstOperator::IRINST_OP_BT ||_op == IRInstOperator::IRINST_OP_BF &&
@@ -46,6 +50,8 @@ BranchInstruction::BranchInstruction(Function * _func, IRInstOperator _op, Value
 
 void BranchInstruction::toString(std::string & str)
 {
+    Value * condVar = getCondVar();
+
     switch (op) {
         case IRInstOperator::IRINST_OP_BC:
             // bc condvar, label X, label Y
@@ -66,9 +72,9 @@ void BranchInstruction::toString(std::string & str)
     }
 }
 
-Value * BranchInstruction::getCondVar() const
+Value * BranchInstruction::getCondVar()
 {
-    return condVar;
+    return getOperand(0);
 }
 
 Instruction * BranchInstruction::getTrueTarget() const
@@ -87,4 +93,22 @@ Instruction * BranchInstruction::getTarget() const
 {
     // assert(op == IRInstOperator::IRINST_OP_BT || op == IRInstOperator::IRINST_OP_BF && "仅BT/BF指令有targetLabel");
     return Target;
-}
\ No newline at end of file
+}
+
+void BranchInstruction::replaceTarget(Instruction * oldTarget, Instruction * newTarget)
+{
+    if (trueTarget == oldTarget) {
+        trueTarget = newTarget;
+    }
+
+    if (falseTarget == oldTarget) {
+        falseTarget = newTarget;
+    }
+
+    if (Target == oldTarget) {
+        Target = newTarget;
+    }
+
+    // 跳转目标改变后控制流图过期
+    func->getInterCode().markModified();
+}
@@ -55,10 +55,10 @@ public:
     void toString(std::string & str) override;
 
     ///
-    /// @brief 获取条件变量
+    /// @brief 获取条件变量，即第一个操作数
     /// @return Value* 条件变量
     ///
-    [[nodiscard]] Value * getCondVar() const;
+    [[nodiscard]] Value * getCondVar();
 
     ///
     /// @brief 获取真跳转目标
@@ -78,8 +78,14 @@ public:
     ///
     [[nodiscard]] Instruction * getTarget() const;
 
+    ///
+    /// @brief 把跳转目标中的指定Label替换为新的Label
+    /// @param oldTarget 原跳转目标
+    /// @param newTarget 新跳转目标
+    ///
+    void replaceTarget(Instruction * oldTarget, Instruction * newTarget);
+
 private:
-    Value * condVar;           ///< 条件变量（类型为i1）
     Instruction * trueTarget;  ///< 真跳转目标（仅用于BC指令）
     Instruction * falseTarget; ///< 假跳转目标（仅用于BC指令）
     Instruction * Target;      ///< 跳转目标（仅用于BT/BF指令）
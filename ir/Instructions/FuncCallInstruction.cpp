@@ -29,7 +29,8 @@ FuncCallInstruction::FuncCallInstruction(Function * _func,
 {
     name = calledFunc->getName();
 
-    // 实参拷贝
+    // 实参拷贝，操作数空间一次分配
+    reserveOperands((int32_t) _srcVal.size());
     for (auto & val: _srcVal) {
         addOperand(val);
     }
@@ -44,3 +44,15 @@ LabelInstruction * GotoInstruction::getTarget() const
 {
     return target;
 }
+
+///
+/// @brief 设置目标Label指令
+/// @param _target 跳转目标
+///
+void GotoInstruction::setTarget(Instruction * _target)
+{
+    target = static_cast<LabelInstruction *>(_target);
+
+    // 跳转目标改变后控制流图过期
+    func->getInterCode().markModified();
+}
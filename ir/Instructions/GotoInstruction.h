@@ -43,6 +43,12 @@ public:
     ///
     [[nodiscard]] LabelInstruction * getTarget() const;
 
+    ///
+    /// @brief 设置目标Label指令
+    /// @param _target 跳转目标
+    ///
+    void setTarget(Instruction * _target);
+
 private:
     ///
     /// @brief 跳转到的目标Label指令
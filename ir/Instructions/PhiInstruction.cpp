@@ -0,0 +1,89 @@
+///
+/// @file PhiInstruction.cpp
+/// @brief SSA形式的phi指令
+///
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，SSA构造引入的phi指令
+/// </table>
+///
+#include "PhiInstruction.h"
+
+///
+/// @brief 构造函数
+/// @param _func 所属函数
+/// @param _type 值的类型
+///
+PhiInstruction::PhiInstruction(Function * _func, Type * _type)
+    : Instruction(_func, IRInstOperator::IRINST_OP_PHI, _type)
+{}
+
+///
+/// @brief 增加一个前驱基本块的值
+/// @param val 值
+/// @param block 前驱基本块开始的Label指令
+///
+void PhiInstruction::addIncoming(Value * val, Instruction * block)
+{
+    addOperand(val);
+    incomingBlocks.push_back(block);
+}
+
+///
+/// @brief 获取指定前驱基本块的值
+/// @param block 前驱基本块开始的Label指令
+/// @return Value* 值，没有该前驱时返回nullptr
+///
+Value * PhiInstruction::getIncomingValue(Instruction * block)
+{
+    for (int32_t k = 0; k < (int32_t) incomingBlocks.size(); ++k) {
+        if (incomingBlocks[k] == block) {
+            return getOperand(k);
+        }
+    }
+
+    return nullptr;
+}
+
+///
+/// @brief 获取前驱基本块的Label指令列表，次序与操作数一致
+/// @return std::vector<Instruction *>& Label指令列表
+///
+std::vector<Instruction *> & PhiInstruction::getIncomingBlocks()
+{
+    return incomingBlocks;
+}
+
+///
+/// @brief 删除指定前驱基本块的值
+/// @param block 前驱基本块开始的Label指令
+///
+void PhiInstruction::removeIncoming(Instruction * block)
+{
+    for (int32_t k = 0; k < (int32_t) incomingBlocks.size(); ++k) {
+        if (incomingBlocks[k] == block) {
+            removeOperand(k);
+            incomingBlocks.erase(incomingBlocks.begin() + k);
+            return;
+        }
+    }
+}
+
+/// @brief 转换成字符串
+/// @param str 转换后的字符串
+void PhiInstruction::toString(std::string & str)
+{
+    // %t = phi i32 [%l1, .L1], [%t2, .L3]
+    str = getIRName() + " = phi " + getType()->toString();
+
+    for (int32_t k = 0; k < (int32_t) incomingBlocks.size(); ++k) {
+        str += (k ? ", [" : " [") + getOperand(k)->getIRName() + ", " + incomingBlocks[k]->getIRName() + "]";
+    }
+}
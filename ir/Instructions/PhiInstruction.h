@@ -0,0 +1,75 @@
+///
+/// @file PhiInstruction.h
+/// @brief SSA形式的phi指令
+///
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，SSA构造引入的phi指令
+/// </table>
+///
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Instruction.h"
+
+class Function;
+
+///
+/// @brief phi指令，位于基本块开始的Label指令之后，值为控制流来自的前驱基本块对应的操作数
+///
+/// 前驱基本块通过其开始的Label指令标识，第k个操作数对应第k个前驱Label。
+///
+class PhiInstruction final : public Instruction {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 所属函数
+    /// @param _type 值的类型
+    ///
+    PhiInstruction(Function * _func, Type * _type);
+
+    ///
+    /// @brief 增加一个前驱基本块的值
+    /// @param val 值
+    /// @param block 前驱基本块开始的Label指令
+    ///
+    void addIncoming(Value * val, Instruction * block);
+
+    ///
+    /// @brief 获取指定前驱基本块的值
+    /// @param block 前驱基本块开始的Label指令
+    /// @return Value* 值，没有该前驱时返回nullptr
+    ///
+    Value * getIncomingValue(Instruction * block);
+
+    ///
+    /// @brief 获取前驱基本块的Label指令列表，次序与操作数一致
+    /// @return std::vector<Instruction *>& Label指令列表
+    ///
+    std::vector<Instruction *> & getIncomingBlocks();
+
+    ///
+    /// @brief 删除指定前驱基本块的值
+    /// @param block 前驱基本块开始的Label指令
+    ///
+    void removeIncoming(Instruction * block);
+
+    /// @brief 转换成字符串
+    void toString(std::string & str) override;
+
+private:
+    ///
+    /// @brief 前驱基本块的Label指令
+    ///
+    std::vector<Instruction *> incomingBlocks;
+};
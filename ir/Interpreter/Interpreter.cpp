@@ -0,0 +1,704 @@
+///
+/// @file Interpreter.cpp
+/// @brief DragonIR的解释执行器的实现
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，--run选项使用的IR解释执行器
+/// </table>
+///
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+#include "Common.h"
+#include "Interpreter.h"
+#include "BranchInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "PhiInstruction.h"
+
+/// @brief 栈的大小，以int32_t为单位
+static const size_t stackSize = 4 * 1024 * 1024;
+
+/// @brief 最大的函数调用深度，执行器递归调用自身，避免本地栈溢出
+static const int32_t maxCallDepth = 20000;
+
+/// @brief 内置函数的名字，下标为内置函数的编号
+static const char * const builtinNames[] = {"putint", "getint", "putch", "getch"};
+
+///
+/// @brief 预译码后的函数
+///
+struct Interpreter::DecodedFunction {
+
+    /// @brief 函数
+    Function * func;
+
+    /// @brief 扁平的指令数组
+    std::vector<InterpInst> code;
+
+    /// @brief 栈帧模板，常量槽位预先填好，其余为0，大小即栈帧的大小
+    std::vector<int32_t> frameTemplate;
+
+    /// @brief 形参的槽位
+    std::vector<int32_t> paramSlots;
+};
+
+///
+/// @brief 构造函数
+/// @param _module 要执行的模块
+///
+Interpreter::Interpreter(Module * _module) : module(_module)
+{}
+
+///
+/// @brief 析构函数
+///
+Interpreter::~Interpreter()
+{
+    for (auto & pair: decodedFunctions) {
+        delete pair.second;
+    }
+}
+
+///
+/// @brief 执行main函数
+/// @param exitCode main函数的返回值
+/// @return true 成功 false 译码或运行时出错
+///
+bool Interpreter::run(int32_t & exitCode)
+{
+    Function * mainFunc = module->findFunction("main");
+    if (!mainFunc || mainFunc->isBuiltin()) {
+        minic_log(LOG_ERROR, "没有找到main函数");
+        return false;
+    }
+
+    // 全局变量目前只有int类型，初值为0
+    globals.clear();
+    globalIndex.clear();
+    for (auto var: module->getGlobalVariables()) {
+        globalIndex[var] = (int32_t) globals.size();
+        globals.push_back(0);
+    }
+
+    // 栈一次分配好，执行过程中不能重新分配，否则栈帧指针会失效
+    stack.assign(stackSize, 0);
+    stackTop = 0;
+    callDepth = 0;
+    executedCount = 0;
+
+    DecodedFunction * decoded = decode(mainFunc);
+    if (!decoded) {
+        return false;
+    }
+
+    bool result = execute(decoded, nullptr, exitCode);
+
+    fflush(output);
+
+    return result;
+}
+
+///
+/// @brief 预译码函数
+/// @param func 函数
+/// @return DecodedFunction* 预译码的结果，失败时为nullptr
+///
+Interpreter::DecodedFunction * Interpreter::decode(Function * func)
+{
+    auto pIter = decodedFunctions.find(func);
+    if (pIter != decodedFunctions.end()) {
+        return pIter->second;
+    }
+
+    auto decoded = new DecodedFunction();
+    decoded->func = func;
+    decodedFunctions[func] = decoded;
+
+    std::vector<InterpInst> & code = decoded->code;
+    std::vector<int32_t> & frame = decoded->frameTemplate;
+
+    // 形参、局部变量以及有值的指令都分配槽位
+    std::unordered_map<Value *, int32_t> slotOf;
+    auto newSlot = [&frame](int32_t init) {
+        frame.push_back(init);
+        return (int32_t) frame.size() - 1;
+    };
+
+    for (auto param: func->getParams()) {
+        slotOf[param] = newSlot(0);
+        decoded->paramSlots.push_back(slotOf[param]);
+    }
+    for (auto var: func->getVarValues()) {
+        slotOf[var] = newSlot(0);
+    }
+
+    InterCode & insts = func->getInterCode();
+
+    // phi指令按所在基本块的Label归类，入口基本块没有Label
+    std::unordered_map<Instruction *, std::vector<PhiInstruction *>> phisOf;
+    Instruction * curLabel = nullptr;
+    for (auto inst: insts) {
+        if (inst->isDead()) {
+            continue;
+        }
+        if (inst->hasResultValue()) {
+            slotOf[inst] = newSlot(0);
+        }
+        if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+            curLabel = inst;
+        } else if (inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+            phisOf[curLabel].push_back(static_cast<PhiInstruction *>(inst));
+        }
+    }
+
+    // 常量共享槽位；全局变量的读取先复制到临时槽位，同一指令的不同操作数用不同的临时槽位
+    std::unordered_map<int32_t, int32_t> constSlots;
+    std::vector<int32_t> scratchSlots;
+    bool ok = true;
+
+    auto use = [&](Value * val, size_t scratch) -> int32_t {
+        if (Instanceof(constVal, ConstInt *, val)) {
+            auto constIter = constSlots.find(constVal->getVal());
+            if (constIter != constSlots.end()) {
+                return constIter->second;
+            }
+            int32_t slot = newSlot(constVal->getVal());
+            constSlots[constVal->getVal()] = slot;
+            return slot;
+        }
+
+        auto globalIter = globalIndex.find(val);
+        if (globalIter != globalIndex.end()) {
+            while (scratchSlots.size() <= scratch) {
+                scratchSlots.push_back(newSlot(0));
+            }
+            code.push_back(InterpInst{InterpOp::LOADG, scratchSlots[scratch], globalIter->second, 0, 0});
+            return scratchSlots[scratch];
+        }
+
+        auto slotIter = slotOf.find(val);
+        if (slotIter == slotOf.end()) {
+            minic_log(LOG_ERROR, "函数%s中的值%s不能解释执行", func->getName().c_str(), val->getIRName().c_str());
+            ok = false;
+            return 0;
+        }
+
+        return slotIter->second;
+    };
+
+    // 控制流从from所在基本块转到to时，to开始的phi指令转换为并行赋值
+    auto emitEdgeCopies = [&](Instruction * from, Instruction * to) {
+        auto phiIter = phisOf.find(to);
+        if (phiIter == phisOf.end()) {
+            return;
+        }
+
+        std::vector<std::pair<int32_t, int32_t>> edgeCopies;
+        for (auto phi: phiIter->second) {
+            Value * src = phi->getIncomingValue(from);
+            if (!src) {
+                minic_log(LOG_ERROR, "函数%s中的phi指令缺少前驱的值", func->getName().c_str());
+                ok = false;
+                continue;
+            }
+            edgeCopies.emplace_back(slotOf[phi], use(src, edgeCopies.size()));
+        }
+
+        code.push_back(InterpInst{InterpOp::PCOPY, -1, (int32_t) copies.size(), (int32_t) edgeCopies.size(), 0});
+        copies.insert(copies.end(), edgeCopies.begin(), edgeCopies.end());
+    };
+
+    // 跳转目标在所有Label的位置确定后回填
+    struct Edge {
+        size_t pc;
+        bool falseTarget;
+        Instruction * from;
+        Instruction * to;
+    };
+    std::vector<Edge> edges;
+    std::unordered_map<Instruction *, int32_t> labelPc;
+
+    // 上一条指令是否无条件转移，否则顺序执行到下一个基本块
+    bool transferred = false;
+    curLabel = nullptr;
+
+    for (auto inst: insts) {
+
+        if (inst->isDead()) {
+            continue;
+        }
+
+        IRInstOperator op = inst->getOp();
+
+        switch (op) {
+            case IRInstOperator::IRINST_OP_ENTRY:
+            case IRInstOperator::IRINST_OP_ARG:
+            case IRInstOperator::IRINST_OP_PHI:
+                break;
+
+            case IRInstOperator::IRINST_OP_LABEL:
+                if (!transferred) {
+                    emitEdgeCopies(curLabel, inst);
+                }
+                labelPc[inst] = (int32_t) code.size();
+                curLabel = inst;
+                transferred = false;
+                break;
+
+            case IRInstOperator::IRINST_OP_GOTO:
+                edges.push_back(Edge{code.size(), false, curLabel, static_cast<GotoInstruction *>(inst)->getTarget()});
+                code.push_back(InterpInst{InterpOp::JMP, -1, 0, 0, 0});
+                transferred = true;
+                curLabel = nullptr;
+                break;
+
+            case IRInstOperator::IRINST_OP_BC:
+            case IRInstOperator::IRINST_OP_BT:
+            case IRInstOperator::IRINST_OP_BF: {
+                auto branch = static_cast<BranchInstruction *>(inst);
+                int32_t cond = use(branch->getCondVar(), 0);
+                if (op == IRInstOperator::IRINST_OP_BC) {
+                    edges.push_back(Edge{code.size(), false, curLabel, branch->getTrueTarget()});
+                    edges.push_back(Edge{code.size(), true, curLabel, branch->getFalseTarget()});
+                    code.push_back(InterpInst{InterpOp::BC, -1, cond, 0, 0});
+                    transferred = true;
+                } else {
+                    edges.push_back(Edge{code.size(), false, curLabel, branch->getTarget()});
+                    InterpOp branchOp = (op == IRInstOperator::IRINST_OP_BT) ? InterpOp::BT : InterpOp::BF;
+                    code.push_back(InterpInst{branchOp, -1, cond, 0, 0});
+                }
+                // 跳转指令之后的基本块没有Label，与BasicBlock::getLabel一致
+                curLabel = nullptr;
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_EXIT: {
+                int32_t retSlot = (inst->getOperandsNum() > 0) ? use(inst->getOperand(0), 0) : -1;
+                code.push_back(InterpInst{InterpOp::RET, -1, retSlot, 0, 0});
+                transferred = true;
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_ASSIGN: {
+                Value * dst = inst->getOperand(0);
+                int32_t src = use(inst->getOperand(1), 0);
+                auto globalIter = globalIndex.find(dst);
+                if (globalIter != globalIndex.end()) {
+                    code.push_back(InterpInst{InterpOp::STOREG, globalIter->second, src, 0, 0});
+                } else {
+                    code.push_back(InterpInst{InterpOp::MOV, use(dst, 1), src, 0, 0});
+                }
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_NEG_I:
+            case IRInstOperator::IRINST_OP_NOT_I: {
+                int32_t src = use(inst->getOperand(0), 0);
+                InterpOp unaryOp = (op == IRInstOperator::IRINST_OP_NEG_I) ? InterpOp::NEG : InterpOp::NOT;
+                code.push_back(InterpInst{unaryOp, slotOf[inst], src, 0, 0});
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_FUNC_CALL: {
+                auto callInst = static_cast<FuncCallInstruction *>(inst);
+                Function * callee = callInst->calledFunction;
+
+                CallSite site{callee, nullptr, -1, (int32_t) argSlots.size(), callInst->getOperandsNum()};
+                if (callee->isBuiltin()) {
+                    for (int32_t k = 0; k < (int32_t) (sizeof(builtinNames) / sizeof(builtinNames[0])); ++k) {
+                        if (callee->getName() == builtinNames[k]) {
+                            site.builtin = k;
+                        }
+                    }
+                    if (site.builtin < 0) {
+                        minic_log(LOG_ERROR, "内置函数%s不能解释执行", callee->getName().c_str());
+                        ok = false;
+                    }
+                }
+
+                for (int32_t k = 0; k < callInst->getOperandsNum(); ++k) {
+                    argSlots.push_back(use(callInst->getOperand(k), k));
+                }
+
+                int32_t dst = callInst->hasResultValue() ? slotOf[inst] : -1;
+                code.push_back(InterpInst{InterpOp::CALL, dst, (int32_t) calls.size(), 0, 0});
+                calls.push_back(site);
+                break;
+            }
+
+            default: {
+                // 二元运算
+                InterpOp binaryOp;
+                switch (op) {
+                    case IRInstOperator::IRINST_OP_ADD_I:
+                        binaryOp = InterpOp::ADD;
+                        break;
+                    case IRInstOperator::IRINST_OP_SUB_I:
+                        binaryOp = InterpOp::SUB;
+                        break;
+                    case IRInstOperator::IRINST_OP_MUL_I:
+                        binaryOp = InterpOp::MUL;
+                        break;
+                    case IRInstOperator::IRINST_OP_DIV_I:
+                        binaryOp = InterpOp::DIV;
+                        break;
+                    case IRInstOperator::IRINST_OP_MOD_I:
+                        binaryOp = InterpOp::MOD;
+                        break;
+                    case IRInstOperator::IRINST_OP_AND_I:
+                        binaryOp = InterpOp::AND;
+                        break;
+                    case IRInstOperator::IRINST_OP_OR_I:
+                        binaryOp = InterpOp::OR;
+                        break;
+                    case IRInstOperator::IRINST_OP_EQ_I:
+                        binaryOp = InterpOp::EQ;
+                        break;
+                    case IRInstOperator::IRINST_OP_NE_I:
+                        binaryOp = InterpOp::NE;
+                        break;
+                    case IRInstOperator::IRINST_OP_LT_I:
+                        binaryOp = InterpOp::LT;
+                        break;
+                    case IRInstOperator::IRINST_OP_LE_I:
+                        binaryOp = InterpOp::LE;
+                        break;
+                    case IRInstOperator::IRINST_OP_GT_I:
+                        binaryOp = InterpOp::GT;
+                        break;
+                    case IRInstOperator::IRINST_OP_GE_I:
+                        binaryOp = InterpOp::GE;
+                        break;
+                    default:
+                        minic_log(LOG_ERROR, "函数%s中的指令不能解释执行", func->getName().c_str());
+                        ok = false;
+                        continue;
+                }
+
+                int32_t left = use(inst->getOperand(0), 0);
+                int32_t right = use(inst->getOperand(1), 1);
+                code.push_back(InterpInst{binaryOp, slotOf[inst], left, right, 0});
+                break;
+            }
+        }
+    }
+
+    // 没有Exit指令时保证能返回
+    if (!transferred) {
+        code.push_back(InterpInst{InterpOp::RET, -1, -1, 0, 0});
+    }
+
+    // 回填跳转目标，目标基本块有phi指令时经过末尾追加的并行赋值再跳转
+    for (auto & edge: edges) {
+        auto labelIter = labelPc.find(edge.to);
+        if (labelIter == labelPc.end()) {
+            minic_log(LOG_ERROR, "函数%s中的跳转目标不存在", func->getName().c_str());
+            ok = false;
+            continue;
+        }
+
+        int32_t target = labelIter->second;
+        if (phisOf.count(edge.to)) {
+            int32_t stub = (int32_t) code.size();
+            emitEdgeCopies(edge.from, edge.to);
+            code.push_back(InterpInst{InterpOp::JMP, -1, 0, target, 0});
+            target = stub;
+        }
+
+        if (edge.falseTarget) {
+            code[edge.pc].c = target;
+        } else {
+            code[edge.pc].b = target;
+        }
+    }
+
+    if (!ok) {
+        decodedFunctions.erase(func);
+        delete decoded;
+        return nullptr;
+    }
+
+    return decoded;
+}
+
+///
+/// @brief 执行内置函数
+/// @param builtin 内置函数编号
+/// @param args 实参的值
+/// @return int32_t 返回值
+///
+int32_t Interpreter::callBuiltin(int32_t builtin, const int32_t * args)
+{
+    int32_t value = 0;
+
+    switch (builtin) {
+        case 0:
+            // putint
+            fprintf(output, "%d", args[0]);
+            break;
+        case 1:
+            // getint
+            if (fscanf(input, "%d", &value) != 1) {
+                value = 0;
+            }
+            break;
+        case 2:
+            // putch
+            fputc((char) args[0], output);
+            break;
+        case 3:
+            // getch
+            value = fgetc(input);
+            break;
+        default:
+            break;
+    }
+
+    return value;
+}
+
+// 支持GCC的computed goto时每条指令直接跳转到下一条指令的处理代码，否则回到switch分派
+#if defined(__GNUC__)
+#define INTERP_DISPATCH()                                                                                              \
+    do {                                                                                                               \
+        ++count;                                                                                                       \
+        goto * dispatchTable[(uint8_t) ip->op];                                                                        \
+    } while (0)
+#define INTERP_CASE(name)                                                                                              \
+    case InterpOp::name:                                                                                               \
+    op_##name
+#else
+#define INTERP_DISPATCH()                                                                                              \
+    do {                                                                                                               \
+        ++count;                                                                                                       \
+        goto dispatch;                                                                                                 \
+    } while (0)
+#define INTERP_CASE(name) case InterpOp::name
+#endif
+
+///
+/// @brief 执行函数
+/// @param func 预译码后的函数
+/// @param args 实参的值
+/// @param ret 返回值
+/// @return true 成功 false 运行时出错
+///
+bool Interpreter::execute(DecodedFunction * func, const int32_t * args, int32_t & ret)
+{
+    size_t frameSize = func->frameTemplate.size();
+    if ((stackTop + frameSize > stack.size()) || (callDepth >= maxCallDepth)) {
+        minic_log(LOG_ERROR, "函数%s执行时栈溢出", func->func->getName().c_str());
+        return false;
+    }
+
+    // 栈帧从模板复制，常量槽位即已就绪
+    int32_t * frame = stack.data() + stackTop;
+    std::copy(func->frameTemplate.begin(), func->frameTemplate.end(), frame);
+    for (size_t k = 0; k < func->paramSlots.size(); ++k) {
+        frame[func->paramSlots[k]] = args[k];
+    }
+
+    size_t savedTop = stackTop;
+    stackTop += frameSize;
+    callDepth++;
+
+    const InterpInst * code = func->code.data();
+    const InterpInst * ip = code;
+    int32_t * globalValues = globals.data();
+    uint64_t count = 0;
+    bool ok = true;
+    ret = 0;
+
+#if defined(__GNUC__)
+    // 次序与InterpOp一致
+    static const void * const dispatchTable[] = {
+        &&op_MOV, &&op_ADD,   &&op_SUB,    &&op_MUL,   &&op_DIV, &&op_MOD, &&op_AND, &&op_OR,
+        &&op_EQ,  &&op_NE,    &&op_LT,     &&op_LE,    &&op_GT,  &&op_GE,  &&op_NEG, &&op_NOT,
+        &&op_LOADG, &&op_STOREG, &&op_PCOPY, &&op_JMP, &&op_BC,  &&op_BT,  &&op_BF,  &&op_CALL,
+        &&op_RET,
+    };
+    static_assert(sizeof(dispatchTable) / sizeof(dispatchTable[0]) == (size_t) InterpOp::RET + 1,
+                  "dispatchTable与InterpOp不一致");
+#endif
+
+    INTERP_DISPATCH();
+
+#if !defined(__GNUC__)
+dispatch:
+#endif
+    switch (ip->op) {
+        INTERP_CASE(MOV) : frame[ip->dst] = frame[ip->a];
+        ++ip;
+        INTERP_DISPATCH();
+
+        // 加减乘按无符号运算，避免有符号溢出的未定义行为
+        INTERP_CASE(ADD) : frame[ip->dst] = (int32_t) ((uint32_t) frame[ip->a] + (uint32_t) frame[ip->b]);
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(SUB) : frame[ip->dst] = (int32_t) ((uint32_t) frame[ip->a] - (uint32_t) frame[ip->b]);
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(MUL) : frame[ip->dst] = (int32_t) ((uint32_t) frame[ip->a] * (uint32_t) frame[ip->b]);
+        ++ip;
+        INTERP_DISPATCH();
+
+        // 除0为运行时错误，INT32_MIN除以-1与ARM的sdiv一样结果为INT32_MIN
+        INTERP_CASE(DIV) : INTERP_CASE(MOD) :
+        {
+            int32_t left = frame[ip->a];
+            int32_t right = frame[ip->b];
+            if (right == 0) {
+                minic_log(LOG_ERROR, "函数%s执行时除0", func->func->getName().c_str());
+                ok = false;
+                goto done;
+            }
+            int32_t quot = ((left == INT32_MIN) && (right == -1)) ? INT32_MIN : (left / right);
+            frame[ip->dst] = (ip->op == InterpOp::DIV) ? quot : (int32_t) ((uint32_t) left - (uint32_t) quot * right);
+        }
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(AND) : frame[ip->dst] = (frame[ip->a] != 0) && (frame[ip->b] != 0);
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(OR) : frame[ip->dst] = (frame[ip->a] != 0) || (frame[ip->b] != 0);
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(EQ) : frame[ip->dst] = frame[ip->a] == frame[ip->b];
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(NE) : frame[ip->dst] = frame[ip->a] != frame[ip->b];
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(LT) : frame[ip->dst] = frame[ip->a] < frame[ip->b];
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(LE) : frame[ip->dst] = frame[ip->a] <= frame[ip->b];
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(GT) : frame[ip->dst] = frame[ip->a] > frame[ip->b];
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(GE) : frame[ip->dst] = frame[ip->a] >= frame[ip->b];
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(NEG) : frame[ip->dst] = (int32_t) (0u - (uint32_t) frame[ip->a]);
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(NOT) : frame[ip->dst] = frame[ip->a] == 0;
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(LOADG) : frame[ip->dst] = globalValues[ip->a];
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(STOREG) : globalValues[ip->dst] = frame[ip->a];
+        ++ip;
+        INTERP_DISPATCH();
+
+        // 先读出所有的源值再写入，phi指令之间互相引用时也正确
+        INTERP_CASE(PCOPY) :
+        {
+            const std::pair<int32_t, int32_t> * edgeCopies = copies.data() + ip->a;
+            int32_t values[16];
+            std::vector<int32_t> buffer;
+            int32_t * temp = values;
+            if (ip->b > 16) {
+                buffer.resize(ip->b);
+                temp = buffer.data();
+            }
+            for (int32_t k = 0; k < ip->b; ++k) {
+                temp[k] = frame[edgeCopies[k].second];
+            }
+            for (int32_t k = 0; k < ip->b; ++k) {
+                frame[edgeCopies[k].first] = temp[k];
+            }
+        }
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(JMP) : ip = code + ip->b;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(BC) : ip = code + (frame[ip->a] ? ip->b : ip->c);
+        INTERP_DISPATCH();
+
+        INTERP_CASE(BT) : ip = frame[ip->a] ? (code + ip->b) : (ip + 1);
+        INTERP_DISPATCH();
+
+        INTERP_CASE(BF) : ip = frame[ip->a] ? (ip + 1) : (code + ip->b);
+        INTERP_DISPATCH();
+
+        INTERP_CASE(CALL) :
+        {
+            // decode会向calls追加调用点，不能持有calls中元素的引用
+            const CallSite site = calls[ip->a];
+
+            int32_t values[8];
+            std::vector<int32_t> buffer;
+            int32_t * callArgs = values;
+            if (site.argCount > 8) {
+                buffer.resize(site.argCount);
+                callArgs = buffer.data();
+            }
+            for (int32_t k = 0; k < site.argCount; ++k) {
+                callArgs[k] = frame[argSlots[site.argStart + k]];
+            }
+
+            int32_t result = 0;
+            if (site.builtin >= 0) {
+                result = callBuiltin(site.builtin, callArgs);
+            } else {
+                DecodedFunction * decoded = site.decoded;
+                if (!decoded) {
+                    decoded = decode(site.callee);
+                    calls[ip->a].decoded = decoded;
+                }
+                if (!decoded || !execute(decoded, callArgs, result)) {
+                    ok = false;
+                    goto done;
+                }
+            }
+
+            if (ip->dst >= 0) {
+                frame[ip->dst] = result;
+            }
+        }
+        ++ip;
+        INTERP_DISPATCH();
+
+        INTERP_CASE(RET) : if (ip->a >= 0)
+        {
+            ret = frame[ip->a];
+        }
+        goto done;
+    }
+
+done:
+    stackTop = savedTop;
+    callDepth--;
+    executedCount += count;
+
+    return ok;
+}
@@ -0,0 +1,221 @@
+///
+/// @file Interpreter.h
+/// @brief DragonIR的解释执行器，不需要外部的IR运行工具即可验证IR的语义
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，--run选项使用的IR解释执行器
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Module.h"
+
+///
+/// @brief 预译码后的解释器操作码
+///
+enum class InterpOp : uint8_t {
+    /// @brief dst = a
+    MOV,
+    /// @brief dst = a op b，算术运算
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    MOD,
+    /// @brief dst = a op b，逻辑与关系运算，结果为0或1
+    AND,
+    OR,
+    EQ,
+    NE,
+    LT,
+    LE,
+    GT,
+    GE,
+    /// @brief dst = op a
+    NEG,
+    NOT,
+    /// @brief 读全局变量，dst = globals[a]
+    LOADG,
+    /// @brief 写全局变量，globals[dst] = a
+    STOREG,
+    /// @brief 并行赋值，用于phi指令，copies[a]开始的b个
+    PCOPY,
+    /// @brief 无条件跳转到b
+    JMP,
+    /// @brief a非0时跳转到b，否则跳转到c
+    BC,
+    /// @brief a非0时跳转到b，否则顺序执行
+    BT,
+    /// @brief a为0时跳转到b，否则顺序执行
+    BF,
+    /// @brief 函数调用，调用信息为calls[a]，返回值保存到dst，无返回值时dst为-1
+    CALL,
+    /// @brief 返回a，无返回值时a为-1
+    RET,
+};
+
+///
+/// @brief 预译码后的指令，操作数都已解析为栈帧内的槽位编号，跳转目标解析为指令下标
+///
+struct InterpInst {
+
+    /// @brief 操作码
+    InterpOp op;
+
+    /// @brief 结果槽位
+    int32_t dst;
+
+    /// @brief 操作数
+    int32_t a;
+    int32_t b;
+    int32_t c;
+};
+
+///
+/// @brief DragonIR的解释执行器
+///
+/// 函数在第一次调用时预译码为扁平的指令数组：局部变量、形参、临时变量和常量都分配栈帧内的槽位，
+/// 常量在栈帧模板中预先填好；phi指令在每条边上转换为并行赋值；跳转目标转换为数组下标。
+/// 执行时通过computed goto（不支持时采用switch）分派，栈帧在一块连续的栈内分配。
+/// 内置函数putint/getint/putch/getch对接标准输入输出。
+///
+class Interpreter {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _module 要执行的模块
+    ///
+    explicit Interpreter(Module * _module);
+
+    ///
+    /// @brief 析构函数
+    ///
+    ~Interpreter();
+
+    ///
+    /// @brief 设置输入输出，默认为标准输入输出
+    /// @param _input 内置函数getint等的输入
+    /// @param _output 内置函数putint等的输出
+    ///
+    void setIO(FILE * _input, FILE * _output)
+    {
+        input = _input;
+        output = _output;
+    }
+
+    ///
+    /// @brief 执行main函数
+    /// @param exitCode main函数的返回值
+    /// @return true 成功 false 译码或运行时出错
+    ///
+    bool run(int32_t & exitCode);
+
+    ///
+    /// @brief 获取执行的指令条数，用于比较优化前后的效果
+    /// @return uint64_t 指令条数
+    ///
+    [[nodiscard]] uint64_t getExecutedCount() const
+    {
+        return executedCount;
+    }
+
+private:
+    /// @brief 预译码后的函数
+    struct DecodedFunction;
+
+    /// @brief 函数调用信息
+    struct CallSite {
+
+        /// @brief 被调用的函数
+        Function * callee;
+
+        /// @brief 被调用函数的预译码结果，第一次调用时填写
+        DecodedFunction * decoded;
+
+        /// @brief 内置函数的编号，不是内置函数时为-1
+        int32_t builtin;
+
+        /// @brief 实参槽位在argSlots中的开始位置
+        int32_t argStart;
+
+        /// @brief 实参个数
+        int32_t argCount;
+    };
+
+    ///
+    /// @brief 预译码函数
+    /// @param func 函数
+    /// @return DecodedFunction* 预译码的结果，失败时为nullptr
+    ///
+    DecodedFunction * decode(Function * func);
+
+    ///
+    /// @brief 执行函数
+    /// @param func 预译码后的函数
+    /// @param args 实参的值
+    /// @param ret 返回值
+    /// @return true 成功 false 运行时出错
+    ///
+    bool execute(DecodedFunction * func, const int32_t * args, int32_t & ret);
+
+    ///
+    /// @brief 执行内置函数
+    /// @param builtin 内置函数编号
+    /// @param args 实参的值
+    /// @return int32_t 返回值
+    ///
+    int32_t callBuiltin(int32_t builtin, const int32_t * args);
+
+    /// @brief 模块
+    Module * module;
+
+    /// @brief 输入
+    FILE * input = stdin;
+
+    /// @brief 输出
+    FILE * output = stdout;
+
+    /// @brief 全局变量的值
+    std::vector<int32_t> globals;
+
+    /// @brief 全局变量的编号
+    std::unordered_map<Value *, int32_t> globalIndex;
+
+    /// @brief 预译码后的函数
+    std::unordered_map<Function *, DecodedFunction *> decodedFunctions;
+
+    /// @brief 函数调用信息
+    std::vector<CallSite> calls;
+
+    /// @brief 所有调用点的实参槽位
+    std::vector<int32_t> argSlots;
+
+    /// @brief phi指令转换的并行赋值，first为目的槽位，second为源槽位
+    std::vector<std::pair<int32_t, int32_t>> copies;
+
+    /// @brief 栈帧所在的栈
+    std::vector<int32_t> stack;
+
+    /// @brief 栈的当前使用位置
+    size_t stackTop = 0;
+
+    /// @brief 函数调用的深度
+    int32_t callDepth = 0;
+
+    /// @brief 执行的指令条数
+    uint64_t executedCount = 0;
+};
@@ -0,0 +1,123 @@
+///
+/// @file ConstantFolder.cpp
+/// @brief 常量折叠，计算操作数都是常量的运算指令的结果
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，生成IR时折叠操作数都是常量的运算
+/// </table>
+///
+#include <climits>
+
+#include "ConstantFolder.h"
+
+///
+/// @brief 检查指令操作码是否是可折叠的二元运算
+/// @param op 指令操作码
+/// @return true 可折叠
+/// @return false 不可折叠
+///
+bool ConstantFolder::isFoldableBinary(IRInstOperator op)
+{
+    switch (op) {
+        case IRInstOperator::IRINST_OP_ADD_I:
+        case IRInstOperator::IRINST_OP_SUB_I:
+        case IRInstOperator::IRINST_OP_MUL_I:
+        case IRInstOperator::IRINST_OP_DIV_I:
+        case IRInstOperator::IRINST_OP_MOD_I:
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_NE_I:
+        case IRInstOperator::IRINST_OP_LT_I:
+        case IRInstOperator::IRINST_OP_LE_I:
+        case IRInstOperator::IRINST_OP_GT_I:
+        case IRInstOperator::IRINST_OP_GE_I:
+            return true;
+        default:
+            return false;
+    }
+}
+
+///
+/// @brief 计算二元运算的结果
+/// @param op 指令操作码，算术运算或者关系运算
+/// @param left 左操作数
+/// @param right 右操作数
+/// @param result 运算结果，关系运算为0或1
+/// @return true 折叠成功 false 不能折叠
+///
+bool ConstantFolder::foldBinary(IRInstOperator op, int32_t left, int32_t right, int32_t & result)
+{
+    // 加减乘按无符号运算，避免有符号溢出的未定义行为
+    auto uleft = (uint32_t) left;
+    auto uright = (uint32_t) right;
+
+    switch (op) {
+        case IRInstOperator::IRINST_OP_ADD_I:
+            result = (int32_t) (uleft + uright);
+            break;
+        case IRInstOperator::IRINST_OP_SUB_I:
+            result = (int32_t) (uleft - uright);
+            break;
+        case IRInstOperator::IRINST_OP_MUL_I:
+            result = (int32_t) (uleft * uright);
+            break;
+        case IRInstOperator::IRINST_OP_DIV_I:
+        case IRInstOperator::IRINST_OP_MOD_I:
+            if ((right == 0) || ((left == INT32_MIN) && (right == -1))) {
+                return false;
+            }
+            result = (op == IRInstOperator::IRINST_OP_DIV_I) ? (left / right) : (left % right);
+            break;
+        case IRInstOperator::IRINST_OP_EQ_I:
+            result = left == right;
+            break;
+        case IRInstOperator::IRINST_OP_NE_I:
+            result = left != right;
+            break;
+        case IRInstOperator::IRINST_OP_LT_I:
+            result = left < right;
+            break;
+        case IRInstOperator::IRINST_OP_LE_I:
+            result = left <= right;
+            break;
+        case IRInstOperator::IRINST_OP_GT_I:
+            result = left > right;
+            break;
+        case IRInstOperator::IRINST_OP_GE_I:
+            result = left >= right;
+            break;
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+///
+/// @brief 计算一元运算的结果
+/// @param op 指令操作码
+/// @param src 操作数
+/// @param result 运算结果
+/// @return true 折叠成功 false 不能折叠
+///
+bool ConstantFolder::foldUnary(IRInstOperator op, int32_t src, int32_t & result)
+{
+    switch (op) {
+        case IRInstOperator::IRINST_OP_NEG_I:
+            result = (int32_t) (0u - (uint32_t) src);
+            break;
+        case IRInstOperator::IRINST_OP_NOT_I:
+            result = src == 0;
+            break;
+        default:
+            return false;
+    }
+
+    return true;
+}
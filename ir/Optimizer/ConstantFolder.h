@@ -0,0 +1,56 @@
+///
+/// @file ConstantFolder.h
+/// @brief 常量折叠，计算操作数都是常量的运算指令的结果
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，生成IR时折叠操作数都是常量的运算
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+
+#include "Instruction.h"
+
+///
+/// @brief 常量折叠，IR产生时与稀疏条件常量传播共用
+///
+/// 运算按照32位补码回绕，与目标机器一致。除数为0以及INT32_MIN除以-1不折叠，保留运行时的行为。
+///
+class ConstantFolder {
+
+public:
+    ///
+    /// @brief 检查指令操作码是否是可折叠的二元运算
+    /// @param op 指令操作码
+    /// @return true 可折叠
+    /// @return false 不可折叠
+    ///
+    static bool isFoldableBinary(IRInstOperator op);
+
+    ///
+    /// @brief 计算二元运算的结果
+    /// @param op 指令操作码，算术运算或者关系运算
+    /// @param left 左操作数
+    /// @param right 右操作数
+    /// @param result 运算结果，关系运算为0或1
+    /// @return true 折叠成功 false 不能折叠
+    ///
+    static bool foldBinary(IRInstOperator op, int32_t left, int32_t right, int32_t & result);
+
+    ///
+    /// @brief 计算一元运算的结果
+    /// @param op 指令操作码
+    /// @param src 操作数
+    /// @param result 运算结果
+    /// @return true 折叠成功 false 不能折叠
+    ///
+    static bool foldUnary(IRInstOperator op, int32_t src, int32_t & result);
+};
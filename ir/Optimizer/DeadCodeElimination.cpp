@@ -0,0 +1,179 @@
+///
+/// @file DeadCodeElimination.cpp
+/// @brief 死代码删除
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，标记-清除的死代码删除
+/// </table>
+///
+#include "Common.h"
+#include "DeadCodeElimination.h"
+
+///
+/// @brief 构造函数
+/// @param _func 要处理的函数
+/// @param _module 符号表
+/// @param _analysis 分析管理器
+///
+DeadCodeElimination::DeadCodeElimination(Function * _func, Module * _module, AnalysisManager * _analysis)
+    : FunctionPass(_func, _module, _analysis)
+{}
+
+///
+/// @brief 执行死代码删除
+/// @return true 成功 false 失败
+///
+bool DeadCodeElimination::run()
+{
+    if (func->isBuiltin()) {
+        return true;
+    }
+
+    removeUnreachableBlocks();
+
+    mark();
+
+    sweep();
+
+    removeUnusedVars();
+
+    return true;
+}
+
+///
+/// @brief 检查指令是否有副作用，有副作用的指令总是活跃的
+/// @param inst 指令
+/// @return true 有副作用 false 没有副作用
+///
+bool DeadCodeElimination::hasSideEffect(Instruction * inst)
+{
+    switch (inst->getOp()) {
+        case IRInstOperator::IRINST_OP_ENTRY:
+        case IRInstOperator::IRINST_OP_EXIT:
+        case IRInstOperator::IRINST_OP_LABEL:
+        case IRInstOperator::IRINST_OP_GOTO:
+        case IRInstOperator::IRINST_OP_BC:
+        case IRInstOperator::IRINST_OP_BT:
+        case IRInstOperator::IRINST_OP_BF:
+        case IRInstOperator::IRINST_OP_FUNC_CALL:
+        case IRInstOperator::IRINST_OP_ARG:
+            return true;
+        case IRInstOperator::IRINST_OP_ASSIGN:
+            // 只有对局部变量的赋值可以删除，全局变量、形参等的赋值保留
+            return dynamic_cast<LocalVariable *>(inst->getOperand(0)) == nullptr;
+        default:
+            return false;
+    }
+}
+
+///
+/// @brief 把指令标记为活跃，并加入工作表
+/// @param inst 指令
+///
+void DeadCodeElimination::markLive(Instruction * inst)
+{
+    if (inst->isDead()) {
+        inst->setDead(false);
+        workList.push_back(inst);
+    }
+}
+
+///
+/// @brief 从有副作用的指令出发标记活跃的指令
+///
+void DeadCodeElimination::mark()
+{
+    InterCode & insts = func->getInterCode();
+
+    for (auto inst: insts) {
+
+        inst->setDead();
+
+        if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) {
+            Instanceof(var, LocalVariable *, inst->getOperand(0));
+            if (var) {
+                varDefs[var].push_back(inst);
+            }
+        }
+    }
+
+    for (auto inst: insts) {
+        if (hasSideEffect(inst)) {
+            markLive(inst);
+        }
+    }
+
+    while (!workList.empty()) {
+
+        Instruction * inst = workList.back();
+        workList.pop_back();
+
+        // 赋值指令的目的操作数不是读取
+        int32_t firstUse = (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) ? 1 : 0;
+
+        for (int32_t k = firstUse; k < inst->getOperandsNum(); ++k) {
+
+            Value * val = inst->getOperand(k);
+
+            Instanceof(operandInst, Instruction *, val);
+            if (operandInst) {
+                markLive(operandInst);
+                continue;
+            }
+
+            // 读取局部变量时，到达该处的赋值可能是任何一条，都标记为活跃
+            Instanceof(var, LocalVariable *, val);
+            if (var) {
+                auto pIter = varDefs.find(var);
+                if (pIter != varDefs.end()) {
+                    for (auto def: pIter->second) {
+                        markLive(def);
+                    }
+                    varDefs.erase(pIter);
+                }
+            }
+        }
+    }
+}
+
+///
+/// @brief 删除仍标记为死代码的指令
+/// @return true 有删除 false 没有删除
+///
+bool DeadCodeElimination::sweep()
+{
+    InterCode & insts = func->getInterCode();
+
+    std::vector<Instruction *> deadInsts;
+    for (auto pIter = insts.begin(); pIter != insts.end();) {
+        if ((*pIter)->isDead()) {
+            deadInsts.push_back(*pIter);
+            pIter = insts.erase(pIter);
+        } else {
+            ++pIter;
+        }
+    }
+
+    if (deadInsts.empty()) {
+        return false;
+    }
+
+    // 死代码之间可能相互引用，先全部清除操作数再释放
+    for (auto inst: deadInsts) {
+        inst->clearOperands();
+    }
+    for (auto inst: deadInsts) {
+        delete inst;
+    }
+
+    analysis->invalidate(func);
+
+    return true;
+}
@@ -0,0 +1,82 @@
+///
+/// @file DeadCodeElimination.h
+/// @brief 死代码删除
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，标记-清除的死代码删除
+/// </table>
+///
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "FunctionPass.h"
+
+///
+/// @brief 基于标记-清除的死代码删除
+///
+/// 先把所有指令标记为死代码，再从有副作用的指令出发，沿操作数把用到的指令标记为活跃。
+/// 局部变量被活跃指令读取时，对其赋值的指令都是活跃的，否则这些赋值是无用的存储。
+/// 最终仍标记为死代码的指令被删除，不可达的基本块以及不再使用的局部变量也一并删除。
+///
+class DeadCodeElimination : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 要处理的函数
+    /// @param _module 符号表
+    /// @param _analysis 分析管理器
+    ///
+    DeadCodeElimination(Function * _func, Module * _module, AnalysisManager * _analysis);
+
+    ///
+    /// @brief 执行死代码删除
+    /// @return true 成功 false 失败
+    ///
+    bool run() override;
+
+protected:
+    ///
+    /// @brief 检查指令是否有副作用，有副作用的指令总是活跃的
+    /// @param inst 指令
+    /// @return true 有副作用 false 没有副作用
+    ///
+    static bool hasSideEffect(Instruction * inst);
+
+    ///
+    /// @brief 把指令标记为活跃，并加入工作表
+    /// @param inst 指令
+    ///
+    void markLive(Instruction * inst);
+
+    ///
+    /// @brief 从有副作用的指令出发标记活跃的指令
+    ///
+    void mark();
+
+    ///
+    /// @brief 删除仍标记为死代码的指令
+    /// @return true 有删除 false 没有删除
+    ///
+    bool sweep();
+
+private:
+    ///
+    /// @brief 局部变量的赋值指令
+    ///
+    std::unordered_map<LocalVariable *, std::vector<Instruction *>> varDefs;
+
+    ///
+    /// @brief 已标记为活跃但操作数还未处理的指令
+    ///
+    std::vector<Instruction *> workList;
+};
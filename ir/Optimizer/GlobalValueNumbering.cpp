@@ -0,0 +1,162 @@
+///
+/// @file GlobalValueNumbering.cpp
+/// @brief 基于支配树的全局值编号，删除公共子表达式
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，按支配树作用域的全局值编号
+/// </table>
+///
+#include <algorithm>
+#include <functional>
+
+#include "Common.h"
+#include "GlobalValueNumbering.h"
+#include "ConstantFolder.h"
+#include "ConstInt.h"
+#include "FormalParam.h"
+
+///
+/// @brief 构造函数
+/// @param _func 要处理的函数
+/// @param _module 符号表
+/// @param _analysis 分析管理器
+///
+GlobalValueNumbering::GlobalValueNumbering(Function * _func, Module * _module, AnalysisManager * _analysis)
+    : FunctionPass(_func, _module, _analysis)
+{}
+
+///
+/// @brief 执行全局值编号
+/// @return true 成功 false 失败
+///
+bool GlobalValueNumbering::run()
+{
+    if (func->isBuiltin()) {
+        return true;
+    }
+
+    ControlFlowGraph * cfg = analysis->getCFG(func);
+    if (!cfg->getEntry()) {
+        return true;
+    }
+
+    domTree = analysis->getDomTree(func);
+
+    visit(cfg->getEntry());
+
+    if (redundant.empty()) {
+        return true;
+    }
+
+    for (auto inst: redundant) {
+        func->getInterCode().remove(inst);
+        inst->clearOperands();
+        delete inst;
+    }
+
+    analysis->invalidate(func);
+
+    return true;
+}
+
+///
+/// @brief 表达式的散列函数
+/// @param expr 表达式
+/// @return size_t 散列值
+///
+size_t GlobalValueNumbering::ExpressionHash::operator()(const Expression & expr) const
+{
+    size_t hash = std::hash<int>()((int) expr.op);
+    hash = hash * 31 + std::hash<Value *>()(expr.left);
+    hash = hash * 31 + std::hash<Value *>()(expr.right);
+
+    return hash;
+}
+
+///
+/// @brief 检查指令是否可以参与值编号，并构造其表达式
+/// @param inst 指令
+/// @param expr 表达式
+/// @return true 可以 false 不可以
+///
+bool GlobalValueNumbering::getExpression(Instruction * inst, Expression & expr)
+{
+    IRInstOperator op = inst->getOp();
+
+    bool isBinary = ConstantFolder::isFoldableBinary(op);
+    bool isUnary = (op == IRInstOperator::IRINST_OP_NEG_I) || (op == IRInstOperator::IRINST_OP_NOT_I);
+    if (!isBinary && !isUnary) {
+        return false;
+    }
+
+    // 全局变量、局部变量等的值可能被修改，只有SSA值、常量与形参的运算结果不变
+    for (auto val: inst->getOperandsValue()) {
+        if (!dynamic_cast<Instruction *>(val) && !dynamic_cast<ConstInt *>(val) &&
+            !dynamic_cast<FormalParam *>(val)) {
+            return false;
+        }
+    }
+
+    expr.op = op;
+    expr.left = inst->getOperand(0);
+    expr.right = isBinary ? inst->getOperand(1) : nullptr;
+
+    // 满足交换律的运算，操作数按地址排序
+    switch (op) {
+        case IRInstOperator::IRINST_OP_ADD_I:
+        case IRInstOperator::IRINST_OP_MUL_I:
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_NE_I:
+            if (std::less<Value *>()(expr.right, expr.left)) {
+                std::swap(expr.left, expr.right);
+            }
+            break;
+        default:
+            break;
+    }
+
+    return true;
+}
+
+///
+/// @brief 沿支配树深度优先处理基本块
+/// @param block 基本块
+///
+void GlobalValueNumbering::visit(BasicBlock * block)
+{
+    // 本基本块加入的表达式，离开时撤销
+    std::vector<Expression> inserted;
+
+    for (auto inst: block->getInsts()) {
+
+        Expression expr;
+        if (!getExpression(inst, expr)) {
+            continue;
+        }
+
+        auto pIter = available.find(expr);
+        if (pIter != available.end()) {
+            // 支配路径上已经计算过，使用者改为使用已有的值
+            inst->replaceAllUseWith(pIter->second);
+            redundant.insert(inst);
+        } else {
+            available.emplace(expr, inst);
+            inserted.push_back(expr);
+        }
+    }
+
+    for (auto child: domTree->getChildren(block)) {
+        visit(child);
+    }
+
+    for (auto & expr: inserted) {
+        available.erase(expr);
+    }
+}
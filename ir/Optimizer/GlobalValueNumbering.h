@@ -0,0 +1,108 @@
+///
+/// @file GlobalValueNumbering.h
+/// @brief 基于支配树的全局值编号，删除公共子表达式
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，按支配树作用域的全局值编号
+/// </table>
+///
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "FunctionPass.h"
+#include "BasicBlock.h"
+#include "DominatorTree.h"
+
+///
+/// @brief 基于支配树的全局值编号，要求IR是SSA形式
+///
+/// 沿支配树深度优先遍历，以(操作码, 操作数)为键的散列表记录已计算的表达式，离开基本块时撤销其中的记录，
+/// 因此只有支配当前指令的表达式才会被复用。加法、乘法、相等与不等的操作数按固定次序排列后再比较。
+/// 重复的指令通过Use列表把使用者改为已有的值，然后删除。
+///
+class GlobalValueNumbering : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 要处理的函数
+    /// @param _module 符号表
+    /// @param _analysis 分析管理器
+    ///
+    GlobalValueNumbering(Function * _func, Module * _module, AnalysisManager * _analysis);
+
+    ///
+    /// @brief 执行全局值编号
+    /// @return true 成功 false 失败
+    ///
+    bool run() override;
+
+protected:
+    ///
+    /// @brief 表达式的键
+    ///
+    struct Expression {
+
+        /// @brief 操作码
+        IRInstOperator op;
+
+        /// @brief 第一个操作数
+        Value * left;
+
+        /// @brief 第二个操作数，一元运算为nullptr
+        Value * right;
+
+        /// @brief 比较是否相等
+        bool operator==(const Expression & other) const
+        {
+            return (op == other.op) && (left == other.left) && (right == other.right);
+        }
+    };
+
+    ///
+    /// @brief 表达式的散列函数
+    ///
+    struct ExpressionHash {
+        size_t operator()(const Expression & expr) const;
+    };
+
+    ///
+    /// @brief 检查指令是否可以参与值编号，并构造其表达式
+    /// @param inst 指令
+    /// @param expr 表达式
+    /// @return true 可以 false 不可以
+    ///
+    static bool getExpression(Instruction * inst, Expression & expr);
+
+    ///
+    /// @brief 沿支配树深度优先处理基本块
+    /// @param block 基本块
+    ///
+    void visit(BasicBlock * block);
+
+private:
+    ///
+    /// @brief 支配树
+    ///
+    DominatorTree * domTree = nullptr;
+
+    ///
+    /// @brief 当前支配路径上已计算的表达式
+    ///
+    std::unordered_map<Expression, Instruction *, ExpressionHash> available;
+
+    ///
+    /// @brief 被替换的冗余指令
+    ///
+    std::unordered_set<Instruction *> redundant;
+};
@@ -0,0 +1,332 @@
+///
+/// @file LoopInvariantCodeMotion.cpp
+/// @brief 循环不变代码外提
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，循环不变运算外提到前置基本块
+/// </table>
+///
+#include <algorithm>
+#include <unordered_set>
+
+#include "Common.h"
+#include "LoopInvariantCodeMotion.h"
+#include "ConstantFolder.h"
+#include "ConstInt.h"
+#include "FormalParam.h"
+#include "BranchInstruction.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 构造函数
+/// @param _func 要处理的函数
+/// @param _module 符号表
+/// @param _analysis 分析管理器
+///
+LoopInvariantCodeMotion::LoopInvariantCodeMotion(Function * _func, Module * _module, AnalysisManager * _analysis)
+    : FunctionPass(_func, _module, _analysis)
+{}
+
+///
+/// @brief 执行循环不变代码外提
+/// @return true 成功 false 失败
+///
+bool LoopInvariantCodeMotion::run()
+{
+    if (func->isBuiltin()) {
+        return true;
+    }
+
+    // 每次插入前置基本块都会改变控制流图，逐个循环处理
+    while (insertPreheader()) {
+    }
+
+    ControlFlowGraph * cfg = analysis->getCFG(func);
+    LoopInfo * loopInfo = analysis->getLoopInfo(func);
+
+    if (loopInfo->getLoops().empty()) {
+        return true;
+    }
+
+    for (auto block: cfg->getBlocks()) {
+        blockInsts.push_back(block->getInsts());
+        for (auto inst: block->getInsts()) {
+            instBlock[inst] = block;
+        }
+    }
+
+    // 内层循环在前
+    bool changed = false;
+    for (auto loop: loopInfo->getLoops()) {
+        changed |= hoist(loop);
+    }
+
+    if (!changed) {
+        return true;
+    }
+
+    analysis->invalidate(func);
+
+    return true;
+}
+
+///
+/// @brief 获取循环的前置基本块
+/// @param loop 循环
+/// @return BasicBlock* 前置基本块，不存在时为nullptr
+///
+BasicBlock * LoopInvariantCodeMotion::getPreheader(Loop * loop)
+{
+    BasicBlock * preheader = nullptr;
+
+    for (auto pred: loop->getHeader()->getPreds()) {
+        if (!loop->contains(pred)) {
+            if (preheader) {
+                return nullptr;
+            }
+            preheader = pred;
+        }
+    }
+
+    if (preheader && (preheader->getSuccs().size() != 1)) {
+        return nullptr;
+    }
+
+    return preheader;
+}
+
+///
+/// @brief 为一个还没有前置基本块的循环插入前置基本块
+/// @return true 有插入 false 所有循环都已有前置基本块或者无法插入
+///
+bool LoopInvariantCodeMotion::insertPreheader()
+{
+    ControlFlowGraph * cfg = analysis->getCFG(func);
+    LoopInfo * loopInfo = analysis->getLoopInfo(func);
+
+    for (auto loop: loopInfo->getLoops()) {
+
+        BasicBlock * header = loop->getHeader();
+        Instruction * headerLabel = header->getLabel();
+
+        if (!headerLabel || (header == cfg->getEntry()) || getPreheader(loop)) {
+            continue;
+        }
+
+        std::vector<BasicBlock *> outsidePreds;
+        for (auto pred: header->getPreds()) {
+            if (!loop->contains(pred)) {
+                outsidePreds.push_back(pred);
+            }
+        }
+
+        if (outsidePreds.empty()) {
+            continue;
+        }
+
+        // 前置基本块放在循环头之前，顺序执行到循环头的前一个基本块必须在循环外
+        BasicBlock * prev = cfg->getBlocks()[header->getIndex() - 1];
+        if (loop->contains(prev) &&
+            (std::find(header->getPreds().begin(), header->getPreds().end(), prev) != header->getPreds().end())) {
+            IRInstOperator op = prev->getTerminator()->getOp();
+            if ((op != IRInstOperator::IRINST_OP_GOTO) && (op != IRInstOperator::IRINST_OP_BC)) {
+                continue;
+            }
+        }
+
+        LabelInstruction * preheaderLabel = new LabelInstruction(func);
+        std::vector<Instruction *> preheaderInsts{preheaderLabel};
+
+        // 循环外的前驱改为跳转到前置基本块
+        for (auto pred: outsidePreds) {
+            Instruction * term = pred->getTerminator();
+            if (term->getOp() == IRInstOperator::IRINST_OP_GOTO) {
+                auto gotoInst = static_cast<GotoInstruction *>(term);
+                if (gotoInst->getTarget() == headerLabel) {
+                    gotoInst->setTarget(preheaderLabel);
+                }
+            } else if ((term->getOp() == IRInstOperator::IRINST_OP_BC) ||
+                       (term->getOp() == IRInstOperator::IRINST_OP_BT) ||
+                       (term->getOp() == IRInstOperator::IRINST_OP_BF)) {
+                static_cast<BranchInstruction *>(term)->replaceTarget(headerLabel, preheaderLabel);
+            }
+        }
+
+        // 循环头phi指令中来自循环外的操作数合并到前置基本块
+        for (auto inst: header->getInsts()) {
+
+            Instanceof(phi, PhiInstruction *, inst);
+            if (!phi) {
+                continue;
+            }
+
+            std::vector<Instruction *> labels;
+            std::vector<Value *> vals;
+            auto & incomingBlocks = phi->getIncomingBlocks();
+            for (int32_t k = 0; k < phi->getOperandsNum(); ++k) {
+                BasicBlock * pred = cfg->getBlock(incomingBlocks[k]);
+                if (pred && !loop->contains(pred)) {
+                    labels.push_back(incomingBlocks[k]);
+                    vals.push_back(phi->getOperand(k));
+                }
+            }
+
+            if (labels.empty()) {
+                continue;
+            }
+
+            Value * merged = vals.front();
+            if (std::any_of(vals.begin(), vals.end(), [&](Value * val) { return val != merged; })) {
+                auto newPhi = new PhiInstruction(func, phi->getType());
+                for (size_t k = 0; k < labels.size(); ++k) {
+                    newPhi->addIncoming(vals[k], labels[k]);
+                }
+                preheaderInsts.push_back(newPhi);
+                merged = newPhi;
+            }
+
+            for (auto label: labels) {
+                phi->removeIncoming(label);
+            }
+            phi->addIncoming(merged, preheaderLabel);
+        }
+
+        for (auto inst: preheaderInsts) {
+            func->getInterCode().insertBefore(headerLabel, inst);
+        }
+
+        analysis->invalidate(func);
+
+        return true;
+    }
+
+    return false;
+}
+
+///
+/// @brief 检查指令是否是可以外提的无副作用运算
+/// @param inst 指令
+/// @return true 可以 false 不可以
+///
+bool LoopInvariantCodeMotion::isHoistable(Instruction * inst)
+{
+    IRInstOperator op = inst->getOp();
+
+    if ((op == IRInstOperator::IRINST_OP_NEG_I) || (op == IRInstOperator::IRINST_OP_NOT_I)) {
+        return true;
+    }
+
+    if (!ConstantFolder::isFoldableBinary(op)) {
+        return false;
+    }
+
+    // 循环可能一次也不执行，除法只有在除数是非0且非-1的常量时才能提前执行
+    if ((op == IRInstOperator::IRINST_OP_DIV_I) || (op == IRInstOperator::IRINST_OP_MOD_I)) {
+        Instanceof(divisor, ConstInt *, inst->getOperand(1));
+        return divisor && (divisor->getVal() != 0) && (divisor->getVal() != -1);
+    }
+
+    return true;
+}
+
+///
+/// @brief 把循环的不变运算外提到前置基本块
+/// @param loop 循环
+/// @return true 有外提 false 没有外提
+///
+bool LoopInvariantCodeMotion::hoist(Loop * loop)
+{
+    BasicBlock * preheader = getPreheader(loop);
+    if (!preheader) {
+        return false;
+    }
+
+    std::unordered_set<Instruction *> invariants;
+    std::vector<Instruction *> hoisted;
+
+    auto isInvariant = [&](Value * val) {
+        if (dynamic_cast<ConstInt *>(val) || dynamic_cast<FormalParam *>(val)) {
+            return true;
+        }
+
+        // 全局变量、局部变量等的值在循环内可能被修改
+        Instanceof(inst, Instruction *, val);
+        if (!inst) {
+            return false;
+        }
+
+        return !loop->contains(instBlock[inst]) || (invariants.count(inst) != 0);
+    };
+
+    // 按照逆后序遍历，操作数的定值先于使用被处理，迭代到不再变化
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        for (auto block: loop->getBlocks()) {
+            for (auto inst: blockInsts[block->getIndex()]) {
+
+                if (invariants.count(inst) || !isHoistable(inst)) {
+                    continue;
+                }
+
+                auto operands = inst->getOperandsValue();
+                if (std::all_of(operands.begin(), operands.end(), isInvariant)) {
+                    invariants.insert(inst);
+                    hoisted.push_back(inst);
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    if (hoisted.empty()) {
+        return false;
+    }
+
+    for (auto block: loop->getBlocks()) {
+        auto & insts = blockInsts[block->getIndex()];
+        insts.erase(std::remove_if(insts.begin(),
+                                   insts.end(),
+                                   [&](Instruction * inst) { return invariants.count(inst) != 0; }),
+                    insts.end());
+    }
+
+    // 放在前置基本块的跳转指令之前
+    auto & preheaderInsts = blockInsts[preheader->getIndex()];
+    auto pos = preheaderInsts.end();
+    if (!preheaderInsts.empty()) {
+        IRInstOperator op = preheaderInsts.back()->getOp();
+        if ((op == IRInstOperator::IRINST_OP_GOTO) || (op == IRInstOperator::IRINST_OP_BC) ||
+            (op == IRInstOperator::IRINST_OP_BT) || (op == IRInstOperator::IRINST_OP_BF)) {
+            --pos;
+        }
+    }
+
+    // 线性IR中同样移到该位置
+    InterCode & code = func->getInterCode();
+    for (auto inst: hoisted) {
+        code.remove(inst);
+    }
+    Instruction * before = (pos != preheaderInsts.end()) ? *pos : preheaderInsts.back()->getNext();
+    for (auto inst: hoisted) {
+        code.insertBefore(before, inst);
+    }
+
+    preheaderInsts.insert(pos, hoisted.begin(), hoisted.end());
+
+    for (auto inst: hoisted) {
+        instBlock[inst] = preheader;
+    }
+
+    return true;
+}
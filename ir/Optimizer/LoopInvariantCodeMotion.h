@@ -0,0 +1,86 @@
+///
+/// @file LoopInvariantCodeMotion.h
+/// @brief 循环不变代码外提
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，循环不变运算外提到前置基本块
+/// </table>
+///
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "FunctionPass.h"
+#include "LoopInfo.h"
+
+///
+/// @brief 循环不变代码外提，要求IR是SSA形式
+///
+/// 先为每个循环插入前置基本块，即循环外唯一的前驱且只有循环头一个后继，循环头的phi指令中来自循环外的
+/// 操作数合并到前置基本块中。然后从内层循环到外层循环，把操作数都在循环外定值或者也是循环不变量的
+/// 无副作用运算移到前置基本块的末尾。移出内层循环的指令在处理外层循环时还可能继续外提。
+///
+class LoopInvariantCodeMotion : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 要处理的函数
+    /// @param _module 符号表
+    /// @param _analysis 分析管理器
+    ///
+    LoopInvariantCodeMotion(Function * _func, Module * _module, AnalysisManager * _analysis);
+
+    ///
+    /// @brief 执行循环不变代码外提
+    /// @return true 成功 false 失败
+    ///
+    bool run() override;
+
+protected:
+    ///
+    /// @brief 为一个还没有前置基本块的循环插入前置基本块
+    /// @return true 有插入 false 所有循环都已有前置基本块或者无法插入
+    ///
+    bool insertPreheader();
+
+    ///
+    /// @brief 获取循环的前置基本块
+    /// @param loop 循环
+    /// @return BasicBlock* 前置基本块，不存在时为nullptr
+    ///
+    static BasicBlock * getPreheader(Loop * loop);
+
+    ///
+    /// @brief 检查指令是否是可以外提的无副作用运算
+    /// @param inst 指令
+    /// @return true 可以 false 不可以
+    ///
+    static bool isHoistable(Instruction * inst);
+
+    ///
+    /// @brief 把循环的不变运算外提到前置基本块
+    /// @param loop 循环
+    /// @return true 有外提 false 没有外提
+    ///
+    bool hoist(Loop * loop);
+
+private:
+    ///
+    /// @brief 外提过程中每个基本块的指令，下标为基本块编号
+    ///
+    std::vector<std::vector<Instruction *>> blockInsts;
+
+    ///
+    /// @brief 外提过程中指令所在的基本块
+    ///
+    std::unordered_map<Instruction *, BasicBlock *> instBlock;
+};
@@ -0,0 +1,401 @@
+///
+/// @file Mem2Reg.cpp
+/// @brief 局部变量提升为SSA值，即SSA构造
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，局部变量提升为SSA值
+/// </table>
+///
+#include <algorithm>
+
+#include "Common.h"
+#include "Mem2Reg.h"
+#include "ControlFlowGraph.h"
+#include "LabelInstruction.h"
+#include "ConstInt.h"
+
+///
+/// @brief 构造函数
+/// @param _func 要处理的函数
+/// @param _module 符号表，用于常量的创建
+/// @param _analysis 分析管理器
+///
+Mem2Reg::Mem2Reg(Function * _func, Module * _module, AnalysisManager * _analysis)
+    : FunctionPass(_func, _module, _analysis)
+{}
+
+///
+/// @brief 执行局部变量的提升
+/// @return true 成功 false 失败
+///
+bool Mem2Reg::run()
+{
+    if (func->isBuiltin()) {
+        return true;
+    }
+
+    // 已有phi指令时函数已经是SSA形式，如-I输出的IR重新作为输入，phi指令的操作数可能就是局部变量，
+    // 重命名时只处理新插入的phi指令，因此不再提升
+    for (auto inst: func->getInterCode()) {
+        if (inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+            return true;
+        }
+    }
+
+    // 不可达的基本块不在支配树中，先删除
+    removeUnreachableBlocks();
+
+    // phi指令通过Label指令标识前驱基本块
+    insertBlockLabels();
+
+    cfg = analysis->getCFG(func);
+    domTree = analysis->getDomTree(func);
+
+    // 函数内的局部变量都是标量，且不会取地址，都可以提升
+    for (auto var: func->getVarValues()) {
+        promotable.insert(var);
+    }
+
+    blockPhis.assign(cfg->getBlocks().size(), std::vector<PhiInstruction *>());
+
+    insertPhis();
+
+    rename(cfg->getEntry());
+
+    removeUselessPhis();
+
+    rebuildInsts();
+
+    domTree = nullptr;
+    cfg = nullptr;
+
+    // 已提升的局部变量不再被使用，删除
+    removeUnusedVars();
+
+    return true;
+}
+
+///
+/// @brief 每个基本块都以Label指令开始，以便phi指令标识前驱基本块
+///
+void Mem2Reg::insertBlockLabels()
+{
+    ControlFlowGraph * graph = analysis->getCFG(func);
+
+    InterCode & code = func->getInterCode();
+    bool changed = false;
+
+    for (auto block: graph->getBlocks()) {
+
+        if (block->getLabel()) {
+            continue;
+        }
+
+        auto & blockInsts = block->getInsts();
+        auto pIter = blockInsts.begin();
+
+        // 只有入口指令的基本块，其后继没有其它前驱时不会作为phi指令的前驱，不需要Label；
+        // 后继是循环头等有多个前驱的基本块时，插入一个空的基本块作为前驱
+        if ((*pIter)->getOp() == IRInstOperator::IRINST_OP_ENTRY) {
+            if ((++pIter == blockInsts.end()) &&
+                (block->getSuccs().empty() || (block->getSuccs().front()->getPreds().size() == 1))) {
+                continue;
+            }
+        }
+
+        if (pIter != blockInsts.end()) {
+            code.insertBefore(*pIter, new LabelInstruction(func));
+        } else {
+            code.insertAfter(blockInsts.back(), new LabelInstruction(func));
+        }
+        changed = true;
+    }
+
+    if (changed) {
+        analysis->invalidate(func);
+    }
+}
+
+///
+/// @brief 在变量定值基本块的迭代支配边界上插入phi指令
+///
+void Mem2Reg::insertPhis()
+{
+    // 每个变量的定值基本块
+    std::unordered_map<LocalVariable *, std::vector<BasicBlock *>> defBlocks;
+
+    for (auto block: cfg->getReversePostOrder()) {
+        for (auto inst: block->getInsts()) {
+            if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) {
+                Instanceof(var, LocalVariable *, inst->getOperand(0));
+                if (var && promotable.count(var)) {
+                    auto & blocks = defBlocks[var];
+                    if (blocks.empty() || (blocks.back() != block)) {
+                        blocks.push_back(block);
+                    }
+                }
+            }
+        }
+    }
+
+    size_t blockNum = cfg->getBlocks().size();
+
+    // 按照变量的声明次序处理，使得phi指令的次序确定
+    for (auto var: func->getVarValues()) {
+
+        auto pIter = defBlocks.find(var);
+        if (pIter == defBlocks.end()) {
+            continue;
+        }
+
+        std::vector<bool> hasPhi(blockNum, false);
+        std::vector<bool> inWorkList(blockNum, false);
+        std::vector<BasicBlock *> workList = pIter->second;
+        for (auto block: workList) {
+            inWorkList[block->getIndex()] = true;
+        }
+
+        while (!workList.empty()) {
+
+            BasicBlock * block = workList.back();
+            workList.pop_back();
+
+            for (auto df: domTree->getFrontier(block)) {
+
+                if (hasPhi[df->getIndex()]) {
+                    continue;
+                }
+
+                PhiInstruction * phi = new PhiInstruction(func, var->getType());
+                blockPhis[df->getIndex()].push_back(phi);
+                phiVars[phi] = var;
+                hasPhi[df->getIndex()] = true;
+
+                // phi指令也是变量的定值
+                if (!inWorkList[df->getIndex()]) {
+                    inWorkList[df->getIndex()] = true;
+                    workList.push_back(df);
+                }
+            }
+        }
+    }
+}
+
+///
+/// @brief 获取变量当前到达的定值
+/// @param var 变量
+/// @return Value* 定值，没有定值时为0
+///
+Value * Mem2Reg::currentDef(LocalVariable * var)
+{
+    auto & stack = defStacks[var];
+    if (stack.empty()) {
+        // 未初始化的变量按照0处理
+        return module->newConstInt(0);
+    }
+
+    return stack.back();
+}
+
+///
+/// @brief 沿支配树深度优先遍历，对变量的使用进行重命名
+/// @param block 基本块
+///
+void Mem2Reg::rename(BasicBlock * block)
+{
+    // 本基本块压栈的变量，离开时出栈
+    std::vector<LocalVariable *> pushed;
+
+    for (auto phi: blockPhis[block->getIndex()]) {
+        LocalVariable * var = phiVars[phi];
+        defStacks[var].push_back(phi);
+        pushed.push_back(var);
+    }
+
+    for (auto inst: block->getInsts()) {
+
+        // 赋值指令的目的操作数不是使用
+        int32_t firstUse = (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) ? 1 : 0;
+
+        for (int32_t k = firstUse; k < inst->getOperandsNum(); ++k) {
+            Instanceof(var, LocalVariable *, inst->getOperand(k));
+            if (var && promotable.count(var)) {
+                inst->setOperand(k, currentDef(var));
+            }
+        }
+
+        if (firstUse == 0) {
+            continue;
+        }
+
+        Instanceof(dest, LocalVariable *, inst->getOperand(0));
+        if (!dest || !promotable.count(dest)) {
+            continue;
+        }
+
+        Value * src = inst->getOperand(1);
+        if (dynamic_cast<Instruction *>(src) || dynamic_cast<ConstInt *>(src)) {
+
+            // 源操作数的值不会改变，变量的定值直接为源操作数，赋值指令删除
+            defStacks[dest].push_back(src);
+            removedInsts.insert(inst);
+        } else {
+
+            // 全局变量等可能被修改，复制到只定值一次的新变量中
+            LocalVariable * newVar = func->newLocalVarValue(dest->getType());
+            inst->setOperand(0, newVar);
+            defStacks[dest].push_back(newVar);
+        }
+
+        pushed.push_back(dest);
+    }
+
+    // 设置后继基本块phi指令来自本基本块的值
+    for (auto succ: block->getSuccs()) {
+        for (auto phi: blockPhis[succ->getIndex()]) {
+            phi->addIncoming(currentDef(phiVars[phi]), block->getLabel());
+        }
+    }
+
+    for (auto child: domTree->getChildren(block)) {
+        rename(child);
+    }
+
+    for (auto var: pushed) {
+        defStacks[var].pop_back();
+    }
+}
+
+///
+/// @brief 删除没有使用或者所有操作数都相同的phi指令
+///
+void Mem2Reg::removeUselessPhis()
+{
+    std::unordered_set<PhiInstruction *> deadPhis;
+
+    // 操作数除自身外都相同的phi指令可直接替换为该操作数，替换后可能产生新的可替换phi指令
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        for (auto & phis: blockPhis) {
+            for (auto phi: phis) {
+
+                if (deadPhis.count(phi)) {
+                    continue;
+                }
+
+                Value * same = nullptr;
+                bool trivial = true;
+                for (auto val: phi->getOperandsValue()) {
+                    if ((val == phi) || (val == same)) {
+                        continue;
+                    }
+                    if (same) {
+                        trivial = false;
+                        break;
+                    }
+                    same = val;
+                }
+
+                if (trivial && same) {
+                    phi->replaceAllUseWith(same);
+                    deadPhis.insert(phi);
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    // 只被phi指令使用的phi指令也是无用的，从被非phi指令使用的phi指令出发标记有用的phi指令
+    std::unordered_set<PhiInstruction *> livePhis;
+    std::vector<PhiInstruction *> workList;
+
+    for (auto & phis: blockPhis) {
+        for (auto phi: phis) {
+            if (deadPhis.count(phi)) {
+                continue;
+            }
+            for (auto use: phi->getUses()) {
+                if (!dynamic_cast<PhiInstruction *>(use->getUser())) {
+                    livePhis.insert(phi);
+                    workList.push_back(phi);
+                    break;
+                }
+            }
+        }
+    }
+
+    while (!workList.empty()) {
+
+        PhiInstruction * phi = workList.back();
+        workList.pop_back();
+
+        for (auto val: phi->getOperandsValue()) {
+            Instanceof(operandPhi, PhiInstruction *, val);
+            if (operandPhi && !deadPhis.count(operandPhi) && !livePhis.count(operandPhi)) {
+                livePhis.insert(operandPhi);
+                workList.push_back(operandPhi);
+            }
+        }
+    }
+
+    for (auto & phis: blockPhis) {
+        for (auto phi: phis) {
+            if (!livePhis.count(phi)) {
+                deadPhis.insert(phi);
+            }
+        }
+        phis.erase(std::remove_if(phis.begin(), phis.end(), [&](PhiInstruction * phi) { return deadPhis.count(phi); }),
+                   phis.end());
+    }
+
+    for (auto phi: deadPhis) {
+        phi->clearOperands();
+    }
+    for (auto phi: deadPhis) {
+        phiVars.erase(phi);
+        delete phi;
+    }
+}
+
+///
+/// @brief 在线性IR中插入phi指令并删除已提升变量的赋值指令
+///
+void Mem2Reg::rebuildInsts()
+{
+    InterCode & code = func->getInterCode();
+
+    // phi指令紧跟在基本块开始的Label指令之后
+    for (auto block: cfg->getBlocks()) {
+
+        Instruction * label = block->getLabel();
+        if (!label || removedInsts.count(label)) {
+            continue;
+        }
+
+        Instruction * pos = label->getNext();
+        for (auto phi: blockPhis[block->getIndex()]) {
+            code.insertBefore(pos, phi);
+        }
+    }
+
+    for (auto inst: removedInsts) {
+        code.remove(inst);
+    }
+    for (auto inst: removedInsts) {
+        inst->clearOperands();
+    }
+    for (auto inst: removedInsts) {
+        delete inst;
+    }
+
+    analysis->invalidate(func);
+}
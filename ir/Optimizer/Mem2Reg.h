@@ -0,0 +1,121 @@
+///
+/// @file Mem2Reg.h
+/// @brief 局部变量提升为SSA值，即SSA构造
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，局部变量提升为SSA值
+/// </table>
+///
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "FunctionPass.h"
+#include "BasicBlock.h"
+#include "DominatorTree.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 局部变量提升为SSA值
+///
+/// 采用Cytron等人的方法：在变量定值基本块的迭代支配边界上插入phi指令，然后沿支配树深度优先遍历，
+/// 把局部变量的每次使用替换为当前到达的定值，局部变量的赋值指令随之删除。
+/// 赋值的源操作数是全局变量这类可能被修改的Value时，改为赋值给只定值一次的新局部变量。
+/// 已含有phi指令的函数已经是SSA形式，不再处理。
+///
+class Mem2Reg : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 要处理的函数
+    /// @param _module 符号表，用于常量的创建
+    /// @param _analysis 分析管理器
+    ///
+    Mem2Reg(Function * _func, Module * _module, AnalysisManager * _analysis);
+
+    ///
+    /// @brief 执行局部变量的提升
+    /// @return true 成功 false 失败
+    ///
+    bool run() override;
+
+protected:
+    ///
+    /// @brief 每个基本块都以Label指令开始，以便phi指令标识前驱基本块
+    ///
+    void insertBlockLabels();
+
+    ///
+    /// @brief 在变量定值基本块的迭代支配边界上插入phi指令
+    ///
+    void insertPhis();
+
+    ///
+    /// @brief 沿支配树深度优先遍历，对变量的使用进行重命名
+    /// @param block 基本块
+    ///
+    void rename(BasicBlock * block);
+
+    ///
+    /// @brief 获取变量当前到达的定值
+    /// @param var 变量
+    /// @return Value* 定值，没有定值时为0
+    ///
+    Value * currentDef(LocalVariable * var);
+
+    ///
+    /// @brief 删除没有使用或者所有操作数都相同的phi指令
+    ///
+    void removeUselessPhis();
+
+    ///
+    /// @brief 在线性IR中插入phi指令并删除已提升变量的赋值指令
+    ///
+    void rebuildInsts();
+
+private:
+    ///
+    /// @brief 控制流图
+    ///
+    ControlFlowGraph * cfg = nullptr;
+
+    ///
+    /// @brief 支配树，由分析管理器缓存
+    ///
+    DominatorTree * domTree = nullptr;
+
+    ///
+    /// @brief 可提升的局部变量
+    ///
+    std::unordered_set<LocalVariable *> promotable;
+
+    ///
+    /// @brief 每个基本块开始处插入的phi指令，下标为基本块编号
+    ///
+    std::vector<std::vector<PhiInstruction *>> blockPhis;
+
+    ///
+    /// @brief phi指令对应的局部变量
+    ///
+    std::unordered_map<PhiInstruction *, LocalVariable *> phiVars;
+
+    ///
+    /// @brief 重命名时变量的定值栈
+    ///
+    std::unordered_map<LocalVariable *, std::vector<Value *>> defStacks;
+
+    ///
+    /// @brief 需要删除的指令
+    ///
+    std::unordered_set<Instruction *> removedInsts;
+};
@@ -0,0 +1,293 @@
+///
+/// @file OutOfSSA.cpp
+/// @brief 消除phi指令，SSA形式转换为普通的线性IR
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，后端处理前消除phi指令
+/// </table>
+///
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Common.h"
+#include "OutOfSSA.h"
+#include "ControlFlowGraph.h"
+#include "Liveness.h"
+#include "MoveInstruction.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 构造函数
+/// @param _func 要处理的函数
+/// @param _module 符号表
+/// @param _analysis 分析管理器
+///
+OutOfSSA::OutOfSSA(Function * _func, Module * _module, AnalysisManager * _analysis)
+    : FunctionPass(_func, _module, _analysis)
+{}
+
+///
+/// @brief 消除函数内的所有phi指令
+/// @return true 成功 false 失败
+///
+bool OutOfSSA::run()
+{
+    if (func->isBuiltin()) {
+        return true;
+    }
+
+    cfg = analysis->getCFG(func);
+    liveness = analysis->getLiveness(func);
+
+    leader.clear();
+    members.clear();
+
+    std::vector<PhiInstruction *> phis;
+
+    for (auto block: cfg->getBlocks()) {
+        for (auto inst: block->getInsts()) {
+
+            Instanceof(phi, PhiInstruction *, inst);
+            if (!phi) {
+                continue;
+            }
+
+            for (auto label: phi->getIncomingBlocks()) {
+                if (!cfg->getBlock(label)) {
+                    minic_log(LOG_ERROR, "phi指令的前驱基本块不存在");
+                    return false;
+                }
+            }
+
+            leader[phi] = phi;
+            members[phi].push_back(phi);
+            phis.push_back(phi);
+        }
+    }
+
+    if (phis.empty()) {
+        return true;
+    }
+
+    // 操作数也是phi指令且不冲突时合并同余类，共用一个变量
+    for (auto phi: phis) {
+        for (int32_t k = 0; k < phi->getOperandsNum(); ++k) {
+            Instanceof(argPhi, PhiInstruction *, phi->getOperand(k));
+            if (argPhi) {
+                merge(phi, argPhi);
+            }
+        }
+    }
+
+    // 每个同余类一个变量
+    std::unordered_map<PhiInstruction *, LocalVariable *> classVars;
+    for (auto phi: phis) {
+        PhiInstruction * head = findLeader(phi);
+        if (!classVars.count(head)) {
+            classVars[head] = func->newLocalVarValue(phi->getType());
+        }
+    }
+
+    // 前驱基本块末尾要插入的赋值指令，以及phi指令要替换成的赋值指令
+    std::unordered_map<BasicBlock *, std::vector<Instruction *>> tailCopies;
+    std::unordered_map<Instruction *, Instruction *> headCopies;
+
+    // 前驱基本块末尾已经直接赋值的同余类，前驱的赋值对所有后继都会执行，同一同余类只能直接赋值一次
+    std::unordered_map<BasicBlock *, std::unordered_set<PhiInstruction *>> written;
+
+    for (auto phi: phis) {
+
+        PhiInstruction * head = findLeader(phi);
+        LocalVariable * phiVar = classVars[head];
+
+        // 需要在前驱末尾赋值的值，同一同余类的值已经在变量中，不借助中转变量时不需要赋值
+        std::vector<std::pair<BasicBlock *, Value *>> copies;
+        bool needTmp = false;
+
+        auto & incomingBlocks = phi->getIncomingBlocks();
+        for (int32_t k = 0; k < phi->getOperandsNum(); ++k) {
+
+            BasicBlock * pred = cfg->getBlock(incomingBlocks[k]);
+            Value * val = phi->getOperand(k);
+
+            Instanceof(argPhi, PhiInstruction *, val);
+            if (argPhi) {
+                val = classVars[findLeader(argPhi)];
+            }
+
+            copies.emplace_back(pred, val);
+            if (val == phiVar) {
+                continue;
+            }
+
+            // 同余类的值在前驱出口处仍活跃时，前驱末尾的赋值会覆盖还要使用的旧值
+            for (auto member: members[head]) {
+                if (liveness->getLiveOut(pred).count(member)) {
+                    needTmp = true;
+                }
+            }
+
+            if (written[pred].count(head)) {
+                needTmp = true;
+            }
+        }
+
+        // 冲突时前驱先赋值给中转变量，phi指令的位置再赋值给同余类的变量
+        LocalVariable * copyVar = phiVar;
+        if (needTmp) {
+            copyVar = func->newLocalVarValue(phi->getType());
+            headCopies[phi] = new MoveInstruction(func, phiVar, copyVar);
+        }
+
+        for (auto & copy: copies) {
+
+            // 借助中转变量时，phi指令位置的赋值对所有前驱都执行，同一同余类的值也要赋值给中转变量
+            if (!needTmp) {
+                if (copy.second == phiVar) {
+                    continue;
+                }
+                written[copy.first].insert(head);
+            }
+
+            tailCopies[copy.first].push_back(new MoveInstruction(func, copyVar, copy.second));
+        }
+    }
+
+    // phi指令的使用者改为使用同余类的变量
+    for (auto phi: phis) {
+        phi->replaceAllUseWith(classVars[findLeader(phi)]);
+    }
+
+    InterCode & code = func->getInterCode();
+
+    for (auto block: cfg->getBlocks()) {
+
+        // 基本块在线性IR中的最后一条指令
+        Instruction * last = nullptr;
+
+        for (auto inst: block->getInsts()) {
+
+            auto pHead = headCopies.find(inst);
+            if (pHead != headCopies.end()) {
+                code.insertBefore(inst, pHead->second);
+                code.remove(inst);
+                last = pHead->second;
+                continue;
+            }
+
+            // 不需要中转的phi指令直接删除
+            if (inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+                code.remove(inst);
+                continue;
+            }
+
+            last = inst;
+        }
+
+        auto pIter = tailCopies.find(block);
+        if (pIter == tailCopies.end()) {
+            continue;
+        }
+
+        // 赋值指令插在跳转指令之前，顺序执行到后继的基本块时放在末尾
+        Instruction * pos = last->getNext();
+        switch (last->getOp()) {
+            case IRInstOperator::IRINST_OP_GOTO:
+            case IRInstOperator::IRINST_OP_BC:
+            case IRInstOperator::IRINST_OP_BT:
+            case IRInstOperator::IRINST_OP_BF:
+                pos = last;
+                break;
+            default:
+                break;
+        }
+
+        for (auto copy: pIter->second) {
+            code.insertBefore(pos, copy);
+        }
+    }
+
+    for (auto phi: phis) {
+        phi->clearOperands();
+        delete phi;
+    }
+
+    analysis->invalidate(func);
+
+    return true;
+}
+
+///
+/// @brief 获取phi指令所在同余类的代表
+/// @param phi phi指令
+/// @return PhiInstruction* 同余类的代表
+///
+PhiInstruction * OutOfSSA::findLeader(PhiInstruction * phi)
+{
+    PhiInstruction * head = leader[phi];
+    if (head != phi) {
+        // 路径压缩
+        head = findLeader(head);
+        leader[phi] = head;
+    }
+
+    return head;
+}
+
+///
+/// @brief 检查两条phi指令的结果是否冲突，即一个值在另一个值的定值点活跃
+/// @param a phi指令
+/// @param b phi指令
+/// @return true 冲突 false 不冲突
+///
+bool OutOfSSA::interfere(PhiInstruction * a, PhiInstruction * b)
+{
+    BasicBlock * blockA = cfg->getBlock(a);
+    BasicBlock * blockB = cfg->getBlock(b);
+
+    // 同一基本块的phi指令同时定值
+    if (blockA == blockB) {
+        return true;
+    }
+
+    // phi指令在基本块入口处定值，另一个值在该基本块入口处活跃则冲突
+    return liveness->getLiveIn(blockB).count(a) || liveness->getLiveIn(blockA).count(b);
+}
+
+///
+/// @brief 两条phi指令所在的同余类的成员互不冲突时合并同余类
+/// @param a phi指令
+/// @param b phi指令
+///
+void OutOfSSA::merge(PhiInstruction * a, PhiInstruction * b)
+{
+    PhiInstruction * headA = findLeader(a);
+    PhiInstruction * headB = findLeader(b);
+    if (headA == headB) {
+        return;
+    }
+
+    auto & membersA = members[headA];
+    auto & membersB = members[headB];
+
+    for (auto x: membersA) {
+        for (auto y: membersB) {
+            if (interfere(x, y)) {
+                return;
+            }
+        }
+    }
+
+    leader[headB] = headA;
+    membersA.insert(membersA.end(), membersB.begin(), membersB.end());
+    members.erase(headB);
+}
@@ -0,0 +1,95 @@
+///
+/// @file OutOfSSA.h
+/// @brief 消除phi指令，SSA形式转换为普通的线性IR
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，后端处理前消除phi指令
+/// </table>
+///
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "FunctionPass.h"
+#include "ControlFlowGraph.h"
+#include "Liveness.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 消除phi指令
+///
+/// 先把互为操作数且活跃范围不冲突的phi指令合并为同余类，每个同余类共用一个变量，类内的赋值不再需要。
+/// 各前驱基本块在跳转指令前把对应的值赋给phi指令的变量，phi指令删除。
+/// 若同余类的某个值在前驱基本块的出口处仍活跃（如作为同一基本块其它phi指令的操作数，
+/// 或者前驱有多个后继且另一后继还要使用旧值），前驱末尾的赋值会覆盖旧值，这时再引入一个中转变量：
+/// 前驱赋值给中转变量，phi指令所在位置再把中转变量赋给同余类的变量。
+///
+class OutOfSSA : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 要处理的函数
+    /// @param _module 符号表
+    /// @param _analysis 分析管理器
+    ///
+    OutOfSSA(Function * _func, Module * _module, AnalysisManager * _analysis);
+
+    ///
+    /// @brief 消除函数内的所有phi指令
+    /// @return true 成功 false 失败
+    ///
+    bool run() override;
+
+protected:
+    ///
+    /// @brief 获取phi指令所在同余类的代表
+    /// @param phi phi指令
+    /// @return PhiInstruction* 同余类的代表
+    ///
+    PhiInstruction * findLeader(PhiInstruction * phi);
+
+    ///
+    /// @brief 检查两条phi指令的结果是否冲突，即一个值在另一个值的定值点活跃
+    /// @param a phi指令
+    /// @param b phi指令
+    /// @return true 冲突 false 不冲突
+    ///
+    bool interfere(PhiInstruction * a, PhiInstruction * b);
+
+    ///
+    /// @brief 两条phi指令所在的同余类的成员互不冲突时合并同余类
+    /// @param a phi指令
+    /// @param b phi指令
+    ///
+    void merge(PhiInstruction * a, PhiInstruction * b);
+
+private:
+    ///
+    /// @brief 控制流图
+    ///
+    ControlFlowGraph * cfg = nullptr;
+
+    ///
+    /// @brief 活跃变量分析结果，基于SSA形式计算
+    ///
+    Liveness * liveness = nullptr;
+
+    ///
+    /// @brief 并查集中phi指令的父节点，同余类的代表指向自身
+    ///
+    std::unordered_map<PhiInstruction *, PhiInstruction *> leader;
+
+    ///
+    /// @brief 同余类的成员，键为同余类的代表
+    ///
+    std::unordered_map<PhiInstruction *, std::vector<PhiInstruction *>> members;
+};
@@ -0,0 +1,437 @@
+///
+/// @file SCCP.cpp
+/// @brief 稀疏条件常量传播
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，稀疏条件常量传播
+/// </table>
+///
+#include "Common.h"
+#include "SCCP.h"
+#include "ConstantFolder.h"
+#include "ConstInt.h"
+#include "BranchInstruction.h"
+#include "GotoInstruction.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 构造函数
+/// @param _func 要处理的函数
+/// @param _module 符号表，用于常量的创建
+/// @param _analysis 分析管理器
+///
+SCCP::SCCP(Function * _func, Module * _module, AnalysisManager * _analysis) : FunctionPass(_func, _module, _analysis)
+{}
+
+///
+/// @brief 执行稀疏条件常量传播
+/// @return true 成功 false 失败
+///
+bool SCCP::run()
+{
+    if (func->isBuiltin()) {
+        return true;
+    }
+
+    cfg = analysis->getCFG(func);
+    if (!cfg->getEntry()) {
+        return true;
+    }
+
+    executable.assign(cfg->getBlocks().size(), false);
+    executable[cfg->getEntry()->getIndex()] = true;
+    blockWorkList.push_back(cfg->getEntry());
+
+    while (!blockWorkList.empty() || !instWorkList.empty()) {
+
+        while (!instWorkList.empty()) {
+            Instruction * inst = instWorkList.back();
+            instWorkList.pop_back();
+
+            // 不可执行基本块中的指令等到基本块可执行时再计算
+            BasicBlock * block = cfg->getBlock(inst);
+            if (block && executable[block->getIndex()]) {
+                visit(inst);
+            }
+        }
+
+        while (!blockWorkList.empty()) {
+            BasicBlock * block = blockWorkList.back();
+            blockWorkList.pop_back();
+
+            for (auto inst: block->getInsts()) {
+                visit(inst);
+            }
+
+            // 无条件跳转、顺序执行等出边与操作数无关，在此统一处理
+            visitTerminator(block->getTerminator());
+        }
+    }
+
+    rewrite();
+
+    return true;
+}
+
+///
+/// @brief 获取Value的格值
+/// @param val Value
+/// @return LatticeValue 格值
+///
+SCCP::LatticeValue SCCP::getValue(Value * val)
+{
+    LatticeValue result;
+
+    Instanceof(constVal, ConstInt *, val);
+    if (constVal) {
+        result.state = LatticeValue::CONST;
+        result.value = constVal->getVal();
+        return result;
+    }
+
+    Instanceof(inst, Instruction *, val);
+    if (inst && inst->hasResultValue() && (inst->getOp() != IRInstOperator::IRINST_OP_LABEL)) {
+        auto pIter = values.find(inst);
+        if (pIter != values.end()) {
+            result = pIter->second;
+        }
+        return result;
+    }
+
+    // 局部变量、形参、全局变量等的值不确定
+    result.state = LatticeValue::OVERDEF;
+
+    return result;
+}
+
+///
+/// @brief 降低指令的格值，发生变化时把使用者加入工作表
+/// @param inst 指令
+/// @param newValue 新的格值
+///
+void SCCP::lower(Instruction * inst, LatticeValue newValue)
+{
+    LatticeValue & oldValue = values[inst];
+
+    if (oldValue.state == LatticeValue::OVERDEF) {
+        return;
+    }
+
+    // 格值只能下降，同一指令得到不同的常量时为非常量
+    if ((oldValue.state == LatticeValue::CONST) && (newValue.state == LatticeValue::CONST) &&
+        (oldValue.value != newValue.value)) {
+        newValue.state = LatticeValue::OVERDEF;
+    }
+
+    if ((oldValue.state == newValue.state) && (oldValue.value == newValue.value)) {
+        return;
+    }
+
+    if (newValue.state == LatticeValue::UNDEF) {
+        return;
+    }
+
+    oldValue = newValue;
+
+    for (auto use: inst->getUses()) {
+        Instanceof(user, Instruction *, use->getUser());
+        if (user) {
+            instWorkList.push_back(user);
+        }
+    }
+}
+
+///
+/// @brief 标记控制流边可执行，目标基本块首次可执行时其中的指令都要计算
+/// @param from 源基本块
+/// @param to 目标基本块
+///
+void SCCP::markEdge(BasicBlock * from, BasicBlock * to)
+{
+    if (!to || !executableEdges.insert({from->getIndex(), to->getIndex()}).second) {
+        return;
+    }
+
+    if (!executable[to->getIndex()]) {
+        executable[to->getIndex()] = true;
+        blockWorkList.push_back(to);
+        return;
+    }
+
+    // 目标基本块已计算过，新的可执行边只影响phi指令
+    for (auto inst: to->getInsts()) {
+        if (inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+            instWorkList.push_back(inst);
+        }
+    }
+}
+
+///
+/// @brief 计算指令的格值，跳转指令则标记可执行的出边
+/// @param inst 指令
+///
+void SCCP::visit(Instruction * inst)
+{
+    IRInstOperator op = inst->getOp();
+    LatticeValue result;
+
+    if (op == IRInstOperator::IRINST_OP_PHI) {
+        visitPhi(inst);
+        return;
+    }
+
+    if ((op == IRInstOperator::IRINST_OP_BC) || (op == IRInstOperator::IRINST_OP_BT) ||
+        (op == IRInstOperator::IRINST_OP_BF)) {
+        visitTerminator(inst);
+        return;
+    }
+
+    if (!inst->hasResultValue() || (op == IRInstOperator::IRINST_OP_LABEL)) {
+        return;
+    }
+
+    if (ConstantFolder::isFoldableBinary(op)) {
+
+        LatticeValue left = getValue(inst->getOperand(0));
+        LatticeValue right = getValue(inst->getOperand(1));
+
+        if ((op == IRInstOperator::IRINST_OP_MUL_I) &&
+            (((left.state == LatticeValue::CONST) && (left.value == 0)) ||
+             ((right.state == LatticeValue::CONST) && (right.value == 0)))) {
+            // 乘以0的结果总是0
+            result.state = LatticeValue::CONST;
+            result.value = 0;
+        } else if ((left.state == LatticeValue::OVERDEF) || (right.state == LatticeValue::OVERDEF)) {
+            result.state = LatticeValue::OVERDEF;
+        } else if ((left.state == LatticeValue::CONST) && (right.state == LatticeValue::CONST)) {
+            bool folded = ConstantFolder::foldBinary(op, left.value, right.value, result.value);
+            result.state = folded ? LatticeValue::CONST : LatticeValue::OVERDEF;
+        }
+    } else if ((op == IRInstOperator::IRINST_OP_NEG_I) || (op == IRInstOperator::IRINST_OP_NOT_I)) {
+
+        LatticeValue src = getValue(inst->getOperand(0));
+
+        if (src.state == LatticeValue::CONST) {
+            bool folded = ConstantFolder::foldUnary(op, src.value, result.value);
+            result.state = folded ? LatticeValue::CONST : LatticeValue::OVERDEF;
+        } else {
+            result.state = src.state;
+        }
+    } else {
+        // 函数调用等结果不确定
+        result.state = LatticeValue::OVERDEF;
+    }
+
+    lower(inst, result);
+}
+
+///
+/// @brief 计算phi指令的格值，只考虑可执行边上的操作数
+/// @param inst phi指令
+///
+void SCCP::visitPhi(Instruction * inst)
+{
+    auto phi = static_cast<PhiInstruction *>(inst);
+    BasicBlock * block = cfg->getBlock(phi);
+    auto & incomingBlocks = phi->getIncomingBlocks();
+
+    LatticeValue result;
+
+    for (int32_t k = 0; k < phi->getOperandsNum(); ++k) {
+
+        BasicBlock * pred = cfg->getBlock(incomingBlocks[k]);
+        if (!pred || !executableEdges.count({pred->getIndex(), block->getIndex()})) {
+            continue;
+        }
+
+        LatticeValue val = getValue(phi->getOperand(k));
+
+        if (val.state == LatticeValue::UNDEF) {
+            continue;
+        }
+
+        if ((val.state == LatticeValue::OVERDEF) ||
+            ((result.state == LatticeValue::CONST) && (result.value != val.value))) {
+            result.state = LatticeValue::OVERDEF;
+            break;
+        }
+
+        result = val;
+    }
+
+    lower(phi, result);
+}
+
+///
+/// @brief 计算跳转指令可执行的出边
+/// @param inst 跳转指令
+///
+void SCCP::visitTerminator(Instruction * inst)
+{
+    BasicBlock * block = cfg->getBlock(inst);
+    auto & blocks = cfg->getBlocks();
+    BasicBlock * next = (block->getIndex() + 1 < (int32_t) blocks.size()) ? blocks[block->getIndex() + 1] : nullptr;
+
+    switch (inst->getOp()) {
+        case IRInstOperator::IRINST_OP_GOTO:
+            markEdge(block, cfg->getBlock(static_cast<GotoInstruction *>(inst)->getTarget()));
+            break;
+        case IRInstOperator::IRINST_OP_BC: {
+            auto branch = static_cast<BranchInstruction *>(inst);
+            LatticeValue cond = getValue(branch->getCondVar());
+            if (cond.state == LatticeValue::UNDEF) {
+                break;
+            }
+            if ((cond.state == LatticeValue::OVERDEF) || cond.value) {
+                markEdge(block, cfg->getBlock(branch->getTrueTarget()));
+            }
+            if ((cond.state == LatticeValue::OVERDEF) || !cond.value) {
+                markEdge(block, cfg->getBlock(branch->getFalseTarget()));
+            }
+            break;
+        }
+        case IRInstOperator::IRINST_OP_BT:
+        case IRInstOperator::IRINST_OP_BF: {
+            auto branch = static_cast<BranchInstruction *>(inst);
+            LatticeValue cond = getValue(branch->getCondVar());
+            if (cond.state == LatticeValue::UNDEF) {
+                break;
+            }
+            bool jumpOnTrue = inst->getOp() == IRInstOperator::IRINST_OP_BT;
+            if ((cond.state == LatticeValue::OVERDEF) || ((cond.value != 0) == jumpOnTrue)) {
+                markEdge(block, cfg->getBlock(branch->getTarget()));
+            }
+            if ((cond.state == LatticeValue::OVERDEF) || ((cond.value != 0) != jumpOnTrue)) {
+                markEdge(block, next);
+            }
+            break;
+        }
+        case IRInstOperator::IRINST_OP_EXIT:
+            break;
+        default:
+            // 顺序执行到下一个基本块
+            markEdge(block, next);
+            break;
+    }
+}
+
+///
+/// @brief 根据分析结果改写IR
+///
+void SCCP::rewrite()
+{
+    // 要删除的指令，以及跳转指令的替换，替换为nullptr时直接删除
+    std::unordered_set<Instruction *> removed;
+    std::unordered_map<Instruction *, Instruction *> replaced;
+
+    for (auto block: cfg->getBlocks()) {
+
+        bool live = executable[block->getIndex()];
+
+        // 出口基本块即使因死循环不可达也保留，其中的phi指令没有可执行的前驱，直接删除
+        if (!live && (block != cfg->getExit())) {
+            removed.insert(block->getInsts().begin(), block->getInsts().end());
+            continue;
+        }
+
+        for (auto inst: block->getInsts()) {
+
+            Instanceof(phi, PhiInstruction *, inst);
+            if (phi) {
+
+                if (!live) {
+                    phi->replaceAllUseWith(module->newConstInt(0));
+                    removed.insert(phi);
+                    continue;
+                }
+
+                // 删除来自不可执行边的操作数
+                std::vector<Instruction *> deadIncoming;
+                for (auto label: phi->getIncomingBlocks()) {
+                    BasicBlock * pred = cfg->getBlock(label);
+                    if (!pred || !executableEdges.count({pred->getIndex(), block->getIndex()})) {
+                        deadIncoming.push_back(label);
+                    }
+                }
+                for (auto label: deadIncoming) {
+                    phi->removeIncoming(label);
+                }
+            }
+
+            auto pIter = values.find(inst);
+            if ((pIter != values.end()) && (pIter->second.state == LatticeValue::CONST)) {
+                inst->replaceAllUseWith(module->newConstInt(pIter->second.value));
+                removed.insert(inst);
+                continue;
+            }
+
+            // 只剩一个操作数的phi指令就是该操作数
+            if (phi && (phi->getOperandsNum() == 1) && (phi->getOperand(0) != phi)) {
+                phi->replaceAllUseWith(phi->getOperand(0));
+                removed.insert(phi);
+                continue;
+            }
+
+            IRInstOperator op = inst->getOp();
+            if (!live || ((op != IRInstOperator::IRINST_OP_BC) && (op != IRInstOperator::IRINST_OP_BT) &&
+                          (op != IRInstOperator::IRINST_OP_BF))) {
+                continue;
+            }
+
+            auto branch = static_cast<BranchInstruction *>(inst);
+            LatticeValue cond = getValue(branch->getCondVar());
+            if (cond.state != LatticeValue::CONST) {
+                continue;
+            }
+
+            // 条件为常量的分支改为无条件跳转，不跳转时直接删除
+            Instruction * target = nullptr;
+            if (op == IRInstOperator::IRINST_OP_BC) {
+                target = cond.value ? branch->getTrueTarget() : branch->getFalseTarget();
+            } else if ((cond.value != 0) == (op == IRInstOperator::IRINST_OP_BT)) {
+                target = branch->getTarget();
+            }
+
+            replaced[inst] = target ? new GotoInstruction(func, target) : nullptr;
+        }
+    }
+
+    if (removed.empty() && replaced.empty()) {
+        return;
+    }
+
+    InterCode & code = func->getInterCode();
+
+    for (auto & entry: replaced) {
+        if (entry.second) {
+            code.insertBefore(entry.first, entry.second);
+        }
+        removed.insert(entry.first);
+    }
+
+    for (auto inst: removed) {
+        code.remove(inst);
+    }
+
+    // 被删除的指令可能仍被不可达的出口基本块使用，替换为0
+    for (auto inst: removed) {
+        if (inst->hasResultValue() && (inst->getOp() != IRInstOperator::IRINST_OP_LABEL)) {
+            inst->replaceAllUseWith(module->newConstInt(0));
+        }
+    }
+    for (auto inst: removed) {
+        inst->clearOperands();
+    }
+    for (auto inst: removed) {
+        delete inst;
+    }
+
+    analysis->invalidate(func);
+}
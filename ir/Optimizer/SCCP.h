@@ -0,0 +1,150 @@
+///
+/// @file SCCP.h
+/// @brief 稀疏条件常量传播
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，稀疏条件常量传播
+/// </table>
+///
+#pragma once
+
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "FunctionPass.h"
+#include "BasicBlock.h"
+#include "ControlFlowGraph.h"
+
+///
+/// @brief 稀疏条件常量传播，要求IR是SSA形式
+///
+/// 采用Wegman-Zadeck的算法，同时在SSA边与可执行的控制流边上传播格值。
+/// 结束后常量结果的指令被替换为常量，条件为常量的分支改为无条件跳转或者删除，不可达的基本块被删除。
+///
+class SCCP : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 要处理的函数
+    /// @param _module 符号表，用于常量的创建
+    /// @param _analysis 分析管理器
+    ///
+    SCCP(Function * _func, Module * _module, AnalysisManager * _analysis);
+
+    ///
+    /// @brief 执行稀疏条件常量传播
+    /// @return true 成功 false 失败
+    ///
+    bool run() override;
+
+protected:
+    ///
+    /// @brief 格值
+    ///
+    struct LatticeValue {
+
+        /// @brief 格的状态
+        enum State {
+            /// @brief 未定值，格的顶
+            UNDEF,
+
+            /// @brief 常量
+            CONST,
+
+            /// @brief 非常量，格的底
+            OVERDEF,
+        };
+
+        /// @brief 状态
+        State state = UNDEF;
+
+        /// @brief 常量值，状态为CONST时有效
+        int32_t value = 0;
+    };
+
+    ///
+    /// @brief 获取Value的格值
+    /// @param val Value
+    /// @return LatticeValue 格值
+    ///
+    LatticeValue getValue(Value * val);
+
+    ///
+    /// @brief 降低指令的格值，发生变化时把使用者加入工作表
+    /// @param inst 指令
+    /// @param newValue 新的格值
+    ///
+    void lower(Instruction * inst, LatticeValue newValue);
+
+    ///
+    /// @brief 标记控制流边可执行，目标基本块首次可执行时其中的指令都要计算
+    /// @param from 源基本块
+    /// @param to 目标基本块
+    ///
+    void markEdge(BasicBlock * from, BasicBlock * to);
+
+    ///
+    /// @brief 计算指令的格值，跳转指令则标记可执行的出边
+    /// @param inst 指令
+    ///
+    void visit(Instruction * inst);
+
+    ///
+    /// @brief 计算phi指令的格值，只考虑可执行边上的操作数
+    /// @param inst phi指令
+    ///
+    void visitPhi(Instruction * inst);
+
+    ///
+    /// @brief 计算跳转指令可执行的出边
+    /// @param inst 跳转指令
+    ///
+    void visitTerminator(Instruction * inst);
+
+    ///
+    /// @brief 根据分析结果改写IR
+    ///
+    void rewrite();
+
+private:
+    ///
+    /// @brief 控制流图
+    ///
+    ControlFlowGraph * cfg = nullptr;
+
+    ///
+    /// @brief 指令的格值，不存在时为UNDEF
+    ///
+    std::unordered_map<Instruction *, LatticeValue> values;
+
+    ///
+    /// @brief 可执行的基本块，下标为基本块编号
+    ///
+    std::vector<bool> executable;
+
+    ///
+    /// @brief 可执行的控制流边，元素为源与目标基本块的编号
+    ///
+    std::set<std::pair<int32_t, int32_t>> executableEdges;
+
+    ///
+    /// @brief 新可执行的基本块
+    ///
+    std::vector<BasicBlock *> blockWorkList;
+
+    ///
+    /// @brief 格值发生变化的指令的使用者
+    ///
+    std::vector<Instruction *> instWorkList;
+};
@@ -0,0 +1,921 @@
+///
+/// @file IRParser.cpp
+/// @brief DragonIR的文本解析器的实现
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，解析文本IR，支持.ir输入文件
+/// </table>
+///
+#include <cctype>
+#include <charconv>
+#include <climits>
+#include <cstdio>
+
+#include "Common.h"
+#include "IRConstant.h"
+#include "IRParser.h"
+#include "IntegerType.h"
+#include "VoidType.h"
+#include "ArgInstruction.h"
+#include "BinaryInstruction.h"
+#include "BranchInstruction.h"
+#include "EntryInstruction.h"
+#include "ExitInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "MoveInstruction.h"
+#include "PhiInstruction.h"
+#include "UnaryInstruction.h"
+
+/// @brief 二元运算的关键字与运算符的对应
+static const std::unordered_map<std::string_view, IRInstOperator> binaryOps = {
+    {IR_KEYWORD_ADD_I, IRInstOperator::IRINST_OP_ADD_I},
+    {IR_KEYWORD_SUB_I, IRInstOperator::IRINST_OP_SUB_I},
+    {IR_KEYWORD_MUL_I, IRInstOperator::IRINST_OP_MUL_I},
+    {IR_KEYWORD_DIV_I, IRInstOperator::IRINST_OP_DIV_I},
+    {IR_KEYWORD_MOD_I, IRInstOperator::IRINST_OP_MOD_I},
+};
+
+/// @brief icmp的条件与运算符的对应
+static const std::unordered_map<std::string_view, IRInstOperator> compareOps = {
+    {"eq", IRInstOperator::IRINST_OP_EQ_I},
+    {"ne", IRInstOperator::IRINST_OP_NE_I},
+    {"lt", IRInstOperator::IRINST_OP_LT_I},
+    {"le", IRInstOperator::IRINST_OP_LE_I},
+    {"gt", IRInstOperator::IRINST_OP_GT_I},
+    {"ge", IRInstOperator::IRINST_OP_GE_I},
+};
+
+///
+/// @brief 名字中可出现的字符
+/// @param ch 字符
+/// @return true 可以 false 不可以
+///
+static bool isNameChar(char ch)
+{
+    return isalnum((unsigned char) ch) || (ch == '_') || (ch == '.');
+}
+
+///
+/// @brief 构造函数
+/// @param _module 解析的结果加入到该模块中
+///
+IRParser::IRParser(Module * _module) : module(_module)
+{
+    placeholder = new FormalParam(IntegerType::getTypeInt(), "");
+}
+
+///
+/// @brief 析构函数
+///
+IRParser::~IRParser()
+{
+    delete placeholder;
+}
+
+///
+/// @brief 解析IR文件
+/// @param filePath IR文件路径
+/// @return true 成功 false 失败
+///
+bool IRParser::run(const std::string & filePath)
+{
+    FILE * fp = fopen(filePath.c_str(), "rb");
+    if (nullptr == fp) {
+        minic_log(LOG_ERROR, "IR文件(%s)打开失败", filePath.c_str());
+        return false;
+    }
+
+    // 一次性读入，词法分析直接在缓冲区上进行
+    std::string text;
+    char buf[65536];
+    size_t size;
+    while ((size = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        text.append(buf, size);
+    }
+
+    fclose(fp);
+
+    return parse(std::move(text));
+}
+
+///
+/// @brief 解析内存中的IR文本
+/// @param text IR文本
+/// @return true 成功 false 失败
+///
+bool IRParser::parse(std::string text)
+{
+    source = std::move(text);
+    pos = 0;
+    line = 1;
+
+    // 全局变量与函数都在全局作用域中
+    module->setCurrentFunction(nullptr);
+
+    next();
+
+    while (kind != TokenKind::END) {
+
+        bool result;
+        if (acceptWord(IR_KEYWORD_DECLARE)) {
+            result = parseGlobal();
+        } else if (acceptWord(IR_KEYWORD_DEFINE)) {
+            result = parseFunction();
+        } else {
+            result = fail("期望declare或define");
+        }
+
+        if (!result) {
+            return false;
+        }
+    }
+
+    if (!forwardFunctions.empty()) {
+        minic_log(LOG_ERROR, "函数@%s被调用但没有定义", forwardFunctions.begin()->first.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+///
+/// @brief 读取下一个单词
+///
+void IRParser::next()
+{
+    const size_t length = source.size();
+
+    // 跳过空白与注释
+    while (pos < length) {
+        char ch = source[pos];
+        if (ch == '\n') {
+            line++;
+            pos++;
+        } else if (isspace((unsigned char) ch)) {
+            pos++;
+        } else if (ch == ';') {
+            while ((pos < length) && (source[pos] != '\n')) {
+                pos++;
+            }
+        } else {
+            break;
+        }
+    }
+
+    tokenLine = line;
+
+    if (pos >= length) {
+        kind = TokenKind::END;
+        token = {};
+        return;
+    }
+
+    size_t start = pos;
+    char ch = source[pos];
+
+    if ((ch == '@') || (ch == '%') || (ch == '.')) {
+        kind = (ch == '@') ? TokenKind::GLOBAL : ((ch == '%') ? TokenKind::LOCAL : TokenKind::LABEL);
+        pos++;
+        while ((pos < length) && isNameChar(source[pos])) {
+            pos++;
+        }
+    } else if (isdigit((unsigned char) ch) || ((ch == '-') && (pos + 1 < length) && isdigit((unsigned char) source[pos + 1]))) {
+        kind = TokenKind::NUMBER;
+        pos++;
+        while ((pos < length) && isdigit((unsigned char) source[pos])) {
+            pos++;
+        }
+    } else if (isalpha((unsigned char) ch) || (ch == '_')) {
+        // 类型与名字可能紧挨着，如形参i32%t0，关键字中不含.
+        kind = TokenKind::WORD;
+        while ((pos < length) && (isalnum((unsigned char) source[pos]) || (source[pos] == '_'))) {
+            pos++;
+        }
+    } else {
+        kind = TokenKind::PUNCT;
+        pos++;
+    }
+
+    token = std::string_view(source.data() + start, pos - start);
+}
+
+///
+/// @brief 当前单词是否为指定的标点，是则跳过
+/// @param punct 标点
+/// @return true 是 false 否
+///
+bool IRParser::accept(char punct)
+{
+    if ((kind == TokenKind::PUNCT) && (token[0] == punct)) {
+        next();
+        return true;
+    }
+
+    return false;
+}
+
+///
+/// @brief 当前单词必须为指定的标点
+/// @param punct 标点
+/// @return true 是 false 否，并输出错误信息
+///
+bool IRParser::expect(char punct)
+{
+    if (accept(punct)) {
+        return true;
+    }
+
+    return fail(std::string("期望") + punct);
+}
+
+///
+/// @brief 当前单词是否为指定的关键字，是则跳过
+/// @param word 关键字
+/// @return true 是 false 否
+///
+bool IRParser::acceptWord(std::string_view word)
+{
+    if ((kind == TokenKind::WORD) && (token == word)) {
+        next();
+        return true;
+    }
+
+    return false;
+}
+
+///
+/// @brief 输出带有行号的错误信息
+/// @param msg 错误信息
+/// @return false
+///
+bool IRParser::fail(const std::string & msg)
+{
+    std::string near = (kind == TokenKind::END) ? "文件结束" : std::string(token);
+    minic_log(LOG_ERROR, "IR第%d行错误：%s，在%s附近", tokenLine, msg.c_str(), near.c_str());
+    return false;
+}
+
+///
+/// @brief 解析类型
+/// @return Type* 类型，失败时为nullptr
+///
+Type * IRParser::parseType()
+{
+    Type * type = nullptr;
+
+    if (kind == TokenKind::WORD) {
+        if (token == "i32") {
+            type = IntegerType::getTypeInt();
+        } else if (token == "i1") {
+            type = IntegerType::getTypeBool();
+        } else if (token == "void") {
+            type = VoidType::getType();
+        }
+    }
+
+    if (!type) {
+        fail("不支持的类型");
+        return nullptr;
+    }
+
+    next();
+
+    return type;
+}
+
+///
+/// @brief 解析操作数，后面才定义的临时变量返回占位的Value
+/// @return Value* 操作数，失败时为nullptr
+///
+Value * IRParser::parseValue()
+{
+    Value * val = nullptr;
+
+    if (kind == TokenKind::NUMBER) {
+
+        int64_t intVal = 0;
+        auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), intVal);
+        if ((ec != std::errc()) || (ptr != token.data() + token.size()) || (intVal < INT32_MIN) ||
+            (intVal > UINT32_MAX)) {
+            fail("整数越界");
+            return nullptr;
+        }
+
+        val = module->newConstInt((int32_t) intVal);
+
+    } else if (kind == TokenKind::GLOBAL) {
+
+        val = module->findVarValue(std::string(token.substr(1)));
+        if (!val) {
+            fail("全局变量没有声明");
+            return nullptr;
+        }
+
+    } else if (kind == TokenKind::LOCAL) {
+
+        auto pIter = values.find(token);
+        if (pIter != values.end()) {
+            val = pIter->second;
+        } else if (tempTypes.count(token)) {
+            // 后面才定义的临时变量，如phi指令引用循环体中的值
+            forwardNames.emplace_back(token, tokenLine);
+            val = placeholder;
+        } else {
+            fail("变量没有声明");
+            return nullptr;
+        }
+
+    } else {
+        fail("期望操作数");
+        return nullptr;
+    }
+
+    next();
+
+    return val;
+}
+
+///
+/// @brief 解析Label的引用，不存在时新建
+/// @return LabelInstruction* Label指令，失败时为nullptr
+///
+LabelInstruction * IRParser::parseLabelRef()
+{
+    if (kind != TokenKind::LABEL) {
+        fail("期望Label");
+        return nullptr;
+    }
+
+    LabelInstruction *& label = labels[token];
+    if (!label) {
+        label = new LabelInstruction(func, std::string(token));
+    }
+
+    next();
+
+    return label;
+}
+
+///
+/// @brief 指令建立后记录引用占位Value的操作数，函数结束时回填
+/// @param inst 指令
+///
+void IRParser::bindForward(Instruction * inst)
+{
+    if (forwardNames.empty()) {
+        return;
+    }
+
+    size_t index = 0;
+    for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+        if ((inst->getOperand(k) == placeholder) && (index < forwardNames.size())) {
+            fixups.push_back(Fixup{inst, k, forwardNames[index].first, forwardNames[index].second});
+            index++;
+        }
+    }
+
+    forwardNames.clear();
+}
+
+///
+/// @brief 指令加入当前函数，有名字时记录指令的结果
+/// @param inst 指令
+/// @param name 结果的名字
+/// @return true 成功 false 名字重复定义
+///
+bool IRParser::addInst(Instruction * inst, std::string_view name)
+{
+    bindForward(inst);
+
+    func->getInterCode().addInst(inst);
+
+    if (!name.empty()) {
+        if (!values.emplace(name, inst).second) {
+            return fail("变量" + std::string(name) + "重复定义");
+        }
+        inst->setIRName(std::string(name));
+    }
+
+    return true;
+}
+
+///
+/// @brief 解析全局变量的声明
+/// @return true 成功 false 失败
+///
+bool IRParser::parseGlobal()
+{
+    Type * type = parseType();
+    if (!type) {
+        return false;
+    }
+
+    if (kind != TokenKind::GLOBAL) {
+        return fail("期望全局变量名");
+    }
+
+    if (!module->newVarValue(type, std::string(token.substr(1)))) {
+        return fail("全局变量重复定义");
+    }
+
+    next();
+
+    return true;
+}
+
+///
+/// @brief 解析函数定义
+/// @return true 成功 false 失败
+///
+bool IRParser::parseFunction()
+{
+    Type * returnType = parseType();
+    if (!returnType) {
+        return false;
+    }
+
+    if (kind != TokenKind::GLOBAL) {
+        return fail("期望函数名");
+    }
+
+    std::string name(token.substr(1));
+    next();
+
+    // 形参，Function::toString输出时类型与名字之间没有空格
+    std::vector<FormalParam *> params;
+    std::vector<std::string_view> paramNames;
+    if (!expect('(')) {
+        return false;
+    }
+    if (!accept(')')) {
+        do {
+            Type * type = parseType();
+            if (!type) {
+                return false;
+            }
+            if (kind != TokenKind::LOCAL) {
+                return fail("期望形参名");
+            }
+            params.push_back(new FormalParam(type, ""));
+            paramNames.push_back(token);
+            next();
+        } while (accept(','));
+
+        if (!expect(')')) {
+            return false;
+        }
+    }
+
+    func = module->findFunction(name);
+    if (func) {
+        auto pIter = forwardFunctions.find(name);
+        if (pIter == forwardFunctions.end()) {
+            return fail("函数@" + name + "重复定义");
+        }
+
+        // 先调用后定义的函数，定义必须与调用时的返回类型、形参个数与类型一致
+        auto & forwardParams = func->getParams();
+        bool same = (func->getReturnType()->toString() == returnType->toString()) &&
+                    (forwardParams.size() == params.size());
+        for (size_t k = 0; same && (k < params.size()); ++k) {
+            same = forwardParams[k]->getType()->toString() == params[k]->getType()->toString();
+        }
+        if (!same) {
+            for (auto param: params) {
+                delete param;
+            }
+            return fail("函数@" + name + "的定义与调用不一致");
+        }
+
+        // 函数类型由调用时建立，已与定义一致，形参替换为定义中的形参
+        forwardFunctions.erase(pIter);
+        for (auto param: forwardParams) {
+            delete param;
+        }
+        forwardParams.assign(params.begin(), params.end());
+    } else {
+        func = module->newFunction(name, returnType, params);
+    }
+
+    values.clear();
+    tempTypes.clear();
+    labels.clear();
+    definedLabels.clear();
+    fixups.clear();
+    pendingArgs.clear();
+
+    for (size_t k = 0; k < params.size(); ++k) {
+        params[k]->setIRName(std::string(paramNames[k]));
+        if (!values.emplace(paramNames[k], params[k]).second) {
+            return fail("形参" + std::string(paramNames[k]) + "重复定义");
+        }
+    }
+
+    if (!expect('{')) {
+        return false;
+    }
+
+    while (!accept('}')) {
+
+        bool result;
+        if (kind == TokenKind::END) {
+            result = fail("函数没有结束");
+        } else if (acceptWord(IR_KEYWORD_DECLARE)) {
+            result = parseDeclare();
+        } else {
+            result = parseInstruction();
+        }
+
+        if (!result) {
+            return false;
+        }
+    }
+
+    return finishFunction();
+}
+
+///
+/// @brief 解析函数内变量的声明
+/// @return true 成功 false 失败
+///
+bool IRParser::parseDeclare()
+{
+    Type * type = parseType();
+    if (!type) {
+        return false;
+    }
+
+    if (kind != TokenKind::LOCAL) {
+        return fail("期望变量名");
+    }
+
+    std::string_view name = token;
+
+    // 临时变量只记录类型，由定义它的指令产生
+    if (name.substr(0, 2) == IR_TEMP_VARNAME_PREFIX) {
+        tempTypes[name] = type;
+        next();
+        return true;
+    }
+
+    // 局部变量的注释中含作用域层级与源程序中的名字，即; 1:a，词法分析会跳过注释，这里直接读取
+    int32_t scopeLevel = 1;
+    std::string realName;
+
+    size_t cursor = pos;
+    while ((cursor < source.size()) && ((source[cursor] == ' ') || (source[cursor] == '\t'))) {
+        cursor++;
+    }
+    if ((cursor < source.size()) && (source[cursor] == ';')) {
+        size_t end = source.find('\n', cursor);
+        std::string_view comment(source.data() + cursor + 1,
+                                 ((end == std::string::npos) ? source.size() : end) - cursor - 1);
+        size_t colon = comment.find(':');
+        if (colon != std::string_view::npos) {
+            int32_t level = 0;
+            size_t first = comment.find_first_not_of(' ');
+            auto [ptr, ec] = std::from_chars(comment.data() + first, comment.data() + colon, level);
+            if ((ec == std::errc()) && (ptr == comment.data() + colon)) {
+                scopeLevel = level;
+                realName = std::string(comment.substr(colon + 1));
+                realName.erase(realName.find_last_not_of(" \t\r") + 1);
+            }
+        }
+    }
+
+    LocalVariable * var = func->newLocalVarValue(type, realName, scopeLevel);
+    var->setIRName(std::string(name));
+    if (!values.emplace(name, var).second) {
+        return fail("变量" + std::string(name) + "重复定义");
+    }
+
+    next();
+
+    return true;
+}
+
+///
+/// @brief 解析一条指令
+/// @return true 成功 false 失败
+///
+bool IRParser::parseInstruction()
+{
+    // Label定义
+    if (kind == TokenKind::LABEL) {
+        std::string_view labelName = token;
+        LabelInstruction * label = parseLabelRef();
+        if (!label || !expect(':')) {
+            return false;
+        }
+        if (!definedLabels.insert(labelName).second) {
+            return fail("Label" + std::string(labelName) + "重复定义");
+        }
+        return addInst(label);
+    }
+
+    // 有结果的指令或者赋值
+    if (kind == TokenKind::LOCAL || kind == TokenKind::GLOBAL) {
+        return parseDefinition(token);
+    }
+
+    if (kind != TokenKind::WORD) {
+        return fail("期望指令");
+    }
+
+    if (acceptWord("entry")) {
+        return addInst(new EntryInstruction(func));
+    }
+
+    int32_t instLine = tokenLine;
+
+    if (acceptWord("exit")) {
+        // 有返回值时同一行紧跟操作数
+        Value * result = nullptr;
+        if ((tokenLine == instLine) && (kind == TokenKind::LOCAL || kind == TokenKind::GLOBAL || kind == TokenKind::NUMBER)) {
+            result = parseValue();
+            if (!result) {
+                return false;
+            }
+        }
+        return addInst(new ExitInstruction(func, result));
+    }
+
+    if (acceptWord("br")) {
+        if (!acceptWord("label")) {
+            return fail("期望label");
+        }
+        LabelInstruction * target = parseLabelRef();
+        if (!target) {
+            return false;
+        }
+        return addInst(new GotoInstruction(func, target));
+    }
+
+    if (acceptWord("bc")) {
+        Value * cond = parseValue();
+        if (!cond || !expect(',')) {
+            return false;
+        }
+        LabelInstruction * trueTarget = parseLabelRef();
+        if (!trueTarget || !expect(',')) {
+            return false;
+        }
+        LabelInstruction * falseTarget = parseLabelRef();
+        if (!falseTarget) {
+            return false;
+        }
+        return addInst(new BranchInstruction(func, IRInstOperator::IRINST_OP_BC, cond, trueTarget, falseTarget));
+    }
+
+    if ((token == "bt") || (token == "bf")) {
+        IRInstOperator op = (token == "bt") ? IRInstOperator::IRINST_OP_BT : IRInstOperator::IRINST_OP_BF;
+        next();
+        Value * cond = parseValue();
+        if (!cond || !expect(',')) {
+            return false;
+        }
+        LabelInstruction * target = parseLabelRef();
+        if (!target) {
+            return false;
+        }
+        return addInst(new BranchInstruction(func, op, cond, target));
+    }
+
+    if (acceptWord("arg")) {
+        Value * arg = parseValue();
+        if (!arg) {
+            return false;
+        }
+        pendingArgs.push_back(arg);
+        return addInst(new ArgInstruction(func, arg));
+    }
+
+    if (acceptWord("call")) {
+        return parseCall({});
+    }
+
+    return fail("不支持的指令");
+}
+
+///
+/// @brief 解析有结果的指令，或者赋值指令
+/// @param name 结果或者赋值目标的名字
+/// @return true 成功 false 失败
+///
+bool IRParser::parseDefinition(std::string_view name)
+{
+    bool isGlobal = (kind == TokenKind::GLOBAL);
+    next();
+
+    if (!expect('=')) {
+        return false;
+    }
+
+    // 赋值指令，目的操作数为局部变量、全局变量或者形参
+    if (kind != TokenKind::WORD) {
+
+        Value * dst;
+        if (isGlobal) {
+            dst = module->findVarValue(std::string(name.substr(1)));
+        } else {
+            auto pIter = values.find(name);
+            dst = (pIter == values.end()) ? nullptr : pIter->second;
+        }
+        if (!dst) {
+            return fail("赋值的变量" + std::string(name) + "没有声明");
+        }
+
+        Value * src = parseValue();
+        if (!src) {
+            return false;
+        }
+
+        return addInst(new MoveInstruction(func, dst, src));
+    }
+
+    if (isGlobal) {
+        return fail("指令的结果不能是全局变量");
+    }
+
+    // 指令结果的类型以declare为准，没有声明时按指令推断
+    auto typeIter = tempTypes.find(name);
+    Type * declared = (typeIter == tempTypes.end()) ? nullptr : typeIter->second;
+
+    if (acceptWord("call")) {
+        return parseCall(name);
+    }
+
+    if (acceptWord("phi")) {
+        Type * type = parseType();
+        if (!type) {
+            return false;
+        }
+
+        PhiInstruction * phi = new PhiInstruction(func, declared ? declared : type);
+        do {
+            if (!expect('[')) {
+                return false;
+            }
+            Value * val = parseValue();
+            if (!val || !expect(',')) {
+                return false;
+            }
+            LabelInstruction * block = parseLabelRef();
+            if (!block || !expect(']')) {
+                return false;
+            }
+            phi->addIncoming(val, block);
+        } while (accept(','));
+
+        return addInst(phi, name);
+    }
+
+    if ((token == "neg") || (token == "not")) {
+        IRInstOperator op = (token == "neg") ? IRInstOperator::IRINST_OP_NEG_I : IRInstOperator::IRINST_OP_NOT_I;
+        next();
+        Value * src = parseValue();
+        if (!src) {
+            return false;
+        }
+        Type * type = declared ? declared : src->getType();
+        return addInst(new UnaryInstruction(func, op, src, type), name);
+    }
+
+    IRInstOperator op;
+    Type * type;
+    if (acceptWord("icmp")) {
+        auto opIter = (kind == TokenKind::WORD) ? compareOps.find(token) : compareOps.end();
+        if (opIter == compareOps.end()) {
+            return fail("不支持的比较条件");
+        }
+        op = opIter->second;
+        type = IntegerType::getTypeBool();
+        next();
+    } else {
+        auto opIter = binaryOps.find(token);
+        if (opIter == binaryOps.end()) {
+            return fail("不支持的指令");
+        }
+        op = opIter->second;
+        type = IntegerType::getTypeInt();
+        next();
+    }
+
+    Value * src1 = parseValue();
+    if (!src1 || !expect(',')) {
+        return false;
+    }
+    Value * src2 = parseValue();
+    if (!src2) {
+        return false;
+    }
+
+    return addInst(new BinaryInstruction(func, op, src1, src2, declared ? declared : type), name);
+}
+
+///
+/// @brief 解析函数调用，结果名字为空时为无返回值的调用
+/// @param name 结果的名字
+/// @return true 成功 false 失败
+///
+bool IRParser::parseCall(std::string_view name)
+{
+    Type * returnType = parseType();
+    if (!returnType) {
+        return false;
+    }
+
+    if (kind != TokenKind::GLOBAL) {
+        return fail("期望函数名");
+    }
+
+    std::string calleeName(token.substr(1));
+    next();
+
+    std::vector<Value *> args;
+    if (!expect('(')) {
+        return false;
+    }
+    if (!accept(')')) {
+        do {
+            if (!parseType()) {
+                return false;
+            }
+            Value * arg = parseValue();
+            if (!arg) {
+                return false;
+            }
+            args.push_back(arg);
+        } while (accept(','));
+
+        if (!expect(')')) {
+            return false;
+        }
+    }
+
+    // 有arg指令时call中不再输出实参
+    if (args.empty()) {
+        args.swap(pendingArgs);
+    }
+    pendingArgs.clear();
+
+    Function * callee = module->findFunction(calleeName);
+    if (!callee) {
+        // 先调用后定义，按实参建立函数，定义时再补充
+        std::vector<FormalParam *> params;
+        for (auto arg: args) {
+            params.push_back(new FormalParam(arg == placeholder ? IntegerType::getTypeInt() : arg->getType(), ""));
+        }
+        callee = module->newFunction(calleeName, returnType, params);
+        forwardFunctions.emplace(calleeName, callee);
+    }
+
+    // 与IRGenerator一样记录函数调用的信息，后端分配栈帧时需要
+    func->setExistFuncCall(true);
+    if ((int32_t) args.size() > func->getMaxFuncCallArgCnt()) {
+        func->setMaxFuncCallArgCnt((int32_t) args.size());
+    }
+
+    Type * type = name.empty() ? (Type *) VoidType::getType() : returnType;
+
+    return addInst(new FuncCallInstruction(func, callee, args, type), name);
+}
+
+///
+/// @brief 函数结束时回填占位的操作数，检查Label都已定义
+/// @return true 成功 false 失败
+///
+bool IRParser::finishFunction()
+{
+    bool result = true;
+
+    for (auto & fixup: fixups) {
+        auto pIter = values.find(fixup.name);
+        if (pIter == values.end()) {
+            minic_log(LOG_ERROR, "IR第%d行错误：临时变量%s没有定义", fixup.line, std::string(fixup.name).c_str());
+            result = false;
+            continue;
+        }
+        fixup.user->setOperand(fixup.pos, pIter->second);
+    }
+
+    for (auto & pair: labels) {
+        if (!definedLabels.count(pair.first)) {
+            minic_log(LOG_ERROR, "函数@%s中的Label%s没有定义", func->getName().c_str(), std::string(pair.first).c_str());
+            result = false;
+        }
+    }
+
+    fixups.clear();
+    func = nullptr;
+
+    return result;
+}
@@ -0,0 +1,256 @@
+///
+/// @file IRParser.h
+/// @brief DragonIR的文本解析器，把Module::outputIR输出的IR重新加载到Module中
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，解析文本IR，支持.ir输入文件
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Module.h"
+#include "LabelInstruction.h"
+
+///
+/// @brief DragonIR的文本解析器
+///
+/// 手写的单遍递归下降解析器，整个文件读入内存后直接在缓冲区上做词法分析，名字以string_view的形式
+/// 保存在散列表中，不再复制字符串。Label在第一次引用时即创建，定义时加入指令序列；
+/// phi指令等引用后面才定义的临时变量时先用占位的Value，函数结束时统一回填。
+///
+/// 名字的约定与Function::renameIR一致：%l开头的为局部变量，%t开头的为形参或者指令的结果，
+/// declare中%t开头的临时变量只记录类型，由定义它的指令产生。
+///
+class IRParser {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _module 解析的结果加入到该模块中
+    ///
+    explicit IRParser(Module * _module);
+
+    ///
+    /// @brief 析构函数
+    ///
+    ~IRParser();
+
+    ///
+    /// @brief 解析IR文件
+    /// @param filePath IR文件路径
+    /// @return true 成功 false 失败
+    ///
+    bool run(const std::string & filePath);
+
+    ///
+    /// @brief 解析内存中的IR文本
+    /// @param text IR文本
+    /// @return true 成功 false 失败
+    ///
+    bool parse(std::string text);
+
+private:
+    /// @brief 单词的种类
+    enum class TokenKind : uint8_t {
+        /// @brief 文件结束
+        END,
+        /// @brief 关键字或类型名，如add、i32等
+        WORD,
+        /// @brief 整数
+        NUMBER,
+        /// @brief @开头的全局名字
+        GLOBAL,
+        /// @brief %开头的局部名字
+        LOCAL,
+        /// @brief .开头的Label名字
+        LABEL,
+        /// @brief 单个字符的标点
+        PUNCT,
+    };
+
+    /// @brief 回填信息，指令的第pos个操作数引用了后面才定义的临时变量
+    struct Fixup {
+        /// @brief 指令
+        User * user;
+        /// @brief 操作数的位置
+        int32_t pos;
+        /// @brief 临时变量的名字
+        std::string_view name;
+        /// @brief 所在的行号
+        int32_t line;
+    };
+
+    ///
+    /// @brief 读取下一个单词
+    ///
+    void next();
+
+    ///
+    /// @brief 当前单词是否为指定的标点，是则跳过
+    /// @param punct 标点
+    /// @return true 是 false 否
+    ///
+    bool accept(char punct);
+
+    ///
+    /// @brief 当前单词必须为指定的标点
+    /// @param punct 标点
+    /// @return true 是 false 否，并输出错误信息
+    ///
+    bool expect(char punct);
+
+    ///
+    /// @brief 当前单词是否为指定的关键字，是则跳过
+    /// @param word 关键字
+    /// @return true 是 false 否
+    ///
+    bool acceptWord(std::string_view word);
+
+    ///
+    /// @brief 输出带有行号的错误信息
+    /// @param msg 错误信息
+    /// @return false
+    ///
+    bool fail(const std::string & msg);
+
+    ///
+    /// @brief 解析类型
+    /// @return Type* 类型，失败时为nullptr
+    ///
+    Type * parseType();
+
+    ///
+    /// @brief 解析操作数，后面才定义的临时变量返回占位的Value
+    /// @return Value* 操作数，失败时为nullptr
+    ///
+    Value * parseValue();
+
+    ///
+    /// @brief 解析Label的引用，不存在时新建
+    /// @return LabelInstruction* Label指令，失败时为nullptr
+    ///
+    LabelInstruction * parseLabelRef();
+
+    ///
+    /// @brief 指令建立后记录引用占位Value的操作数，函数结束时回填
+    /// @param inst 指令
+    ///
+    void bindForward(Instruction * inst);
+
+    ///
+    /// @brief 解析全局变量的声明
+    /// @return true 成功 false 失败
+    ///
+    bool parseGlobal();
+
+    ///
+    /// @brief 解析函数定义
+    /// @return true 成功 false 失败
+    ///
+    bool parseFunction();
+
+    ///
+    /// @brief 解析函数内变量的声明
+    /// @return true 成功 false 失败
+    ///
+    bool parseDeclare();
+
+    ///
+    /// @brief 解析一条指令
+    /// @return true 成功 false 失败
+    ///
+    bool parseInstruction();
+
+    ///
+    /// @brief 解析有结果的指令，或者赋值指令
+    /// @param name 结果或者赋值目标的名字
+    /// @return true 成功 false 失败
+    ///
+    bool parseDefinition(std::string_view name);
+
+    ///
+    /// @brief 解析函数调用，结果名字为空时为无返回值的调用
+    /// @param name 结果的名字
+    /// @return true 成功 false 失败
+    ///
+    bool parseCall(std::string_view name);
+
+    ///
+    /// @brief 函数结束时回填占位的操作数，检查Label都已定义
+    /// @return true 成功 false 失败
+    ///
+    bool finishFunction();
+
+    ///
+    /// @brief 指令加入当前函数，有名字时记录指令的结果
+    /// @param inst 指令
+    /// @param name 结果的名字
+    /// @return true 成功 false 名字重复定义
+    ///
+    bool addInst(Instruction * inst, std::string_view name = {});
+
+    /// @brief 模块
+    Module * module;
+
+    /// @brief IR文本，所有的string_view都指向该缓冲区
+    std::string source;
+
+    /// @brief 当前的读取位置
+    size_t pos = 0;
+
+    /// @brief 当前的行号
+    int32_t line = 1;
+
+    /// @brief 当前单词的种类
+    TokenKind kind = TokenKind::END;
+
+    /// @brief 当前单词的文本
+    std::string_view token;
+
+    /// @brief 当前单词所在的行号
+    int32_t tokenLine = 1;
+
+    /// @brief 当前解析的函数
+    Function * func = nullptr;
+
+    /// @brief 函数内已定义的名字，含形参、局部变量以及指令的结果
+    std::unordered_map<std::string_view, Value *> values;
+
+    /// @brief 函数内declare声明的临时变量的类型
+    std::unordered_map<std::string_view, Type *> tempTypes;
+
+    /// @brief 函数内的Label，定义时加入definedLabels
+    std::unordered_map<std::string_view, LabelInstruction *> labels;
+
+    /// @brief 函数内已定义的Label
+    std::unordered_set<std::string_view> definedLabels;
+
+    /// @brief 函数内需要回填的操作数
+    std::vector<Fixup> fixups;
+
+    /// @brief 当前指令引用的后面才定义的临时变量，次序与操作数一致
+    std::vector<std::pair<std::string_view, int32_t>> forwardNames;
+
+    /// @brief 后面才定义的临时变量的占位Value
+    Value * placeholder;
+
+    /// @brief arg指令传递的实参，call指令中没有实参时使用
+    std::vector<Value *> pendingArgs;
+
+    /// @brief 先调用后定义的函数
+    std::unordered_map<std::string, Function *> forwardFunctions;
+};
@@ -0,0 +1,154 @@
+///
+/// @file AnalysisManager.cpp
+/// @brief 函数分析结果的缓存与失效管理
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，控制流图等分析结果的缓存与失效
+/// </table>
+///
+#include "AnalysisManager.h"
+
+///
+/// @brief 析构函数，释放缓存的分析结果
+///
+AnalysisManager::~AnalysisManager()
+{
+    clear();
+}
+
+///
+/// @brief 获取函数的控制流图
+/// @param func 函数
+/// @return ControlFlowGraph* 控制流图
+///
+ControlFlowGraph * AnalysisManager::getCFG(Function * func)
+{
+    return func->getCFG();
+}
+
+///
+/// @brief 获取函数的支配树，不存在或者已过期时重新计算
+/// @param func 函数
+/// @return DominatorTree* 支配树
+///
+DominatorTree * AnalysisManager::getDomTree(Function * func)
+{
+    ControlFlowGraph * cfg = func->getCFG();
+    FunctionAnalyses & result = analyses[func];
+
+    // 控制流图已重建，基于旧控制流图的结果不能再用
+    if (result.domTree && (result.domTreeVersion != func->getCFGVersion())) {
+        delete result.domTree;
+        result.domTree = nullptr;
+    }
+
+    if (!result.domTree) {
+        result.domTree = new DominatorTree(cfg);
+        result.domTreeVersion = func->getCFGVersion();
+    }
+
+    return result.domTree;
+}
+
+///
+/// @brief 获取函数的活跃变量分析结果，不存在或者已过期时重新计算
+/// @param func 函数
+/// @return Liveness* 活跃变量分析结果
+///
+Liveness * AnalysisManager::getLiveness(Function * func)
+{
+    ControlFlowGraph * cfg = func->getCFG();
+    FunctionAnalyses & result = analyses[func];
+
+    if (result.liveness && (result.livenessVersion != func->getCFGVersion())) {
+        delete result.liveness;
+        result.liveness = nullptr;
+    }
+
+    if (!result.liveness) {
+        result.liveness = new Liveness(cfg);
+        result.livenessVersion = func->getCFGVersion();
+    }
+
+    return result.liveness;
+}
+
+///
+/// @brief 获取函数的循环信息，不存在或者已过期时重新计算
+/// @param func 函数
+/// @return LoopInfo* 循环信息
+///
+LoopInfo * AnalysisManager::getLoopInfo(Function * func)
+{
+    // 循环的识别需要支配树，先获取以保证两者基于同一个控制流图
+    DominatorTree * domTree = getDomTree(func);
+    FunctionAnalyses & result = analyses[func];
+
+    if (result.loopInfo && (result.loopInfoVersion != func->getCFGVersion())) {
+        delete result.loopInfo;
+        result.loopInfo = nullptr;
+    }
+
+    if (!result.loopInfo) {
+        result.loopInfo = new LoopInfo(func->getCFG(), domTree);
+        result.loopInfoVersion = func->getCFGVersion();
+    }
+
+    return result.loopInfo;
+}
+
+///
+/// @brief 使函数中未保持的分析失效
+/// @param func 函数
+/// @param preserved 仍然有效的分析，默认全部失效
+///
+void AnalysisManager::invalidate(Function * func, const AnalysisSet & preserved)
+{
+    bool keepCFG = preserved.count(AnalysisID::ANALYSIS_CFG) != 0;
+
+    auto pIter = analyses.find(func);
+    if (pIter != analyses.end()) {
+
+        FunctionAnalyses & result = pIter->second;
+
+        if (!keepCFG || !preserved.count(AnalysisID::ANALYSIS_DOMTREE)) {
+            delete result.domTree;
+            result.domTree = nullptr;
+        }
+
+        if (!keepCFG || !preserved.count(AnalysisID::ANALYSIS_LIVENESS)) {
+            delete result.liveness;
+            result.liveness = nullptr;
+        }
+
+        if (!keepCFG || !preserved.count(AnalysisID::ANALYSIS_LOOPS)) {
+            delete result.loopInfo;
+            result.loopInfo = nullptr;
+        }
+    }
+
+    if (!keepCFG) {
+        func->invalidateCFG();
+    }
+}
+
+///
+/// @brief 清除所有缓存的分析结果
+///
+void AnalysisManager::clear()
+{
+    for (auto & item: analyses) {
+        delete item.second.domTree;
+        delete item.second.liveness;
+        delete item.second.loopInfo;
+    }
+
+    analyses.clear();
+}
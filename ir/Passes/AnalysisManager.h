@@ -0,0 +1,132 @@
+///
+/// @file AnalysisManager.h
+/// @brief 函数分析结果的缓存与失效管理
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，控制流图等分析结果的缓存与失效
+/// </table>
+///
+#pragma once
+
+#include <set>
+#include <unordered_map>
+
+#include "Function.h"
+#include "ControlFlowGraph.h"
+#include "DominatorTree.h"
+#include "Liveness.h"
+#include "LoopInfo.h"
+
+///
+/// @brief 分析的种类
+///
+enum class AnalysisID {
+    /// @brief 控制流图
+    ANALYSIS_CFG,
+
+    /// @brief 支配树与支配边界
+    ANALYSIS_DOMTREE,
+
+    /// @brief 活跃变量
+    ANALYSIS_LIVENESS,
+
+    /// @brief 自然循环
+    ANALYSIS_LOOPS,
+};
+
+///
+/// @brief 分析的集合，用于描述Pass执行后仍然有效的分析
+///
+using AnalysisSet = std::set<AnalysisID>;
+
+///
+/// @brief 分析管理器，按函数缓存分析结果，Pass执行后使未保持的分析失效
+///
+/// 支配树、活跃变量与循环信息都依赖于控制流图，控制流图失效时一并失效。
+/// 控制流图本身缓存在Function中，这里只负责使其失效。
+///
+class AnalysisManager {
+
+public:
+    ///
+    /// @brief 析构函数，释放缓存的分析结果
+    ///
+    ~AnalysisManager();
+
+    ///
+    /// @brief 获取函数的控制流图
+    /// @param func 函数
+    /// @return ControlFlowGraph* 控制流图
+    ///
+    ControlFlowGraph * getCFG(Function * func);
+
+    ///
+    /// @brief 获取函数的支配树，不存在或者已过期时重新计算
+    /// @param func 函数
+    /// @return DominatorTree* 支配树
+    ///
+    DominatorTree * getDomTree(Function * func);
+
+    ///
+    /// @brief 获取函数的活跃变量分析结果，不存在或者已过期时重新计算
+    /// @param func 函数
+    /// @return Liveness* 活跃变量分析结果
+    ///
+    Liveness * getLiveness(Function * func);
+
+    ///
+    /// @brief 获取函数的循环信息，不存在或者已过期时重新计算
+    /// @param func 函数
+    /// @return LoopInfo* 循环信息
+    ///
+    LoopInfo * getLoopInfo(Function * func);
+
+    ///
+    /// @brief 使函数中未保持的分析失效
+    /// @param func 函数
+    /// @param preserved 仍然有效的分析，默认全部失效
+    ///
+    void invalidate(Function * func, const AnalysisSet & preserved = AnalysisSet());
+
+    ///
+    /// @brief 清除所有缓存的分析结果
+    ///
+    void clear();
+
+private:
+    ///
+    /// @brief 一个函数的分析结果
+    ///
+    struct FunctionAnalyses {
+
+        /// @brief 支配树
+        DominatorTree * domTree = nullptr;
+
+        /// @brief 计算支配树时控制流图的版本号
+        uint32_t domTreeVersion = 0;
+
+        /// @brief 活跃变量
+        Liveness * liveness = nullptr;
+
+        /// @brief 计算活跃变量时控制流图的版本号
+        uint32_t livenessVersion = 0;
+
+        /// @brief 循环信息
+        LoopInfo * loopInfo = nullptr;
+
+        /// @brief 计算循环信息时控制流图的版本号
+        uint32_t loopInfoVersion = 0;
+    };
+
+    ///
+    /// @brief 按函数缓存的分析结果
+    ///
+    std::unordered_map<Function *, FunctionAnalyses> analyses;
+};
@@ -0,0 +1,124 @@
+///
+/// @file FunctionPass.cpp
+/// @brief 以函数为单位的Pass的基类
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，函数级Pass的基类
+/// </table>
+///
+#include <unordered_set>
+
+#include "Common.h"
+#include "FunctionPass.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 构造函数
+/// @param _func 要处理的函数
+/// @param _module 符号表
+/// @param _analysis 分析管理器，用于获取控制流图、支配树等分析结果
+///
+FunctionPass::FunctionPass(Function * _func, Module * _module, AnalysisManager * _analysis)
+    : func(_func), module(_module), analysis(_analysis)
+{}
+
+///
+/// @brief 获取Pass执行后仍然有效的分析，默认所有分析都失效
+/// @return AnalysisSet 有效的分析
+///
+AnalysisSet FunctionPass::getPreserved()
+{
+    return AnalysisSet();
+}
+
+///
+/// @brief 删除从入口不可达的基本块，出口基本块总是保留
+/// @return true 有删除 false 没有删除
+///
+bool FunctionPass::removeUnreachableBlocks()
+{
+    ControlFlowGraph * cfg = analysis->getCFG(func);
+
+    std::unordered_set<Instruction *> deadInsts;
+    for (auto block: cfg->getBlocks()) {
+
+        // 出口基本块保留，即使死循环导致其不可达
+        if ((block->getRPONumber() == -1) && (block != cfg->getExit())) {
+            deadInsts.insert(block->getInsts().begin(), block->getInsts().end());
+        }
+    }
+
+    if (deadInsts.empty()) {
+        return false;
+    }
+
+    InterCode & insts = func->getInterCode();
+
+    // 可达基本块中的phi指令删除来自不可达前驱的操作数
+    for (auto inst: insts) {
+        Instanceof(phi, PhiInstruction *, inst);
+        if (phi && !deadInsts.count(phi)) {
+            std::vector<Instruction *> deadIncoming;
+            for (auto label: phi->getIncomingBlocks()) {
+                if (deadInsts.count(label)) {
+                    deadIncoming.push_back(label);
+                }
+            }
+            for (auto label: deadIncoming) {
+                phi->removeIncoming(label);
+            }
+        }
+    }
+
+    for (auto inst: deadInsts) {
+        insts.remove(inst);
+    }
+
+    // 先清除操作数再释放，避免指令之间相互引用
+    for (auto inst: deadInsts) {
+        inst->clearOperands();
+    }
+    for (auto inst: deadInsts) {
+        delete inst;
+    }
+
+    analysis->invalidate(func);
+
+    return true;
+}
+
+///
+/// @brief 删除没有被使用的局部变量，形参不在此列
+/// @return true 有删除 false 没有删除
+///
+bool FunctionPass::removeUnusedVars()
+{
+    bool changed = false;
+
+    auto & vars = func->getVarValues();
+    for (auto pIter = vars.begin(); pIter != vars.end();) {
+
+        LocalVariable * var = *pIter;
+        if (var->getUses().empty()) {
+
+            if (func->getReturnValue() == var) {
+                func->setReturnValue(nullptr);
+            }
+
+            delete var;
+            pIter = vars.erase(pIter);
+            changed = true;
+        } else {
+            pIter++;
+        }
+    }
+
+    return changed;
+}
@@ -0,0 +1,80 @@
+///
+/// @file FunctionPass.h
+/// @brief 以函数为单位的Pass的基类
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，函数级Pass的基类
+/// </table>
+///
+#pragma once
+
+#include "Function.h"
+#include "Module.h"
+#include "AnalysisManager.h"
+
+///
+/// @brief 以函数为单位的Pass的基类，每个函数创建一个对象执行
+///
+class FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 要处理的函数
+    /// @param _module 符号表
+    /// @param _analysis 分析管理器，用于获取控制流图、支配树等分析结果
+    ///
+    FunctionPass(Function * _func, Module * _module, AnalysisManager * _analysis);
+
+    ///
+    /// @brief 析构函数
+    ///
+    virtual ~FunctionPass() = default;
+
+    ///
+    /// @brief 执行Pass
+    /// @return true 成功 false 失败
+    ///
+    virtual bool run() = 0;
+
+    ///
+    /// @brief 获取Pass执行后仍然有效的分析，默认所有分析都失效
+    /// @return AnalysisSet 有效的分析
+    ///
+    virtual AnalysisSet getPreserved();
+
+protected:
+    ///
+    /// @brief 删除从入口不可达的基本块，出口基本块总是保留
+    /// @return true 有删除 false 没有删除
+    ///
+    bool removeUnreachableBlocks();
+
+    ///
+    /// @brief 删除没有被使用的局部变量，形参不在此列
+    /// @return true 有删除 false 没有删除
+    ///
+    bool removeUnusedVars();
+
+    ///
+    /// @brief 要处理的函数
+    ///
+    Function * func;
+
+    ///
+    /// @brief 符号表
+    ///
+    Module * module;
+
+    ///
+    /// @brief 分析管理器
+    ///
+    AnalysisManager * analysis;
+};
@@ -0,0 +1,181 @@
+///
+/// @file PassManager.cpp
+/// @brief Pass管理器，按优化级别组织Pass流水线并统计每个Pass的执行时间
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，按优化级别组织Pass流水线，支持--time-passes
+/// </table>
+///
+#include <chrono>
+#include <memory>
+
+#include "Common.h"
+#include "PassManager.h"
+#include "Mem2Reg.h"
+#include "SCCP.h"
+#include "DeadCodeElimination.h"
+#include "GlobalValueNumbering.h"
+#include "LoopInvariantCodeMotion.h"
+
+///
+/// @brief 构造函数
+/// @param _module 符号表
+///
+PassManager::PassManager(Module * _module) : module(_module)
+{}
+
+///
+/// @brief 在流水线的末尾追加Pass
+/// @param name Pass的名字
+/// @param creator 创建Pass对象的函数
+///
+void PassManager::addPass(const std::string & name, PassCreator creator)
+{
+    passes.push_back({name, std::move(creator)});
+}
+
+///
+/// @brief 根据优化级别追加机器无关的优化Pass
+/// @param optLevel 优化级别
+/// @param inSSA 输入的IR是否已经是SSA形式，是则不再需要局部变量提升
+///
+void PassManager::addOptimizationPasses(int optLevel, bool inSSA)
+{
+    if (optLevel >= 1) {
+        // 局部变量提升为SSA值，后续的优化都基于SSA形式
+        if (!inSSA) {
+            addPass<Mem2Reg>("mem2reg");
+        }
+
+        // 常量传播，并删除条件为常量时不可达的基本块
+        addPass<SCCP>("sccp");
+
+        // 删除公共子表达式
+        addPass<GlobalValueNumbering>("gvn");
+
+        // 循环不变运算外提到循环的前置基本块
+        addPass<LoopInvariantCodeMotion>("licm");
+
+        // 删除结果未被使用的指令以及无用的局部变量赋值
+        addPass<DeadCodeElimination>("dce");
+    }
+}
+
+///
+/// @brief 清除流水线中的Pass，已统计的执行时间保留
+///
+void PassManager::clearPasses()
+{
+    passes.clear();
+}
+
+///
+/// @brief 对所有的非内置函数执行流水线
+/// @return true 成功 false 失败
+///
+bool PassManager::run()
+{
+    for (auto func: module->getFunctionList()) {
+
+        if (func->isBuiltin()) {
+            continue;
+        }
+
+        for (auto & entry: passes) {
+
+            int64_t instsBefore = (int64_t) func->getInterCode().size();
+            auto start = std::chrono::steady_clock::now();
+
+            std::unique_ptr<FunctionPass> pass(entry.creator(func, module, &analysis));
+            bool result = pass->run();
+
+            auto end = std::chrono::steady_clock::now();
+
+            analysis.invalidate(func, pass->getPreserved());
+
+            if (timePasses) {
+                PassTiming & timing = getTiming(entry.name);
+                timing.seconds += std::chrono::duration<double>(end - start).count();
+                timing.instsBefore += instsBefore;
+                timing.instsAfter += (int64_t) func->getInterCode().size();
+            }
+
+            if (!result) {
+                minic_log(LOG_ERROR, "函数%s执行%s失败", func->getName().c_str(), entry.name.c_str());
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 设置是否统计Pass的执行时间
+/// @param enable 是否统计
+///
+void PassManager::setTimePasses(bool enable)
+{
+    timePasses = enable;
+}
+
+///
+/// @brief 获取Pass的统计信息，不存在时新建
+/// @param name Pass的名字
+/// @return PassTiming& 统计信息
+///
+PassManager::PassTiming & PassManager::getTiming(const std::string & name)
+{
+    for (auto & timing: timings) {
+        if (timing.name == name) {
+            return timing;
+        }
+    }
+
+    timings.emplace_back();
+    timings.back().name = name;
+
+    return timings.back();
+}
+
+///
+/// @brief 输出Pass的执行时间以及指令条数的变化，未开启统计时不输出
+/// @param fp 输出的文件
+///
+void PassManager::printTimeReport(FILE * fp)
+{
+    if (!timePasses) {
+        return;
+    }
+
+    double total = 0;
+    for (auto & timing: timings) {
+        total += timing.seconds;
+    }
+
+    fprintf(fp, "===-------------------------------------------------------------------------===\n");
+    fprintf(fp, "                      ... Pass execution timing report ...\n");
+    fprintf(fp, "===-------------------------------------------------------------------------===\n");
+    fprintf(fp, "  Total Execution Time: %.6f seconds\n\n", total);
+    fprintf(fp, "  %12s %8s %12s %12s %10s  %s\n", "Wall Time", "Percent", "Insts Before", "Insts After", "Delta", "Name");
+
+    for (auto & timing: timings) {
+        fprintf(fp,
+                "  %12.6f %7.1f%% %12lld %12lld %+10lld  %s\n",
+                timing.seconds,
+                total > 0 ? timing.seconds * 100 / total : 0.0,
+                (long long) timing.instsBefore,
+                (long long) timing.instsAfter,
+                (long long) (timing.instsAfter - timing.instsBefore),
+                timing.name.c_str());
+    }
+
+    fprintf(fp, "  %12.6f %7.1f%% %12s %12s %10s  %s\n", total, 100.0, "", "", "", "Total");
+}
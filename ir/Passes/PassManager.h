@@ -0,0 +1,159 @@
+///
+/// @file PassManager.h
+/// @brief Pass管理器，按优化级别组织Pass流水线并统计每个Pass的执行时间
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，按优化级别组织Pass流水线，支持--time-passes
+/// </table>
+///
+#pragma once
+
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Module.h"
+#include "FunctionPass.h"
+#include "AnalysisManager.h"
+
+///
+/// @brief Pass管理器
+///
+/// 对每个函数依次执行流水线中的Pass，每个Pass执行后根据其保持的分析使缓存的分析结果失效。
+/// 开启计时后，按Pass累计执行时间以及执行前后的指令条数。
+///
+class PassManager {
+
+public:
+    ///
+    /// @brief 创建Pass对象的函数
+    ///
+    using PassCreator = std::function<FunctionPass *(Function *, Module *, AnalysisManager *)>;
+
+    ///
+    /// @brief 构造函数
+    /// @param _module 符号表
+    ///
+    explicit PassManager(Module * _module);
+
+    ///
+    /// @brief 在流水线的末尾追加Pass
+    /// @param name Pass的名字
+    /// @param creator 创建Pass对象的函数
+    ///
+    void addPass(const std::string & name, PassCreator creator);
+
+    ///
+    /// @brief 在流水线的末尾追加Pass
+    /// @tparam T Pass的类型，构造函数与FunctionPass一致
+    /// @param name Pass的名字
+    ///
+    template <typename T>
+    void addPass(const std::string & name)
+    {
+        addPass(name, [](Function * func, Module * module, AnalysisManager * analysis) -> FunctionPass * {
+            return new T(func, module, analysis);
+        });
+    }
+
+    ///
+    /// @brief 根据优化级别追加机器无关的优化Pass
+    /// @param optLevel 优化级别
+    /// @param inSSA 输入的IR是否已经是SSA形式，是则不再需要局部变量提升
+    ///
+    void addOptimizationPasses(int optLevel, bool inSSA = false);
+
+    ///
+    /// @brief 清除流水线中的Pass，已统计的执行时间保留
+    ///
+    void clearPasses();
+
+    ///
+    /// @brief 对所有的非内置函数执行流水线
+    /// @return true 成功 false 失败
+    ///
+    bool run();
+
+    ///
+    /// @brief 设置是否统计Pass的执行时间
+    /// @param enable 是否统计
+    ///
+    void setTimePasses(bool enable);
+
+    ///
+    /// @brief 输出Pass的执行时间以及指令条数的变化，未开启统计时不输出
+    /// @param fp 输出的文件
+    ///
+    void printTimeReport(FILE * fp);
+
+private:
+    ///
+    /// @brief 流水线中的Pass
+    ///
+    struct PassEntry {
+
+        /// @brief Pass的名字
+        std::string name;
+
+        /// @brief 创建Pass对象的函数
+        PassCreator creator;
+    };
+
+    ///
+    /// @brief 同名Pass累计的统计信息
+    ///
+    struct PassTiming {
+
+        /// @brief Pass的名字
+        std::string name;
+
+        /// @brief 累计的执行时间，单位为秒
+        double seconds = 0;
+
+        /// @brief 执行前的指令条数之和
+        int64_t instsBefore = 0;
+
+        /// @brief 执行后的指令条数之和
+        int64_t instsAfter = 0;
+    };
+
+    ///
+    /// @brief 获取Pass的统计信息，不存在时新建
+    /// @param name Pass的名字
+    /// @return PassTiming& 统计信息
+    ///
+    PassTiming & getTiming(const std::string & name);
+
+    ///
+    /// @brief 符号表
+    ///
+    Module * module;
+
+    ///
+    /// @brief 分析管理器
+    ///
+    AnalysisManager analysis;
+
+    ///
+    /// @brief 流水线
+    ///
+    std::vector<PassEntry> passes;
+
+    ///
+    /// @brief 是否统计Pass的执行时间
+    ///
+    bool timePasses = false;
+
+    ///
+    /// @brief 按Pass首次执行次序记录的统计信息
+    ///
+    std::vector<PassTiming> timings;
+};
@@ -0,0 +1,970 @@
+///
+/// @file IRBinary.cpp
+/// @brief DragonIR的二进制格式的读写
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，二进制IR的写出与mmap加载
+/// </table>
+///
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Common.h"
+#include "IRBinary.h"
+#include "IntegerType.h"
+#include "PointerType.h"
+#include "VoidType.h"
+#include "ArgInstruction.h"
+#include "BinaryInstruction.h"
+#include "BranchInstruction.h"
+#include "EntryInstruction.h"
+#include "ExitInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+#include "MoveInstruction.h"
+#include "PhiInstruction.h"
+#include "UnaryInstruction.h"
+
+/// @brief 操作数引用中下标的掩码
+static const uint32_t operandIndexMask = (1u << IR_BINARY_OPERAND_SHIFT) - 1;
+
+///
+/// @brief 构造操作数引用
+/// @param kind 种类
+/// @param index 下标
+/// @return uint32_t 操作数引用
+///
+static uint32_t makeOperand(uint32_t kind, uint32_t index)
+{
+    return (kind << IR_BINARY_OPERAND_SHIFT) | index;
+}
+
+///
+/// @brief 指令在操作数之后的附加字数
+/// @param op 指令操作符
+/// @param operandCount 操作数个数
+/// @return uint32_t 附加字数
+///
+static uint32_t extraWords(IRInstOperator op, uint32_t operandCount)
+{
+    switch (op) {
+        case IRInstOperator::IRINST_OP_GOTO:
+        case IRInstOperator::IRINST_OP_BT:
+        case IRInstOperator::IRINST_OP_BF:
+        case IRInstOperator::IRINST_OP_FUNC_CALL:
+            return 1;
+        case IRInstOperator::IRINST_OP_BC:
+            return 2;
+        case IRInstOperator::IRINST_OP_PHI:
+            return operandCount;
+        default:
+            return 0;
+    }
+}
+
+///
+/// @brief 构造函数
+/// @param _module 要写出的模块
+///
+IRBinaryWriter::IRBinaryWriter(Module * _module) : module(_module)
+{}
+
+///
+/// @brief 字符串加入字符串表
+/// @param str 字符串
+/// @return uint32_t 字符串表中的偏移
+///
+uint32_t IRBinaryWriter::internString(const std::string & str)
+{
+    auto pIter = stringIndex.find(str);
+    if (pIter != stringIndex.end()) {
+        return pIter->second;
+    }
+
+    uint32_t offset = (uint32_t) strings.size();
+    strings.append(str);
+    strings.push_back('\0');
+    stringIndex.emplace(str, offset);
+
+    return offset;
+}
+
+///
+/// @brief 类型加入类型表
+/// @param type 类型
+/// @return uint32_t 类型表中的下标，不支持的类型为IR_BINARY_NONE
+///
+uint32_t IRBinaryWriter::internType(const Type * type)
+{
+    auto pIter = typeIndex.find(type);
+    if (pIter != typeIndex.end()) {
+        return pIter->second;
+    }
+
+    IRBinaryType record{IR_BINARY_TYPE_VOID, 0, 0, 0};
+
+    if (type->isIntegerType()) {
+        record.kind = IR_BINARY_TYPE_INTEGER;
+        record.a = (uint32_t) static_cast<const IntegerType *>(type)->getBitWidth();
+    } else if (type->isPointerType()) {
+        record.kind = IR_BINARY_TYPE_POINTER;
+        record.a = internType(static_cast<const PointerType *>(type)->getPointeeType());
+        if (record.a == IR_BINARY_NONE) {
+            return IR_BINARY_NONE;
+        }
+    } else if (!type->isVoidType()) {
+        minic_log(LOG_ERROR, "类型%s不能写出为二进制IR", type->toString().c_str());
+        return IR_BINARY_NONE;
+    }
+
+    uint32_t index = (uint32_t) types.size();
+    types.push_back(record);
+    typeIndex.emplace(type, index);
+
+    return index;
+}
+
+///
+/// @brief 编码操作数引用
+/// @param val 操作数
+/// @param ref 操作数引用
+/// @return true 成功 false 不支持的操作数
+///
+bool IRBinaryWriter::encodeOperand(Value * val, uint32_t & ref)
+{
+    if (Instanceof(constVal, ConstInt *, val)) {
+        auto constIter = constIndex.find(constVal->getVal());
+        if (constIter == constIndex.end()) {
+            constIter = constIndex.emplace(constVal->getVal(), (uint32_t) constants.size()).first;
+            constants.push_back(constVal->getVal());
+        }
+        ref = makeOperand(IR_BINARY_OPERAND_CONST, constIter->second);
+        return true;
+    }
+
+    auto globalIter = globalIndex.find(val);
+    if (globalIter != globalIndex.end()) {
+        ref = makeOperand(IR_BINARY_OPERAND_GLOBAL, globalIter->second);
+        return true;
+    }
+
+    auto localIter = localRefs.find(val);
+    if (localIter != localRefs.end()) {
+        ref = localIter->second;
+        return true;
+    }
+
+    minic_log(LOG_ERROR, "值%s不能写出为二进制IR", val->getIRName().c_str());
+    return false;
+}
+
+///
+/// @brief 编码函数体
+/// @param func 函数
+/// @param record 函数表中的记录
+/// @return true 成功 false 失败
+///
+bool IRBinaryWriter::encodeFunction(Function * func, IRBinaryFunction & record)
+{
+    InterCode & insts = func->getInterCode();
+
+    record.paramCount = (uint32_t) func->getParams().size();
+    record.localCount = (uint32_t) func->getVarValues().size();
+    record.instCount = (uint32_t) insts.size();
+    record.bodyOffset = (uint32_t) bodies.size();
+
+    // 函数内的值先全部编号，phi指令可引用后面的指令
+    localRefs.clear();
+
+    uint32_t index = 0;
+    for (auto param: func->getParams()) {
+        uint32_t type = internType(param->getType());
+        if (type == IR_BINARY_NONE) {
+            return false;
+        }
+        localRefs[param] = makeOperand(IR_BINARY_OPERAND_PARAM, index++);
+        bodies.push_back(internString(param->getIRName()));
+        bodies.push_back(type);
+    }
+
+    index = 0;
+    for (auto var: func->getVarValues()) {
+        uint32_t type = internType(var->getType());
+        if (type == IR_BINARY_NONE) {
+            return false;
+        }
+        localRefs[var] = makeOperand(IR_BINARY_OPERAND_LOCAL, index++);
+        bodies.push_back(internString(var->getName()));
+        bodies.push_back(internString(var->getIRName()));
+        bodies.push_back(type);
+        bodies.push_back((uint32_t) var->getScopeLevel());
+    }
+
+    index = 0;
+    for (auto inst: insts) {
+        localRefs[inst] = makeOperand(IR_BINARY_OPERAND_INST, index++);
+    }
+
+    // Label的引用只需要指令下标
+    auto labelRef = [this](Instruction * label) {
+        return label ? (localRefs[label] & operandIndexMask) : IR_BINARY_NONE;
+    };
+
+    for (auto inst: insts) {
+
+        IRInstOperator op = inst->getOp();
+        uint32_t operandCount = (uint32_t) inst->getOperandsNum();
+
+        uint32_t type = internType(inst->getType());
+        if (type == IR_BINARY_NONE) {
+            return false;
+        }
+
+        if ((operandCount > 0xFF) || (type > 0xFFFF)) {
+            minic_log(LOG_ERROR, "指令%s的操作数或者类型过多，不能写出为二进制IR", inst->getIRName().c_str());
+            return false;
+        }
+
+        bodies.push_back((uint32_t) op | (operandCount << 8) | (type << 16));
+        bodies.push_back(internString(inst->getIRName()));
+
+        for (uint32_t k = 0; k < operandCount; ++k) {
+            uint32_t ref;
+            if (!encodeOperand(inst->getOperand((int32_t) k), ref)) {
+                return false;
+            }
+            bodies.push_back(ref);
+        }
+
+        switch (op) {
+            case IRInstOperator::IRINST_OP_GOTO:
+                bodies.push_back(labelRef(static_cast<GotoInstruction *>(inst)->getTarget()));
+                break;
+            case IRInstOperator::IRINST_OP_BC:
+                bodies.push_back(labelRef(static_cast<BranchInstruction *>(inst)->getTrueTarget()));
+                bodies.push_back(labelRef(static_cast<BranchInstruction *>(inst)->getFalseTarget()));
+                break;
+            case IRInstOperator::IRINST_OP_BT:
+            case IRInstOperator::IRINST_OP_BF:
+                bodies.push_back(labelRef(static_cast<BranchInstruction *>(inst)->getTarget()));
+                break;
+            case IRInstOperator::IRINST_OP_PHI:
+                for (auto block: static_cast<PhiInstruction *>(inst)->getIncomingBlocks()) {
+                    bodies.push_back(labelRef(block));
+                }
+                break;
+            case IRInstOperator::IRINST_OP_FUNC_CALL:
+                bodies.push_back(functionIndex[static_cast<FuncCallInstruction *>(inst)->calledFunction]);
+                break;
+            default:
+                break;
+        }
+    }
+
+    record.bodySize = (uint32_t) bodies.size() - record.bodyOffset;
+
+    return true;
+}
+
+///
+/// @brief 写出二进制IR文件
+/// @param filePath 文件路径
+/// @return true 成功 false 失败
+///
+bool IRBinaryWriter::write(const std::string & filePath)
+{
+    // 偏移0为空串
+    internString("");
+
+    std::vector<GlobalVariable *> & globalVars = module->getGlobalVariables();
+    std::vector<Function *> & funcs = module->getFunctionList();
+
+    for (uint32_t k = 0; k < (uint32_t) globalVars.size(); ++k) {
+        globalIndex[globalVars[k]] = k;
+    }
+    for (uint32_t k = 0; k < (uint32_t) funcs.size(); ++k) {
+        functionIndex[funcs[k]] = k;
+    }
+
+    std::vector<IRBinaryGlobal> globalRecords;
+    for (auto var: globalVars) {
+        uint32_t type = internType(var->getType());
+        if (type == IR_BINARY_NONE) {
+            return false;
+        }
+        globalRecords.push_back(
+            IRBinaryGlobal{internString(var->getName()), type, (uint32_t) var->getAlignment(), 0});
+    }
+
+    std::vector<IRBinaryFunction> functionRecords;
+    for (auto func: funcs) {
+
+        IRBinaryFunction record{};
+        record.name = internString(func->getName());
+
+        // 函数类型按实际的形参建立，并按返回类型与形参类型去重
+        std::vector<uint32_t> signature{internType(func->getReturnType())};
+        for (auto param: func->getParams()) {
+            signature.push_back(internType(param->getType()));
+        }
+        std::string key;
+        for (auto type: signature) {
+            if (type == IR_BINARY_NONE) {
+                return false;
+            }
+            key += std::to_string(type) + ",";
+        }
+        auto typeIter = functionTypeIndex.find(key);
+        if (typeIter == functionTypeIndex.end()) {
+            typeIter = functionTypeIndex.emplace(key, (uint32_t) types.size()).first;
+            types.push_back(IRBinaryType{IR_BINARY_TYPE_FUNCTION,
+                                         signature[0],
+                                         (uint32_t) signature.size() - 1,
+                                         (uint32_t) typeLists.size()});
+            typeLists.insert(typeLists.end(), signature.begin() + 1, signature.end());
+        }
+        record.type = typeIter->second;
+
+        record.flags = (func->isBuiltin() ? IR_BINARY_FUNC_BUILTIN : 0) |
+                       (func->getExistFuncCall() ? IR_BINARY_FUNC_CALL : 0);
+        record.maxFuncCallArgCnt = (uint32_t) func->getMaxFuncCallArgCnt();
+
+        if (!func->isBuiltin() && !encodeFunction(func, record)) {
+            return false;
+        }
+
+        functionRecords.push_back(record);
+    }
+
+    // 按布局计算各部分的位置，函数体的位置转换为文件内的偏移
+    IRBinaryHeader header{};
+    header.magic = IR_BINARY_MAGIC;
+    header.version = IR_BINARY_VERSION;
+
+    uint32_t offset = sizeof(IRBinaryHeader);
+    header.constOffset = offset;
+    header.constCount = (uint32_t) constants.size();
+    offset += header.constCount * sizeof(int32_t);
+    header.typeOffset = offset;
+    header.typeCount = (uint32_t) types.size();
+    offset += header.typeCount * sizeof(IRBinaryType);
+    header.typeListOffset = offset;
+    header.typeListCount = (uint32_t) typeLists.size();
+    offset += header.typeListCount * sizeof(uint32_t);
+    header.globalOffset = offset;
+    header.globalCount = (uint32_t) globalRecords.size();
+    offset += header.globalCount * sizeof(IRBinaryGlobal);
+    header.functionOffset = offset;
+    header.functionCount = (uint32_t) functionRecords.size();
+    offset += header.functionCount * sizeof(IRBinaryFunction);
+
+    uint32_t bodyStart = offset;
+    for (auto & record: functionRecords) {
+        record.bodyOffset = bodyStart + record.bodyOffset * sizeof(uint32_t);
+        record.bodySize *= sizeof(uint32_t);
+    }
+    offset += (uint32_t) (bodies.size() * sizeof(uint32_t));
+
+    // 字符串表在最后，补齐到4字节
+    while (strings.size() % 4) {
+        strings.push_back('\0');
+    }
+    header.stringOffset = offset;
+    header.stringSize = (uint32_t) strings.size();
+    offset += header.stringSize;
+    header.fileSize = offset;
+
+    FILE * fp = fopen(filePath.c_str(), "wb");
+    if (nullptr == fp) {
+        minic_log(LOG_ERROR, "二进制IR文件(%s)打开失败", filePath.c_str());
+        return false;
+    }
+
+    // 空表的data()可能为空指针，不能传给fwrite，空表也不需要写入
+    auto writeTable = [fp](const auto & table) {
+        if (!table.empty()) {
+            fwrite(table.data(), sizeof(table[0]), table.size(), fp);
+        }
+    };
+
+    fwrite(&header, sizeof(header), 1, fp);
+    writeTable(constants);
+    writeTable(types);
+    writeTable(typeLists);
+    writeTable(globalRecords);
+    writeTable(functionRecords);
+    writeTable(bodies);
+    writeTable(strings);
+
+    // 缓冲区的数据在关闭时才真正写入，关闭失败同样是写入失败
+    bool result = (ferror(fp) == 0);
+    if (fclose(fp) != 0) {
+        result = false;
+    }
+
+    if (!result) {
+        minic_log(LOG_ERROR, "二进制IR文件(%s)写入失败", filePath.c_str());
+    }
+
+    return result;
+}
+
+///
+/// @brief 构造函数
+/// @param _module 加载的结果加入到该模块中
+///
+IRBinaryReader::IRBinaryReader(Module * _module) : module(_module)
+{
+    placeholder = new FormalParam(IntegerType::getTypeInt(), "");
+}
+
+///
+/// @brief 析构函数，关闭文件
+///
+IRBinaryReader::~IRBinaryReader()
+{
+#ifndef _WIN32
+    if (mapped) {
+        munmap((void *) data, size);
+    }
+#endif
+
+    delete placeholder;
+}
+
+///
+/// @brief 检查文件中的区域是否在文件内
+/// @param offset 开始位置
+/// @param count 元素个数
+/// @param elemSize 元素大小
+/// @return true 在文件内 false 越界
+///
+bool IRBinaryReader::checkRange(uint32_t offset, uint32_t count, uint32_t elemSize)
+{
+    return (offset % 4 == 0) && ((uint64_t) offset + (uint64_t) count * elemSize <= size);
+}
+
+///
+/// @brief 获取字符串
+/// @param offset 字符串表中的偏移
+/// @return const char* 字符串，越界时为nullptr
+///
+const char * IRBinaryReader::getString(uint32_t offset)
+{
+    if (offset >= header->stringSize) {
+        minic_log(LOG_ERROR, "二进制IR中的字符串越界");
+        return nullptr;
+    }
+
+    return (const char *) data + header->stringOffset + offset;
+}
+
+///
+/// @brief 获取值的类型，函数类型由Module::newFunction创建，这里不支持
+/// @param index 类型表中的下标
+/// @return Type* 类型，越界或者不支持时为nullptr
+///
+Type * IRBinaryReader::getType(uint32_t index)
+{
+    if (index >= header->typeCount) {
+        minic_log(LOG_ERROR, "二进制IR中的类型越界");
+        return nullptr;
+    }
+
+    if (types[index]) {
+        return types[index];
+    }
+
+    const IRBinaryType & record = ((const IRBinaryType *) (data + header->typeOffset))[index];
+
+    Type * type = nullptr;
+    switch (record.kind) {
+        case IR_BINARY_TYPE_VOID:
+            type = VoidType::getType();
+            break;
+        case IR_BINARY_TYPE_INTEGER:
+            if (record.a == 1) {
+                type = IntegerType::getTypeBool();
+            } else if (record.a == 32) {
+                type = IntegerType::getTypeInt();
+            }
+            break;
+        case IR_BINARY_TYPE_POINTER:
+            // 指针类型的下标总是比指向的类型大，不会无限递归
+            if (record.a < index) {
+                Type * pointee = getType(record.a);
+                if (pointee) {
+                    type = (Type *) PointerType::get(pointee);
+                }
+            }
+            break;
+        default:
+            break;
+    }
+
+    if (!type) {
+        minic_log(LOG_ERROR, "二进制IR中的类型不支持");
+        return nullptr;
+    }
+
+    types[index] = type;
+
+    return type;
+}
+
+///
+/// @brief 打开二进制IR文件，建立全局变量与函数
+/// @param filePath 文件路径
+/// @return true 成功 false 失败
+///
+bool IRBinaryReader::open(const std::string & filePath)
+{
+#ifndef _WIN32
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        minic_log(LOG_ERROR, "二进制IR文件(%s)打开失败", filePath.c_str());
+        return false;
+    }
+
+    struct stat st;
+    if ((fstat(fd, &st) == 0) && (st.st_size > 0)) {
+        void * addr = mmap(nullptr, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+            data = (const uint8_t *) addr;
+            size = (size_t) st.st_size;
+            mapped = true;
+        }
+    }
+
+    ::close(fd);
+#endif
+
+    // 不支持mmap时整个读入
+    if (!mapped) {
+        FILE * fp = fopen(filePath.c_str(), "rb");
+        if (nullptr == fp) {
+            minic_log(LOG_ERROR, "二进制IR文件(%s)打开失败", filePath.c_str());
+            return false;
+        }
+
+        uint8_t buf[65536];
+        size_t count;
+        while ((count = fread(buf, 1, sizeof(buf), fp)) > 0) {
+            buffer.insert(buffer.end(), buf, buf + count);
+        }
+        fclose(fp);
+
+        data = buffer.data();
+        size = buffer.size();
+    }
+
+    header = (const IRBinaryHeader *) data;
+    if ((size < sizeof(IRBinaryHeader)) || (header->magic != IR_BINARY_MAGIC)) {
+        minic_log(LOG_ERROR, "文件(%s)不是二进制IR文件", filePath.c_str());
+        return false;
+    }
+
+    if (header->version != IR_BINARY_VERSION) {
+        minic_log(LOG_ERROR, "二进制IR文件的版本%u不支持，当前版本为%u", header->version, IR_BINARY_VERSION);
+        return false;
+    }
+
+    if ((header->fileSize != size) || !checkRange(header->constOffset, header->constCount, sizeof(int32_t)) ||
+        !checkRange(header->typeOffset, header->typeCount, sizeof(IRBinaryType)) ||
+        !checkRange(header->typeListOffset, header->typeListCount, sizeof(uint32_t)) ||
+        !checkRange(header->globalOffset, header->globalCount, sizeof(IRBinaryGlobal)) ||
+        !checkRange(header->functionOffset, header->functionCount, sizeof(IRBinaryFunction)) ||
+        !checkRange(header->stringOffset, header->stringSize, 1) || (header->stringSize == 0) ||
+        (data[header->stringOffset + header->stringSize - 1] != '\0')) {
+        minic_log(LOG_ERROR, "二进制IR文件(%s)已损坏", filePath.c_str());
+        return false;
+    }
+
+    types.assign(header->typeCount, nullptr);
+
+    // 全局变量与函数都在全局作用域中
+    module->setCurrentFunction(nullptr);
+
+    const IRBinaryGlobal * globalRecords = (const IRBinaryGlobal *) (data + header->globalOffset);
+    for (uint32_t k = 0; k < header->globalCount; ++k) {
+        const char * name = getString(globalRecords[k].name);
+        Type * type = getType(globalRecords[k].type);
+        if (!name || !type) {
+            return false;
+        }
+
+        Value * var = module->newVarValue(type, name);
+        if (!var) {
+            return false;
+        }
+        static_cast<GlobalVariable *>(var)->setAlignment((int32_t) globalRecords[k].alignment);
+        globals.push_back(var);
+    }
+
+    const IRBinaryFunction * functionRecords = (const IRBinaryFunction *) (data + header->functionOffset);
+    const uint32_t * typeLists = (const uint32_t *) (data + header->typeListOffset);
+    for (uint32_t k = 0; k < header->functionCount; ++k) {
+
+        const IRBinaryFunction & record = functionRecords[k];
+
+        const char * name = getString(record.name);
+        if (!name) {
+            return false;
+        }
+
+        if (record.type >= header->typeCount) {
+            minic_log(LOG_ERROR, "二进制IR中的类型越界");
+            return false;
+        }
+        const IRBinaryType & funcType = ((const IRBinaryType *) (data + header->typeOffset))[record.type];
+        if ((funcType.kind != IR_BINARY_TYPE_FUNCTION) || ((uint64_t) funcType.c + funcType.b > header->typeListCount)) {
+            minic_log(LOG_ERROR, "函数%s的类型错误", name);
+            return false;
+        }
+
+        Type * returnType = getType(funcType.a);
+        if (!returnType) {
+            return false;
+        }
+
+        // 内置函数在Module中已存在
+        if (record.flags & IR_BINARY_FUNC_BUILTIN) {
+            Function * func = module->findFunction(name);
+            if (!func) {
+                std::vector<FormalParam *> params;
+                for (uint32_t i = 0; i < funcType.b; ++i) {
+                    Type * type = getType(typeLists[funcType.c + i]);
+                    if (!type) {
+                        return false;
+                    }
+                    params.push_back(new FormalParam(type, ""));
+                }
+                func = module->newFunction(name, returnType, params, true);
+            }
+            functions.push_back(func);
+            continue;
+        }
+
+        // 形参在函数体的开始，建立函数时就需要
+        if ((record.paramCount != funcType.b) || !checkRange(record.bodyOffset, record.bodySize, 1) ||
+            ((uint64_t) record.paramCount * sizeof(IRBinaryParam) > record.bodySize)) {
+            minic_log(LOG_ERROR, "函数%s的形参错误", name);
+            return false;
+        }
+
+        const IRBinaryParam * paramRecords = (const IRBinaryParam *) (data + record.bodyOffset);
+        std::vector<FormalParam *> params;
+        for (uint32_t i = 0; i < record.paramCount; ++i) {
+            const char * irName = getString(paramRecords[i].irName);
+            Type * type = getType(paramRecords[i].type);
+            if (!irName || !type) {
+                return false;
+            }
+            FormalParam * param = new FormalParam(type, "");
+            param->setIRName(irName);
+            params.push_back(param);
+        }
+
+        Function * func = module->newFunction(name, returnType, params);
+        if (!func) {
+            minic_log(LOG_ERROR, "函数%s重复定义", name);
+            return false;
+        }
+
+        func->setExistFuncCall(record.flags & IR_BINARY_FUNC_CALL);
+        func->setMaxFuncCallArgCnt((int) record.maxFuncCallArgCnt);
+
+        functions.push_back(func);
+        pending[func] = k;
+    }
+
+    return true;
+}
+
+///
+/// @brief 解码函数体，已解码或者内置函数时什么都不做
+/// @param func 函数
+/// @return true 成功 false 失败
+///
+bool IRBinaryReader::materialize(Function * func)
+{
+    auto pIter = pending.find(func);
+    if (pIter == pending.end()) {
+        return true;
+    }
+
+    const IRBinaryFunction & record = ((const IRBinaryFunction *) (data + header->functionOffset))[pIter->second];
+    pending.erase(pIter);
+
+    const uint32_t * cursor = (const uint32_t *) (data + record.bodyOffset);
+    const uint32_t * end = cursor + record.bodySize / sizeof(uint32_t);
+    const int32_t * constants = (const int32_t *) (data + header->constOffset);
+
+    // 形参在打开时已处理
+    cursor += record.paramCount * (sizeof(IRBinaryParam) / sizeof(uint32_t));
+
+    std::vector<Value *> locals;
+    if ((uint64_t) (end - cursor) < (uint64_t) record.localCount * (sizeof(IRBinaryLocal) / sizeof(uint32_t))) {
+        minic_log(LOG_ERROR, "函数%s的局部变量越界", func->getName().c_str());
+        return false;
+    }
+    for (uint32_t k = 0; k < record.localCount; ++k) {
+        const IRBinaryLocal & local = ((const IRBinaryLocal *) cursor)[k];
+        const char * name = getString(local.name);
+        const char * irName = getString(local.irName);
+        Type * type = getType(local.type);
+        if (!name || !irName || !type) {
+            return false;
+        }
+        LocalVariable * var = func->newLocalVarValue(type, name, (int32_t) local.scopeLevel);
+        var->setIRName(irName);
+        locals.push_back(var);
+    }
+    cursor += record.localCount * (sizeof(IRBinaryLocal) / sizeof(uint32_t));
+
+    // 每条指令至少2个字，先检查指令数，避免损坏的文件导致过大的内存分配
+    if ((uint64_t) record.instCount * 2 > (uint64_t) (end - cursor)) {
+        minic_log(LOG_ERROR, "函数%s的指令越界", func->getName().c_str());
+        return false;
+    }
+
+    // 第一遍确定每条指令的位置并建立Label，跳转指令可引用后面的Label
+    std::vector<const uint32_t *> instStarts;
+    std::vector<Instruction *> insts(record.instCount, nullptr);
+    for (uint32_t k = 0; k < record.instCount; ++k) {
+
+        if (end - cursor < 2) {
+            minic_log(LOG_ERROR, "函数%s的指令越界", func->getName().c_str());
+            return false;
+        }
+
+        IRInstOperator op = (IRInstOperator) (cursor[0] & 0xFF);
+        uint32_t operandCount = (cursor[0] >> 8) & 0xFF;
+        if ((op >= IRInstOperator::IRINST_OP_MAX) ||
+            ((uint64_t) (end - cursor) < 2 + (uint64_t) operandCount + extraWords(op, operandCount))) {
+            minic_log(LOG_ERROR, "函数%s的指令越界", func->getName().c_str());
+            return false;
+        }
+
+        if (op == IRInstOperator::IRINST_OP_LABEL) {
+            const char * irName = getString(cursor[1]);
+            if (!irName) {
+                return false;
+            }
+            insts[k] = new LabelInstruction(func, irName);
+        }
+
+        instStarts.push_back(cursor);
+        cursor += 2 + operandCount + extraWords(op, operandCount);
+    }
+
+    // 引用后面指令的操作数先用占位的Value，最后回填
+    std::vector<std::pair<User *, std::pair<int32_t, uint32_t>>> fixups;
+
+    auto decodeOperand = [&](uint32_t ref, bool & ok) -> Value * {
+        uint32_t index = ref & operandIndexMask;
+        switch (ref >> IR_BINARY_OPERAND_SHIFT) {
+            case IR_BINARY_OPERAND_CONST:
+                if (index < header->constCount) {
+                    return module->newConstInt(constants[index]);
+                }
+                break;
+            case IR_BINARY_OPERAND_GLOBAL:
+                if (index < globals.size()) {
+                    return globals[index];
+                }
+                break;
+            case IR_BINARY_OPERAND_PARAM:
+                if (index < func->getParams().size()) {
+                    return func->getParams()[index];
+                }
+                break;
+            case IR_BINARY_OPERAND_LOCAL:
+                if (index < locals.size()) {
+                    return locals[index];
+                }
+                break;
+            case IR_BINARY_OPERAND_INST:
+                if (index < insts.size()) {
+                    return insts[index] ? insts[index] : placeholder;
+                }
+                break;
+            default:
+                break;
+        }
+        ok = false;
+        return placeholder;
+    };
+
+    auto decodeLabel = [&](uint32_t index, bool & ok) -> Instruction * {
+        if ((index < insts.size()) && insts[index] && (insts[index]->getOp() == IRInstOperator::IRINST_OP_LABEL)) {
+            return insts[index];
+        }
+        if (index != IR_BINARY_NONE) {
+            ok = false;
+        }
+        return nullptr;
+    };
+
+    bool ok = true;
+    for (uint32_t k = 0; ok && (k < record.instCount); ++k) {
+
+        const uint32_t * words = instStarts[k];
+        IRInstOperator op = (IRInstOperator) (words[0] & 0xFF);
+        uint32_t operandCount = (words[0] >> 8) & 0xFF;
+        Type * type = getType(words[0] >> 16);
+        const char * irName = getString(words[1]);
+        if (!type || !irName) {
+            ok = false;
+            break;
+        }
+
+        const uint32_t * refs = words + 2;
+        const uint32_t * extra = refs + operandCount;
+
+        std::vector<Value *> operands;
+        for (uint32_t i = 0; i < operandCount; ++i) {
+            operands.push_back(decodeOperand(refs[i], ok));
+        }
+
+        Instruction * inst = nullptr;
+        switch (op) {
+            case IRInstOperator::IRINST_OP_ENTRY:
+                inst = new EntryInstruction(func);
+                break;
+            case IRInstOperator::IRINST_OP_EXIT:
+                if (operandCount <= 1) {
+                    inst = new ExitInstruction(func, operandCount ? operands[0] : nullptr);
+                }
+                break;
+            case IRInstOperator::IRINST_OP_LABEL:
+                inst = insts[k];
+                break;
+            case IRInstOperator::IRINST_OP_GOTO: {
+                Instruction * target = decodeLabel(extra[0], ok);
+                if (target && (operandCount == 0)) {
+                    inst = new GotoInstruction(func, target);
+                }
+                break;
+            }
+            case IRInstOperator::IRINST_OP_BC: {
+                Instruction * trueTarget = decodeLabel(extra[0], ok);
+                Instruction * falseTarget = decodeLabel(extra[1], ok);
+                if (trueTarget && falseTarget && (operandCount == 1)) {
+                    inst = new BranchInstruction(func, op, operands[0], trueTarget, falseTarget);
+                }
+                break;
+            }
+            case IRInstOperator::IRINST_OP_BT:
+            case IRInstOperator::IRINST_OP_BF: {
+                Instruction * target = decodeLabel(extra[0], ok);
+                if (target && (operandCount == 1)) {
+                    inst = new BranchInstruction(func, op, operands[0], target);
+                }
+                break;
+            }
+            case IRInstOperator::IRINST_OP_NEG_I:
+            case IRInstOperator::IRINST_OP_NOT_I:
+                if (operandCount == 1) {
+                    inst = new UnaryInstruction(func, op, operands[0], type);
+                }
+                break;
+            case IRInstOperator::IRINST_OP_ASSIGN:
+                if (operandCount == 2) {
+                    inst = new MoveInstruction(func, operands[0], operands[1]);
+                }
+                break;
+            case IRInstOperator::IRINST_OP_ARG:
+                if (operandCount == 1) {
+                    inst = new ArgInstruction(func, operands[0]);
+                }
+                break;
+            case IRInstOperator::IRINST_OP_FUNC_CALL:
+                if (extra[0] < functions.size()) {
+                    inst = new FuncCallInstruction(func, functions[extra[0]], operands, type);
+                }
+                break;
+            case IRInstOperator::IRINST_OP_PHI: {
+                PhiInstruction * phi = new PhiInstruction(func, type);
+                for (uint32_t i = 0; i < operandCount; ++i) {
+                    phi->addIncoming(operands[i], decodeLabel(extra[i], ok));
+                }
+                inst = phi;
+                break;
+            }
+            default:
+                // 其余为二元运算
+                if (operandCount == 2) {
+                    inst = new BinaryInstruction(func, op, operands[0], operands[1], type);
+                }
+                break;
+        }
+
+        if (!inst) {
+            ok = false;
+            break;
+        }
+
+        for (uint32_t i = 0; i < operandCount; ++i) {
+            if (operands[i] == placeholder) {
+                fixups.push_back({inst, {(int32_t) i, refs[i] & operandIndexMask}});
+            }
+        }
+
+        if ((op != IRInstOperator::IRINST_OP_LABEL) && irName[0]) {
+            inst->setIRName(irName);
+        }
+
+        insts[k] = inst;
+        func->getInterCode().addInst(inst);
+    }
+
+    // 回填引用后面指令的操作数，出错时也要回填，避免指令引用占位的Value
+    for (auto & fixup: fixups) {
+        uint32_t index = fixup.second.second;
+        Instruction * target = (index < insts.size()) ? insts[index] : nullptr;
+        if (target) {
+            fixup.first->setOperand(fixup.second.first, target);
+        } else {
+            fixup.first->setOperand(fixup.second.first, module->newConstInt(0));
+            ok = false;
+        }
+    }
+
+    if (!ok) {
+        minic_log(LOG_ERROR, "函数%s的指令错误", func->getName().c_str());
+        return false;
+    }
+
+    return true;
+}
+
+///
+/// @brief 解码所有的函数体
+/// @return true 成功 false 失败
+///
+bool IRBinaryReader::materializeAll()
+{
+    for (auto func: functions) {
+        if (!materialize(func)) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,313 @@
+///
+/// @file IRBinary.h
+/// @brief DragonIR的二进制格式，用于IR的缓存与分发，加载时不需要词法分析
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，二进制IR的写出与mmap加载
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Module.h"
+
+/// @brief 文件标识DIRB
+#define IR_BINARY_MAGIC 0x42524944u
+
+/// @brief 格式的版本，格式或者IRInstOperator的编号变化时必须加1
+#define IR_BINARY_VERSION 1u
+
+/// @brief 空的指令引用，如phi指令中入口基本块没有Label
+#define IR_BINARY_NONE 0xFFFFFFFFu
+
+///
+/// @brief 二进制IR的文件头
+///
+/// 所有的数据都是4字节对齐的32位整数，mmap后可直接访问。文件头之后依次为常量表、类型表、类型列表、
+/// 全局变量表、函数表、各函数的指令区与字符串表。字符串以在字符串表中的字节偏移表示，偏移0为空串；
+/// 类型以在类型表中的下标表示。每个函数的指令区依次为形参、局部变量与指令。
+///
+struct IRBinaryHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t fileSize;
+    uint32_t constOffset;
+    uint32_t constCount;
+    uint32_t typeOffset;
+    uint32_t typeCount;
+    uint32_t typeListOffset;
+    uint32_t typeListCount;
+    uint32_t globalOffset;
+    uint32_t globalCount;
+    uint32_t functionOffset;
+    uint32_t functionCount;
+    uint32_t stringOffset;
+    uint32_t stringSize;
+};
+
+/// @brief 类型的种类
+#define IR_BINARY_TYPE_VOID 0u
+#define IR_BINARY_TYPE_INTEGER 1u
+#define IR_BINARY_TYPE_POINTER 2u
+#define IR_BINARY_TYPE_FUNCTION 3u
+
+/// @brief 类型，整数类型a为位宽；指针类型a为指向的类型；函数类型a为返回类型，b为形参个数，c为类型列表的开始位置
+struct IRBinaryType {
+    uint32_t kind;
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+};
+
+/// @brief 全局变量
+struct IRBinaryGlobal {
+    uint32_t name;
+    uint32_t type;
+    uint32_t alignment;
+    uint32_t reserved;
+};
+
+/// @brief 函数标志：内置函数
+#define IR_BINARY_FUNC_BUILTIN 1u
+
+/// @brief 函数标志：存在函数调用
+#define IR_BINARY_FUNC_CALL 2u
+
+/// @brief 函数
+struct IRBinaryFunction {
+    uint32_t name;
+    uint32_t type;
+    uint32_t flags;
+    uint32_t maxFuncCallArgCnt;
+    uint32_t paramCount;
+    uint32_t localCount;
+    uint32_t instCount;
+    uint32_t bodyOffset;
+    uint32_t bodySize;
+};
+
+/// @brief 形参：IR名字、类型
+struct IRBinaryParam {
+    uint32_t irName;
+    uint32_t type;
+};
+
+/// @brief 局部变量：源程序中的名字、IR名字、类型、作用域层级
+struct IRBinaryLocal {
+    uint32_t name;
+    uint32_t irName;
+    uint32_t type;
+    uint32_t scopeLevel;
+};
+
+/// @brief 操作数引用的种类，在高3位，低29位为下标
+#define IR_BINARY_OPERAND_CONST 0u
+#define IR_BINARY_OPERAND_GLOBAL 1u
+#define IR_BINARY_OPERAND_PARAM 2u
+#define IR_BINARY_OPERAND_LOCAL 3u
+#define IR_BINARY_OPERAND_INST 4u
+
+/// @brief 操作数引用中下标的位数
+#define IR_BINARY_OPERAND_SHIFT 29
+
+// 指令的编码：第一个字低8位为IRInstOperator，次8位为操作数个数，高16位为类型；第二个字为IR名字；
+// 之后为操作数引用。跳转指令之后为目标Label的指令下标，phi指令之后为每个操作数对应的前驱Label的指令下标，
+// 函数调用指令之后为被调用函数在函数表中的下标。
+
+///
+/// @brief 把Module写出为二进制IR文件
+///
+class IRBinaryWriter {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _module 要写出的模块
+    ///
+    explicit IRBinaryWriter(Module * _module);
+
+    ///
+    /// @brief 写出二进制IR文件
+    /// @param filePath 文件路径
+    /// @return true 成功 false 失败
+    ///
+    bool write(const std::string & filePath);
+
+private:
+    ///
+    /// @brief 字符串加入字符串表
+    /// @param str 字符串
+    /// @return uint32_t 字符串表中的偏移
+    ///
+    uint32_t internString(const std::string & str);
+
+    ///
+    /// @brief 类型加入类型表
+    /// @param type 类型
+    /// @return uint32_t 类型表中的下标，不支持的类型为IR_BINARY_NONE
+    ///
+    uint32_t internType(const Type * type);
+
+    ///
+    /// @brief 编码操作数引用
+    /// @param val 操作数
+    /// @param ref 操作数引用
+    /// @return true 成功 false 不支持的操作数
+    ///
+    bool encodeOperand(Value * val, uint32_t & ref);
+
+    ///
+    /// @brief 编码函数体
+    /// @param func 函数
+    /// @param record 函数表中的记录
+    /// @return true 成功 false 失败
+    ///
+    bool encodeFunction(Function * func, IRBinaryFunction & record);
+
+    /// @brief 模块
+    Module * module;
+
+    /// @brief 字符串表
+    std::string strings;
+
+    /// @brief 字符串在字符串表中的偏移
+    std::unordered_map<std::string, uint32_t> stringIndex;
+
+    /// @brief 类型表
+    std::vector<IRBinaryType> types;
+
+    /// @brief 函数类型的形参类型列表
+    std::vector<uint32_t> typeLists;
+
+    /// @brief 非函数类型在类型表中的下标，类型都是唯一的实例
+    std::unordered_map<const Type *, uint32_t> typeIndex;
+
+    /// @brief 函数类型按返回类型与形参类型的下标去重
+    std::unordered_map<std::string, uint32_t> functionTypeIndex;
+
+    /// @brief 常量表
+    std::vector<int32_t> constants;
+
+    /// @brief 常量在常量表中的下标
+    std::unordered_map<int32_t, uint32_t> constIndex;
+
+    /// @brief 全局变量的下标
+    std::unordered_map<Value *, uint32_t> globalIndex;
+
+    /// @brief 函数的下标
+    std::unordered_map<Function *, uint32_t> functionIndex;
+
+    /// @brief 当前函数内Value的引用，含形参、局部变量与指令
+    std::unordered_map<Value *, uint32_t> localRefs;
+
+    /// @brief 所有函数的指令区
+    std::vector<uint32_t> bodies;
+};
+
+///
+/// @brief 从二进制IR文件加载Module
+///
+/// 打开时只建立全局变量与函数，函数体在materialize时才解码，文件在析构时关闭。
+///
+class IRBinaryReader {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _module 加载的结果加入到该模块中
+    ///
+    explicit IRBinaryReader(Module * _module);
+
+    ///
+    /// @brief 析构函数，关闭文件
+    ///
+    ~IRBinaryReader();
+
+    ///
+    /// @brief 打开二进制IR文件，建立全局变量与函数
+    /// @param filePath 文件路径
+    /// @return true 成功 false 失败
+    ///
+    bool open(const std::string & filePath);
+
+    ///
+    /// @brief 解码函数体，已解码或者内置函数时什么都不做
+    /// @param func 函数
+    /// @return true 成功 false 失败
+    ///
+    bool materialize(Function * func);
+
+    ///
+    /// @brief 解码所有的函数体
+    /// @return true 成功 false 失败
+    ///
+    bool materializeAll();
+
+private:
+    ///
+    /// @brief 获取字符串
+    /// @param offset 字符串表中的偏移
+    /// @return const char* 字符串，越界时为nullptr
+    ///
+    const char * getString(uint32_t offset);
+
+    ///
+    /// @brief 获取值的类型，函数类型由Module::newFunction创建，这里不支持
+    /// @param index 类型表中的下标
+    /// @return Type* 类型，越界或者不支持时为nullptr
+    ///
+    Type * getType(uint32_t index);
+
+    ///
+    /// @brief 检查文件中的区域是否在文件内
+    /// @param offset 开始位置
+    /// @param count 元素个数
+    /// @param size 元素大小
+    /// @return true 在文件内 false 越界
+    ///
+    bool checkRange(uint32_t offset, uint32_t count, uint32_t size);
+
+    /// @brief 模块
+    Module * module;
+
+    /// @brief 文件内容
+    const uint8_t * data = nullptr;
+
+    /// @brief 文件大小
+    size_t size = 0;
+
+    /// @brief 不支持mmap时读入的文件内容
+    std::vector<uint8_t> buffer;
+
+    /// @brief 是否通过mmap映射
+    bool mapped = false;
+
+    /// @brief 文件头
+    const IRBinaryHeader * header = nullptr;
+
+    /// @brief 已创建的类型
+    std::vector<Type *> types;
+
+    /// @brief 全局变量
+    std::vector<Value *> globals;
+
+    /// @brief 函数
+    std::vector<Function *> functions;
+
+    /// @brief 函数在函数表中的下标，解码后删除
+    std::unordered_map<Function *, uint32_t> pending;
+
+    /// @brief 后面才定义的指令的占位Value，解码完函数后回填
+    Value * placeholder;
+};
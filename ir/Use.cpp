@@ -12,6 +12,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-15 <td>1.1     <td>agent   <td>Use内嵌在User中，串成Value的侵入式使用链表
 /// </table>
 ///
 
@@ -19,22 +20,48 @@
 #include "User.h"
 
 ///
-/// @brief 不再使用Use原来的Value，更新为新的Value，导致删除原来的边，新加一条边
-/// @param newVal 新的Value
+/// @brief 加入到使用链表的头部
+/// @param head 链表头的地址
 ///
-void Use::setUsee(Value * newVal)
+void Use::addToList(Use ** head)
+{
+    nextUse = *head;
+    if (nextUse) {
+        nextUse->prevUse = &nextUse;
+    }
+
+    prevUse = head;
+    *head = this;
+}
+
+///
+/// @brief 从使用链表中移除，不在链表中时什么都不做
+///
+void Use::removeFromList()
 {
-    this->usee->removeUse(this);
-    this->usee = newVal;
-    this->usee->addUse(this);
+    if (!prevUse) {
+        return;
+    }
+
+    *prevUse = nextUse;
+    if (nextUse) {
+        nextUse->prevUse = prevUse;
+    }
+
+    nextUse = nullptr;
+    prevUse = nullptr;
 }
 
 ///
-/// @brief 移除def-use边，需要两头分别清理
-/// ! 请注意该函数并没有删除Use，需要自行清理资源
+/// @brief 不再使用Use原来的Value，更新为新的Value，导致删除原来的边，新加一条边
+/// @param newVal 新的Value
 ///
-void Use::remove()
+void Use::setUsee(Value * newVal)
 {
-    usee->removeUse(this);
-    user->removeOperandRaw(this);
-}
\ No newline at end of file
+    removeFromList();
+
+    usee = newVal;
+    if (usee) {
+        usee->addUse(this);
+    }
+}
@@ -12,12 +12,12 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-15 <td>1.1     <td>agent   <td>Use内嵌在User中，串成Value的侵入式使用链表
 /// </table>
 ///
 #pragma once
 
 #include <cstdint>
-#include <vector>
 
 class User;
 class Value;
@@ -29,11 +29,14 @@ class Value;
 /// Use可以跟踪每个Value的所有使用情况，并且当Value被修改或删除时，可以更新所有引用它的地方
 ///
 /// User和Use之间存在一个双向关系：
-/// User持有一个Use链表(成员uses)，每个Use指向一个Value
-/// Value持有一个User链表(成员uses)，每个User指向一个使用该Value的User对象
+/// User持有Use的数组(操作数)，每个Use指向一个Value，Use的空间由User管理，不单独分配
+/// Value持有使用链表的表头，链表通过Use中的指针串起所有使用该Value的Use，增删都是O(1)的
 ///
 class Use {
 
+    friend class Value;
+    friend class User;
+
 protected:
     ///
     /// @brief 指向要使用的value
@@ -45,17 +48,35 @@ protected:
     ///
     User * user = nullptr;
 
+    ///
+    /// @brief usee的使用链表中的下一条边
+    ///
+    Use * nextUse = nullptr;
+
+    ///
+    /// @brief 指向本边的指针的地址，即前一条边的nextUse或者usee的链表头，不在链表中时为nullptr
+    ///
+    Use ** prevUse = nullptr;
+
+    ///
+    /// @brief 加入到使用链表的头部
+    /// @param head 链表头的地址
+    ///
+    void addToList(Use ** head);
+
+    ///
+    /// @brief 从使用链表中移除，不在链表中时什么都不做
+    ///
+    void removeFromList();
+
 public:
-    /**
-     * 构建函数，构建一条define-use的边
-     * <br>
-     * The constructor DOES NOT automatically insert the Use link constructed to neither usee's [uses]
-     * field nor the user's [operands] field, which are left for the caller to manually handle.
-     * @param value The value being used.
-     * @param user  The user value.
-     */
-    Use(Value * _value, User * _user) : usee(_value), user(_user)
-    {}
+    ///
+    /// @brief 构造函数，空的边，由User设置usee与user
+    ///
+    Use() = default;
+
+    Use(const Use &) = delete;
+    Use & operator=(const Use &) = delete;
 
     ///
     /// @brief 获取值
@@ -85,13 +106,104 @@ public:
     }
 
     ///
-    /// @brief 不再使用Use原来的Value，更新为新的Value
-    /// @param newVal 新的Value
+    /// @brief 获取usee的使用链表中的下一条边
+    /// @return Use* 下一条边，没有时为nullptr
     ///
-    void setUsee(Value * newVal);
+    [[nodiscard]] Use * getNext() const
+    {
+        return nextUse;
+    }
 
     ///
-    /// @brief def-use边取消，但不会删除该Use
+    /// @brief 不再使用Use原来的Value，更新为新的Value
+    /// @param newVal 新的Value，可为nullptr
     ///
-    void remove();
-};
\ No newline at end of file
+    void setUsee(Value * newVal);
+};
+
+///
+/// @brief Value的使用链表，用于遍历使用该Value的所有边，遍历过程中不能修改当前边的usee
+///
+class UseList {
+
+public:
+    /// @brief 使用链表的迭代器
+    class iterator {
+
+    public:
+        /// @brief 构造函数
+        /// @param _use 指向的边，nullptr为尾后位置
+        explicit iterator(Use * _use) : use(_use)
+        {}
+
+        /// @brief 获取指向的边
+        Use * operator*() const
+        {
+            return use;
+        }
+
+        /// @brief 移到下一条边
+        iterator & operator++()
+        {
+            use = use->getNext();
+            return *this;
+        }
+
+        bool operator==(const iterator & other) const
+        {
+            return use == other.use;
+        }
+
+        bool operator!=(const iterator & other) const
+        {
+            return use != other.use;
+        }
+
+    private:
+        /// @brief 指向的边
+        Use * use;
+    };
+
+    /// @brief 构造函数
+    /// @param _head 链表的第一条边
+    explicit UseList(Use * _head) : head(_head)
+    {}
+
+    /// @brief 第一条边的迭代器
+    [[nodiscard]] iterator begin() const
+    {
+        return iterator(head);
+    }
+
+    /// @brief 尾后位置的迭代器
+    [[nodiscard]] iterator end() const
+    {
+        return iterator(nullptr);
+    }
+
+    /// @brief 是否没有边
+    [[nodiscard]] bool empty() const
+    {
+        return head == nullptr;
+    }
+
+    /// @brief 获取第一条边
+    [[nodiscard]] Use * front() const
+    {
+        return head;
+    }
+
+    /// @brief 获取边的条数，需要遍历链表
+    [[nodiscard]] int32_t size() const
+    {
+        int32_t count = 0;
+        for (Use * use = head; use; use = use->getNext()) {
+            count++;
+        }
+        return count;
+    }
+
+private:
+    /// @brief 链表的第一条边
+    Use * head;
+};
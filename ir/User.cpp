@@ -12,11 +12,10 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-15 <td>1.1     <td>agent   <td>操作数的Use内嵌在User中，不再逐个分配
 /// </table>
 ///
 
-#include <algorithm>
-
 #include "User.h"
 
 ///
@@ -26,6 +25,18 @@
 User::User(Type * _type) : Value(_type)
 {}
 
+///
+/// @brief 析构函数，清除操作数并释放另外分配的操作数空间
+///
+User::~User()
+{
+    clearOperands();
+
+    if (operands != inlineOperands) {
+        delete[] operands;
+    }
+}
+
 ///
 /// @brief 更新指定Pos的Value
 /// @param pos 位置
@@ -33,83 +44,97 @@ User::User(Type * _type) : Value(_type)
 ///
 void User::setOperand(int32_t pos, Value * val)
 {
-    if (pos < (int32_t) operands.size()) {
-        operands[pos]->setUsee(val);
+    if (pos < operandsNum) {
+        operands[pos].setUsee(val);
+    }
+}
+
+///
+/// @brief 预留操作数空间，操作数个数事先知道时避免多次扩容
+/// @param capacity 操作数的个数
+///
+void User::reserveOperands(int32_t capacity)
+{
+    if (capacity <= operandsCapacity) {
+        return;
+    }
+
+    Use * newOperands = new Use[capacity];
+
+    // Use搬移到新的空间，原来在使用链表中的位置由新的Use接替，链表的次序不变
+    for (int32_t k = 0; k < operandsNum; ++k) {
+
+        Use & oldUse = operands[k];
+        Use & newUse = newOperands[k];
+
+        newUse.usee = oldUse.usee;
+        newUse.user = this;
+        newUse.nextUse = oldUse.nextUse;
+        newUse.prevUse = oldUse.prevUse;
+
+        if (newUse.prevUse) {
+            *newUse.prevUse = &newUse;
+        }
+        if (newUse.nextUse) {
+            newUse.nextUse->prevUse = &newUse.nextUse;
+        }
+    }
+
+    if (operands != inlineOperands) {
+        delete[] operands;
     }
+
+    operands = newOperands;
+    operandsCapacity = capacity;
 }
 
 ///
 /// @brief 增加操作数，或者说本身的值由这些操作数来计算得到
-/// @param pos 索引位置
 /// @param val 值
 ///
 void User::addOperand(Value * val)
 {
-    // If not, add the given Value as a new use.
-    auto use = new Use(val, this);
+    if (operandsNum == operandsCapacity) {
+        reserveOperands(operandsCapacity * 2);
+    }
 
-    // 增加到操作数中
-    operands.push_back(use);
+    Use & use = operands[operandsNum++];
+    use.user = this;
 
     // 该val被使用
-    val->addUse(use);
+    use.setUsee(val);
 }
 
 ///
-/// @brief 清除指定的操作数
-/// @param val 操作数
+/// @brief 清除指定的Use
+/// @param val 操作指定的操作数
 ///
 void User::removeOperand(Value * val)
 {
-    for (auto & use: operands) {
-        if (use->getUsee() == val) {
+    for (int32_t pos = 0; pos < operandsNum; ++pos) {
+        if (operands[pos].usee == val) {
             // 找到了就删除这个Use
-            use->remove();
-            delete use;
+            removeOperand(pos);
             break;
         }
     }
 }
 
 ///
-/// @brief 清除指定的操作数
+/// @brief 清除指定的操作数，后面的操作数依次前移
 /// @param pos 操作数的索引
 ///
 void User::removeOperand(int pos)
 {
-    // 检索并清除边，使得边的两头都会自动减少
-    if (pos < (int32_t) operands.size()) {
-
-        // 必须先暂存后释放，不能直接delete uses[pos]
-        // 这是因为use->remove会删除operands的元素，使得operands[pos]的对象不再是原来的对象
-        Use * use = operands[pos];
-        use->remove();
-        delete use;
+    if ((pos < 0) || (pos >= operandsNum)) {
+        return;
     }
-}
 
-///
-/// @brief 清除指定的操作数
-/// @param pos 操作数的索引
-///
-void User::removeOperandRaw(Use * use)
-{
-    auto pIter = std::find(operands.begin(), operands.end(), use);
-    if (pIter != operands.end()) {
-        operands.erase(pIter);
+    for (int32_t k = pos; k < operandsNum - 1; ++k) {
+        operands[k].setUsee(operands[k + 1].usee);
     }
-}
 
-///
-/// @brief 清除指定的Use
-/// @param use define-use边
-///
-void User::removeUse(Use * use)
-{
-    auto pIter = std::find(operands.begin(), operands.end(), use);
-    if (pIter != operands.end()) {
-        use->remove();
-    }
+    operands[--operandsNum].setUsee(nullptr);
 }
 
 ///
@@ -117,23 +142,11 @@ void User::removeUse(Use * use)
 ///
 void User::clearOperands()
 {
-    for (int32_t pos = 0; pos < (int32_t) operands.size();) {
-
-        // 必须先暂存后释放，不能直接delete uses[pos]
-        // 这是因为use->remove会删除operands的元素，使得operands[pos]的对象不再是原来的对象
-
-        Use * use = operands[pos];
-        use->remove();
-        delete use;
+    for (int32_t pos = 0; pos < operandsNum; ++pos) {
+        operands[pos].setUsee(nullptr);
     }
-}
-///
-/// @brief Get the Operands object
-/// @return std::vector<Use *>&
-///
-std::vector<Use *> & User::getOperands()
-{
-    return operands;
+
+    operandsNum = 0;
 }
 
 ///
@@ -143,8 +156,8 @@ std::vector<Use *> & User::getOperands()
 std::vector<Value *> User::getOperandsValue()
 {
     std::vector<Value *> operandsVec;
-    for (auto & use: operands) {
-        operandsVec.emplace_back(use->getUsee());
+    for (int32_t pos = 0; pos < operandsNum; ++pos) {
+        operandsVec.emplace_back(operands[pos].usee);
     }
     return operandsVec;
 }
@@ -155,7 +168,7 @@ std::vector<Value *> User::getOperandsValue()
 ///
 int32_t User::getOperandsNum()
 {
-    return (int32_t) operands.size();
+    return operandsNum;
 }
 
 ///
@@ -165,8 +178,8 @@ int32_t User::getOperandsNum()
 ///
 Value * User::getOperand(int32_t pos)
 {
-    if (pos < (int32_t) operands.size()) {
-        return operands[pos]->getUsee();
+    if (pos < operandsNum) {
+        return operands[pos].usee;
     }
 
     return nullptr;
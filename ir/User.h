@@ -12,16 +12,19 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-15 <td>1.1     <td>agent   <td>操作数的Use内嵌在User中，不再逐个分配
 /// </table>
 ///
 #pragma once
 
-#include <unordered_map>
-#include <list>
+#include <vector>
 
 #include "Value.h"
 #include "Use.h"
 
+/// @brief 内嵌在User中的操作数个数，二元运算、赋值等固定元数的指令不需要另外分配操作数空间
+#define USER_INLINE_OPERANDS 2
+
 ///
 /// @brief 本身代表一个Value，这个Value可通过其中的操作数计算得到
 ///
@@ -29,12 +32,30 @@
 /// User可以是指令(Instruction)、常量表达式(ConstantExpr)、全局变量(GlobalVariable)等。
 /// User持有对Value的引用，并且可以有多个Value作为其操作数(Operands)
 ///
+/// 操作数的Use连续存放，个数不超过USER_INLINE_OPERANDS时使用内嵌的空间，
+/// 函数调用、phi等操作数较多的指令另外分配一块空间，扩容时整体搬移并修正使用链表。
+///
 class User : public Value {
 
     ///
-    /// @brief 操作数列表，指向当前Value的所有操作数
+    /// @brief 内嵌的操作数空间
+    ///
+    Use inlineOperands[USER_INLINE_OPERANDS];
+
+    ///
+    /// @brief 操作数列表，指向内嵌空间或者另外分配的空间
+    ///
+    Use * operands = inlineOperands;
+
+    ///
+    /// @brief 操作数的个数
+    ///
+    int32_t operandsNum = 0;
+
+    ///
+    /// @brief 操作数空间的容量
     ///
-    std::vector<Use *> operands;
+    int32_t operandsCapacity = USER_INLINE_OPERANDS;
 
 public:
     ///
@@ -45,10 +66,12 @@ public:
     User(Type * _type);
 
     ///
-    /// @brief Get the Operands object
-    /// @return std::vector<Use *>&
+    /// @brief 析构函数，清除操作数并释放另外分配的操作数空间
     ///
-    std::vector<Use *> & getOperands();
+    ~User() override;
+
+    User(const User &) = delete;
+    User & operator=(const User &) = delete;
 
     ///
     /// @brief 取得操作数
@@ -76,6 +99,12 @@ public:
     ///
     void setOperand(int32_t pos, Value * val);
 
+    ///
+    /// @brief 预留操作数空间，操作数个数事先知道时避免多次扩容
+    /// @param capacity 操作数的个数
+    ///
+    void reserveOperands(int32_t capacity);
+
     ///
     /// @brief 增加操作数，或者说本身的值由这些操作数来计算得到
     /// @param pos 索引位置
@@ -84,7 +113,7 @@ public:
     void addOperand(Value * val);
 
     ///
-    /// @brief 清除指定的操作数
+    /// @brief 清除指定的操作数，后面的操作数依次前移
     /// @param pos 操作数的索引
     ///
     void removeOperand(int pos);
@@ -95,20 +124,8 @@ public:
     ///
     void removeOperand(Value * val);
 
-    ///
-    /// @brief 直接清除操作数的元素
-    /// @param use 指定的元素use
-    ///
-    void removeOperandRaw(Use * use);
-
-    ///
-    /// @brief 清除指定的Use
-    /// @param use define-use边
-    ///
-    void removeUse(Use * use);
-
     ///
     /// @brief 清除所有的操作数
     ///
     void clearOperands();
-};
\ No newline at end of file
+};
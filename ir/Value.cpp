@@ -12,11 +12,10 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-15 <td>1.1     <td>agent   <td>define-use链改为侵入式链表
 /// </table>
 ///
 
-#include <algorithm>
-
 #include "Value.h"
 #include "Use.h"
 
@@ -30,7 +29,12 @@ Value::Value(Type * _type) : type(_type)
 /// @brief 析构函数
 Value::~Value()
 {
-    // 如有资源清理，请这里追加代码
+    // 使用者仍存在时断开边，避免使用者清除操作数时访问已释放的Value
+    while (useList) {
+        Use * use = useList;
+        use->removeFromList();
+        use->usee = nullptr;
+    }
 }
 
 /// @brief 获取名字
@@ -78,7 +82,7 @@ Type * Value::getType()
 ///
 void Value::addUse(Use * use)
 {
-    uses.push_back(use);
+    use->addToList(&useList);
 }
 
 ///
@@ -87,9 +91,42 @@ void Value::addUse(Use * use)
 ///
 void Value::removeUse(Use * use)
 {
-    auto pIter = std::find(uses.begin(), uses.end(), use);
-    if (pIter != uses.end()) {
-        uses.erase(pIter);
+    if (use->usee == this) {
+        use->removeFromList();
+    }
+}
+
+///
+/// @brief 获取define-use链，即使用该Value的所有边
+/// @return UseList 边的链表
+///
+UseList Value::getUses() const
+{
+    return UseList(useList);
+}
+
+///
+/// @brief 是否只有一条边使用该Value
+/// @return true 是 false 否
+///
+bool Value::hasOneUse() const
+{
+    return useList && !useList->getNext();
+}
+
+///
+/// @brief 所有使用该Value的地方都替换为新的Value
+/// @param newVal 新的Value
+///
+void Value::replaceAllUseWith(Value * newVal)
+{
+    if (newVal == this) {
+        return;
+    }
+
+    // setUsee会从本Value的使用链表中删除该边，每条边O(1)
+    while (useList) {
+        useList->setUsee(newVal);
     }
 }
 
@@ -111,6 +148,15 @@ int32_t Value::getRegId()
     return -1;
 }
 
+///
+/// @brief 设置分配的寄存器编号，缺省的Value不能分配寄存器，什么都不做
+/// @param regId 寄存器编号
+///
+void Value::setRegId(int32_t regId)
+{
+    (void) regId;
+}
+
 ///
 /// @brief @brief 如是内存变量型Value，则获取基址寄存器和偏移
 /// @param regId 寄存器编号
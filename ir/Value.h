@@ -12,6 +12,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-15 <td>1.1     <td>agent   <td>define-use链改为侵入式链表
 /// </table>
 ///
 #pragma once
@@ -44,16 +45,16 @@ protected:
     Type * type;
 
     ///
-    /// @brief define-use链，这个定值被使用的所有边，即所有的User
+    /// @brief define-use链的表头，这个定值被使用的所有边，即所有的User，通过Use串起来
     ///
-    std::vector<Use *> uses;
+    Use * useList = nullptr;
 
 public:
     /// @brief 构造函数
     /// @param _type
     explicit Value(Type * _type);
 
-    /// @brief 析构函数
+    /// @brief 析构函数，仍在使用该Value的边置为空
     virtual ~Value();
 
     /// @brief 获取名字
@@ -92,6 +93,24 @@ public:
     ///
     void removeUse(Use * use);
 
+    ///
+    /// @brief 获取define-use链，即使用该Value的所有边
+    /// @return UseList 边的链表
+    ///
+    [[nodiscard]] UseList getUses() const;
+
+    ///
+    /// @brief 是否只有一条边使用该Value
+    /// @return true 是 false 否
+    ///
+    [[nodiscard]] bool hasOneUse() const;
+
+    ///
+    /// @brief 所有使用该Value的地方都替换为新的Value
+    /// @param newVal 新的Value
+    ///
+    void replaceAllUseWith(Value * newVal);
+
     ///
     /// @brief 取得变量所在的作用域层级
     /// @return int32_t 层级
@@ -104,6 +123,12 @@ public:
     ///
     virtual int32_t getRegId();
 
+    ///
+    /// @brief 设置分配的寄存器编号，只有可分配寄存器的Value才需要重写
+    /// @param regId 寄存器编号，-1表示不分配寄存器
+    ///
+    virtual void setRegId(int32_t regId);
+
     ///
     /// @brief @brief 如是内存变量型Value，则获取基址寄存器和偏移
     /// @param regId 寄存器编号
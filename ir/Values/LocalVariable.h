@@ -58,6 +58,15 @@ public:
         return regId;
     }
 
+    ///
+    /// @brief 设置寄存器编号，寄存器分配后局部变量可以寄存器寻址
+    /// @param _regId 寄存器编号
+    ///
+    void setRegId(int32_t _regId) override
+    {
+        this->regId = _regId;
+    }
+
     ///
     /// @brief @brief 如是内存变量型Value，则获取基址寄存器和偏移
     /// @param regId 寄存器编号
@@ -22,12 +22,18 @@
 #include "Antlr4Executor.h"
 #include "CodeGenerator.h"
 #include "CodeGeneratorArm32.h"
+#include "CodeGeneratorElfArm32.h"
 #include "FlexBisonExecutor.h"
 #include "FrontEndExecutor.h"
 #include "Graph.h"
 #include "IRGenerator.h"
+#include "Interpreter.h"
+#include "IRBinary.h"
+#include "IRParser.h"
 #include "RecursiveDescentExecutor.h"
 #include "Module.h"
+#include "OutOfSSA.h"
+#include "PassManager.h"
 
 ///
 /// @brief 是否显示帮助信息
@@ -74,9 +80,18 @@ static bool gFrontEndRecursiveDescentParsing = false;
 ///
 static bool gAsmAlsoShowIR = false;
 
+/// @brief 是否直接输出ELF目标文件，而不是汇编
+static bool gOutputObject = false;
+
+/// @brief 是否解释执行IR，不产生输出文件
+static bool gRunIR = false;
+
 /// @brief 优化的级别，即-O后面的数字，默认为0
 static int gOptLevel = 0;
 
+/// @brief 是否输出每个Pass的执行时间以及指令条数的变化
+static bool gTimePasses = false;
+
 /// @brief 指定CPU目标架构，这里默认为ARM32
 static std::string gCPUTarget = "ARM32";
 
@@ -97,6 +112,9 @@ static struct option long_options[] = {
     {"optimize", required_argument, 0, 'O'},
     {"target", required_argument, 0, 't'},
     {"asmir", no_argument, 0, 'c'},
+    {"time-passes", no_argument, 0, 'P'},
+    {"object", no_argument, 0, 'B'},
+    {"run", no_argument, 0, 'R'},
     {0, 0, 0, 0}
 };
 
@@ -116,6 +134,9 @@ static void showHelp(const std::string & exeName)
     std::cout << "  -O, --optimize=LEVEL       Set optimization level\n";
     std::cout << "  -t, --target=CPU           Specify target CPU architecture\n";
     std::cout << "  -c, --asmir                Show IR instructions as comments in assembly output\n";
+    std::cout << "      --time-passes          Report time and instruction count changes of each pass\n";
+    std::cout << "      --object               Output an ELF relocatable object file instead of assembly\n";
+    std::cout << "      --run                  Interpret the optimized IR and exit with the return value of main\n";
 }
 
 /// @brief 参数解析与有效性检查
@@ -172,7 +193,7 @@ lb_check:
                 gFrontEndRecursiveDescentParsing = true;
                 break;
             case 'O':
-                // 优化级别分析，暂时没有用，如开启优化时请使用
+                // 优化级别分析，-O2时后端采用图着色寄存器分配
                 gOptLevel = std::stoi(optarg);
                 break;
             case 't':
@@ -181,6 +202,18 @@ lb_check:
             case 'c':
                 gAsmAlsoShowIR = true;
                 break;
+            case 'P':
+                // 只有长选项--time-passes，短选项列表中没有P
+                gTimePasses = true;
+                break;
+            case 'B':
+                // 只有长选项--object，直接输出目标文件，不需要外部汇编器
+                gOutputObject = true;
+                break;
+            case 'R':
+                // 只有长选项--run，解释执行IR，不需要外部的IR运行工具
+                gRunIR = true;
+                break;
             default:
                 return -1;
                 break; /* no break */
@@ -218,13 +251,13 @@ lb_check:
         return -1;
     }
 
-    int flag = (int) gShowLineIR + (int) gShowAST;
+    int flag = (int) gShowLineIR + (int) gShowAST + (int) gRunIR;
 
     if (0 == flag) {
         // 没有指定，则输出汇编指令
         gShowASM = true;
     } else if (flag != 1) {
-        // 线性中间IR、抽象语法树只能同时选择一个
+        // 线性中间IR、抽象语法树、解释执行只能同时选择一个
         return -1;
     }
 
@@ -236,6 +269,8 @@ lb_check:
             gOutputFile = "output.png";
         } else if (gShowLineIR) {
             gOutputFile = "output.ir";
+        } else if (gOutputObject) {
+            gOutputFile = "output.o";
         } else {
             gOutputFile = "output.s";
         }
@@ -244,6 +279,38 @@ lb_check:
     return 0;
 }
 
+/// @brief 输入文件是否为DragonIR文本，按扩展名.ir判断
+/// @param inputFile 输入文件
+/// @return true 是 false 否
+static bool isIRFile(const std::string & inputFile)
+{
+    return (inputFile.size() > 3) && (inputFile.compare(inputFile.size() - 3, 3, ".ir") == 0);
+}
+
+/// @brief 文件是否为二进制DragonIR，按扩展名.irb判断
+/// @param file 文件
+/// @return true 是 false 否
+static bool isBinaryIRFile(const std::string & file)
+{
+    return (file.size() > 4) && (file.compare(file.size() - 4, 4, ".irb") == 0);
+}
+
+/// @brief 模块中的函数是否已经是SSA形式，-I输出的优化后的IR重新作为输入时含有phi指令
+/// @param module 符号表
+/// @return true 是 false 否
+static bool isSSAModule(Module * module)
+{
+    for (auto func: module->getFunctionList()) {
+        for (auto inst: func->getInterCode()) {
+            if (inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 ///
 /// @brief 对源文件进行编译处理生成汇编
 /// @return true 成功
@@ -259,6 +326,9 @@ static int compile(std::string inputFile, std::string outputFile)
 
     Module * module = nullptr;
 
+    // 输入的IR是否已经是SSA形式
+    bool inSSA = false;
+
     // 这里采用do {} while(0)架构的目的是如果处理出错可通过break退出循环，出口唯一
     // 在编译器编译优化时会自动去除，因为while恒假的缘故
     do {
@@ -269,77 +339,153 @@ static int compile(std::string inputFile, std::string outputFile)
         // 3) 对线性IR进行优化：目前不支持
         // 4) 把线性IR转换成汇编
 
-        // 创建词法语法分析器
-        FrontEndExecutor * frontEndExecutor;
-        if (gFrontEndAntlr4) {
-            // Antlr4
-            frontEndExecutor = new Antlr4Executor(inputFile);
-        } else if (gFrontEndRecursiveDescentParsing) {
-            // 递归下降分析法
-            frontEndExecutor = new RecursiveDescentExecutor(inputFile);
+        if (isBinaryIRFile(inputFile)) {
+
+            // 输入为二进制DragonIR，通过mmap加载
+            if (gShowAST) {
+                minic_log(LOG_ERROR, "IR文件不能输出抽象语法树");
+                break;
+            }
+
+            module = new Module(inputFile);
+
+            IRBinaryReader irReader(module);
+            if (!irReader.open(inputFile) || !irReader.materializeAll()) {
+                minic_log(LOG_ERROR, "二进制IR加载错误");
+                break;
+            }
+
+            inSSA = isSSAModule(module);
+        } else if (isIRFile(inputFile)) {
+
+            // 输入为DragonIR文本，不需要前端，直接加载到符号表中，可重复运行优化与后端
+            if (gShowAST) {
+                minic_log(LOG_ERROR, "IR文件不能输出抽象语法树");
+                break;
+            }
+
+            module = new Module(inputFile);
+
+            IRParser irParser(module);
+            if (!irParser.run(inputFile)) {
+                minic_log(LOG_ERROR, "IR解析错误");
+                break;
+            }
+
+            inSSA = isSSAModule(module);
         } else {
-            // 默认为Flex+Bison
-            frontEndExecutor = new FlexBisonExecutor(inputFile);
-        }
 
-        // 前端执行：词法分析、语法分析后产生抽象语法树，其root为全局变量ast_root
-        subResult = frontEndExecutor->run();
-        if (!subResult) {
+            // 创建词法语法分析器
+            FrontEndExecutor * frontEndExecutor;
+            if (gFrontEndAntlr4) {
+                // Antlr4
+                frontEndExecutor = new Antlr4Executor(inputFile);
+            } else if (gFrontEndRecursiveDescentParsing) {
+                // 递归下降分析法
+                frontEndExecutor = new RecursiveDescentExecutor(inputFile);
+            } else {
+                // 默认为Flex+Bison
+                frontEndExecutor = new FlexBisonExecutor(inputFile);
+            }
 
-            minic_log(LOG_ERROR, "前端分析错误");
-            // 退出循环
-            break;
-        }
+            // 前端执行：词法分析、语法分析后产生抽象语法树，其root为全局变量ast_root
+            subResult = frontEndExecutor->run();
+            if (!subResult) {
 
-        // 获取抽象语法树的根节点
-        ast_node * astRoot = frontEndExecutor->getASTRoot();
+                minic_log(LOG_ERROR, "前端分析错误");
+                // 退出循环
+                break;
+            }
 
-        // 清理前端资源
-        delete frontEndExecutor;
+            // 获取抽象语法树的根节点
+            ast_node * astRoot = frontEndExecutor->getASTRoot();
 
-        // 这里可进行非线性AST的优化
+            // 清理前端资源
+            delete frontEndExecutor;
 
-        if (gShowAST) {
+            // 这里可进行非线性AST的优化
+
+            if (gShowAST) {
+
+                // 遍历抽象语法树，生成抽象语法树图片
+                OutputAST(astRoot, outputFile);
+
+                // 清理抽象语法树
+                free_ast(astRoot);
+
+                // 设置返回结果：正常
+                result = 0;
+
+                break;
+            }
+
+            // 输出线性中间IR、计算器模拟解释执行、输出汇编指令
+            // 都需要遍历AST转换成线性IR指令
+
+            // 符号表，保存所有的变量以及函数等信息
+            module = new Module(inputFile);
+
+            // 遍历抽象语法树产生线性IR，相关信息保存到符号表中
+            IRGenerator ast2IR(astRoot, module);
+            subResult = ast2IR.run();
+            if (!subResult) {
+
+                // 输出错误信息
+                minic_log(LOG_ERROR, "中间IR生成错误");
 
-            // 遍历抽象语法树，生成抽象语法树图片
-            OutputAST(astRoot, outputFile);
+                break;
+            }
 
             // 清理抽象语法树
             free_ast(astRoot);
+        }
 
-            // 设置返回结果：正常
-            result = 0;
-
+        // 中间代码优化，体系结果无关的优化等，按优化级别组织Pass流水线
+        // 已经是SSA形式的IR输入不再构造SSA
+        PassManager passManager(module);
+        passManager.setTimePasses(gTimePasses);
+        passManager.addOptimizationPasses(gOptLevel, inSSA);
+        if (!passManager.run()) {
+            minic_log(LOG_ERROR, "中间代码优化错误");
             break;
         }
 
-        // 输出线性中间IR、计算器模拟解释执行、输出汇编指令
-        // 都需要遍历AST转换成线性IR指令
+        if (gRunIR) {
 
-        // 符号表，保存所有的变量以及函数等信息
-        Module * module = new Module(inputFile);
+            // 解释执行优化后的IR，main函数的返回值作为程序的返回值
+            Interpreter interpreter(module);
+            int32_t exitCode = 0;
+            if (!interpreter.run(exitCode)) {
+                break;
+            }
 
-        // 遍历抽象语法树产生线性IR，相关信息保存到符号表中
-        IRGenerator ast2IR(astRoot, module);
-        subResult = ast2IR.run();
-        if (!subResult) {
+            passManager.printTimeReport(stderr);
+            if (gTimePasses) {
+                fprintf(stderr, "Executed IR instructions: %llu\n", (unsigned long long) interpreter.getExecutedCount());
+            }
 
-            // 输出错误信息
-            minic_log(LOG_ERROR, "中间IR生成错误");
+            result = exitCode;
 
             break;
         }
 
-        // 清理抽象语法树
-        free_ast(astRoot);
-
         if (gShowLineIR) {
 
             // 对IR的名字重命名
             module->renameIR();
 
-            // 输出IR
-            module->outputIR(outputFile);
+            // 输出IR，扩展名为.irb时输出二进制IR
+            if (isBinaryIRFile(outputFile)) {
+                IRBinaryWriter irWriter(module);
+                if (!irWriter.write(outputFile)) {
+                    minic_log(LOG_ERROR, "二进制IR输出错误");
+                    break;
+                }
+            } else {
+                module->outputIR(outputFile);
+            }
+
+            passManager.printTimeReport(stderr);
 
             // 设置返回结果：正常
             result = 0;
@@ -347,14 +493,20 @@ static int compile(std::string inputFile, std::string outputFile)
             break;
         }
 
+        // 后端不能处理phi指令，转换成普通的赋值指令
+        passManager.clearPasses();
+        passManager.addPass<OutOfSSA>("out-of-ssa");
+        if (!passManager.run()) {
+            minic_log(LOG_ERROR, "中间代码优化错误");
+            break;
+        }
+
         // 要使得汇编能输出IR指令作为注释，必须对IR的名字进行命名，否则为空值
         if (gAsmAlsoShowIR) {
             // 对IR的名字重命名
             module->renameIR();
         }
 
-        // 这里可追加中间代码优化，体系结果无关的优化等
-
         // 后端处理，体系结果相关的操作
         // 这里提供一种面向ARM32的汇编产生器CodeGeneratorArm32作为参考
         // 需要时可根据需要修改或追加新的目标体系架构
@@ -363,9 +515,14 @@ static int compile(std::string inputFile, std::string outputFile)
             CodeGenerator * generator = nullptr;
 
             if (gCPUTarget == "ARM32") {
-                // 输出面向ARM32的汇编指令
-                generator = new CodeGeneratorArm32(module);
+                // 输出面向ARM32的汇编指令或者目标文件
+                if (gOutputObject) {
+                    generator = new CodeGeneratorElfArm32(module);
+                } else {
+                    generator = new CodeGeneratorArm32(module);
+                }
                 generator->setShowLinearIR(gAsmAlsoShowIR);
+                generator->setOptLevel(gOptLevel);
                 generator->run(outputFile);
             } else {
                 // 不支持指定的CPU架构
@@ -376,6 +533,8 @@ static int compile(std::string inputFile, std::string outputFile)
             delete generator;
         }
 
+        passManager.printTimeReport(stderr);
+
         // 清理符号表
         module->Delete();
 
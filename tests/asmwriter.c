@@ -0,0 +1,31 @@
+int g1, g2, g3;
+
+int f1()
+{
+    g1 = g1 + 1;
+    return g1;
+}
+
+int f2()
+{
+    g2 = g2 + f1() * 2;
+    return g2;
+}
+
+int f3()
+{
+    g3 = f2() + f1();
+    return g3 - 100000;
+}
+
+int main()
+{
+    int s;
+
+    s = f1() + f2() + f3();
+    putint(g1);
+    putint(g2);
+    putint(g3);
+
+    return s;
+}
@@ -0,0 +1,24 @@
+int counter;
+int limit;
+
+int tick()
+{
+    counter = counter + 1;
+    return counter;
+}
+
+int main()
+{
+    int s;
+
+    limit = getint();
+    s = -2147483647;
+    while (tick() < limit) {
+        s = s + 123456789;
+    }
+
+    putint(s);
+    putint(counter);
+
+    return counter;
+}
@@ -0,0 +1,32 @@
+int main()
+{
+    int a, b, c, i, s;
+
+    a = getint();
+    b = getint();
+    c = a < b;
+    s = c + (a == b) * 2 + (a != b) * 4 + (a >= b) * 8;
+
+    if (a < b && b < 100) {
+        s = s + 16;
+    }
+    if (a > 50 || b <= 3) {
+        s = s + 32;
+    }
+    if (!(a == 7)) {
+        s = s + 64;
+    }
+    if (!c) {
+        s = s + 128;
+    }
+
+    i = 0;
+    while (i < a && i <= b) {
+        i = i + 1;
+    }
+    s = s + i * 256;
+
+    putint(s);
+
+    return c;
+}
@@ -0,0 +1,34 @@
+int main()
+{
+    int i, j, s, t;
+
+    s = 0;
+    t = 0;
+    i = 0;
+    while (i < 10) {
+        i = i + 1;
+        if (i % 3 == 0) {
+            continue;
+        }
+        j = 0;
+        while (1) {
+            j = j + 1;
+            if (j > i) {
+                break;
+            }
+            if (j % 2) {
+                continue;
+            }
+            s = s + j;
+        }
+        if (s > 40) {
+            break;
+        }
+        t = t + i;
+    }
+
+    putint(s);
+    putint(t);
+
+    return i;
+}
@@ -0,0 +1,34 @@
+int n;
+
+int next()
+{
+    n = n * 5 + 3;
+    return n % 17;
+}
+
+int main()
+{
+    int a, b, c, d, e, f, g, h, i, j, s, t;
+
+    n = getint();
+    a = next();
+    b = next();
+    c = next();
+    d = next();
+    e = next();
+    f = next();
+    g = next();
+    h = next();
+    i = a * b + c;
+    j = d * e - f;
+    s = next() + a + b + c + d + e + f + g + h;
+    t = next();
+    s = s + t * i - j;
+
+    putint(s);
+    putint(a - b + c - d + e - f + g - h);
+    t = next();
+    putint(t + next() * 2);
+
+    return s + i + j;
+}
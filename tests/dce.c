@@ -0,0 +1,21 @@
+int g;
+
+int main()
+{
+    int a, b, c, d, i;
+
+    a = getint();
+    b = a * 7;
+    c = b + a;
+    d = c * c;
+    g = a + 1;
+    i = d + c;
+    d = d + i;
+    c = i * 2;
+
+    b = a - 1;
+    putint(b);
+    d = getint();
+
+    return b + g;
+}
@@ -0,0 +1,28 @@
+int main()
+{
+    int a, b, s;
+
+    a = getint();
+    b = getint();
+    s = ((((((((a + 1) * 2 - b) * 3 + a) - (b - (a - (b - 1)))) * 2 + 1) - a) + b) * 2) % 1000;
+    s = s + (a + (b + (a + (b + (a + (b + (a + (b + 1))))))));
+    {
+        int c;
+        c = s;
+        {
+            int d;
+            d = c + 1;
+            {
+                int e;
+                e = d * 2;
+                {
+                    s = e - a;
+                }
+            }
+        }
+    }
+
+    putint(s);
+
+    return s;
+}
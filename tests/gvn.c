@@ -0,0 +1,25 @@
+int g;
+
+int main()
+{
+    int a, b, c, d, e, f, s;
+
+    a = getint();
+    b = getint();
+    c = a * b + 1;
+    d = a * b + 1;
+    s = c + d;
+
+    e = a * b;
+    f = a - b;
+    s = s + (a - b) * e + f;
+
+    g = a + b;
+    s = s + (a + b) * 2;
+    g = g + 1;
+    s = s + (a + b) + g;
+
+    putint(s);
+
+    return s % 256;
+}
@@ -0,0 +1,40 @@
+int main()
+{
+    int a, b, max, min, abs, i, s;
+
+    a = getint();
+    b = getint();
+
+    if (a > b) {
+        max = a;
+    } else {
+        max = b;
+    }
+    if (a < b) {
+        min = a;
+    } else {
+        min = b;
+    }
+    abs = a - b;
+    if (abs < 0) {
+        abs = -abs;
+    }
+
+    s = 0;
+    i = 0;
+    while (i < 10) {
+        if (i % 3 == 0) {
+            s = s + i;
+        } else {
+            s = s - 1;
+        }
+        i = i + 1;
+    }
+
+    putint(max);
+    putint(min);
+    putint(abs);
+    putint(s);
+
+    return max - min;
+}
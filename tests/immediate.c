@@ -0,0 +1,19 @@
+int main()
+{
+    int a, s;
+
+    a = getint();
+    s = a + 255;
+    s = s + 256;
+    s = s - 257;
+    s = s + 1020;
+    s = s - 4096;
+    s = s + 65535;
+    s = s - 74565;
+    s = s + -1;
+    putint(s);
+    putint(a * 4095 - 65537);
+    putint(-300000 - a);
+
+    return s - a * 255 + 2147483647;
+}
@@ -0,0 +1,27 @@
+int n;
+int depth;
+
+int fact()
+{
+    int k;
+
+    if (n <= 1) {
+        return 1;
+    }
+    k = n;
+    n = n - 1;
+    depth = depth + 1;
+    return k * fact();
+}
+
+int main()
+{
+    int r;
+
+    n = getint();
+    r = fact();
+    putint(r);
+    putint(depth);
+
+    return r % 100;
+}
@@ -0,0 +1,33 @@
+int main()
+{
+    int i, j, k, s;
+
+    s = 0;
+    i = 0;
+    while (i < 6) {
+        j = 0;
+        while (j < 6) {
+            k = 0;
+            while (k < 6) {
+                if (k > j || (i == 3 && k == 1)) {
+                    break;
+                }
+                if (!(k % 2) && j != 2) {
+                    k = k + 1;
+                    continue;
+                }
+                s = s + i * 100 + j * 10 + k;
+                k = k + 1;
+            }
+            if (j == i) {
+                break;
+            }
+            j = j + 1;
+        }
+        i = i + 1;
+    }
+
+    putint(s);
+
+    return s % 256;
+}
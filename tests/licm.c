@@ -0,0 +1,38 @@
+int main()
+{
+    int a, b, i, j, s, z;
+
+    a = getint();
+    b = getint();
+    z = getint();
+    s = 0;
+
+    i = 0;
+    while (i < 4) {
+        j = 0;
+        while (j < 3) {
+            s = s + a * b + i * 2;
+            j = j + 1;
+        }
+        i = i + 1;
+    }
+
+    i = 0;
+    while (i < z) {
+        s = s + a / z;
+        i = i + 1;
+    }
+
+    i = 0;
+    while (i < 5) {
+        if (i > 2) {
+            s = s + b % a;
+        }
+        a = a + 1;
+        i = i + 1;
+    }
+
+    putint(s);
+
+    return s;
+}
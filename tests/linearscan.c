@@ -0,0 +1,25 @@
+int g;
+
+int main()
+{
+    int a, b, c, d, e, f, h, i, j, k;
+
+    a = getint();
+    b = getint();
+    c = a + b;
+    d = a - b;
+    e = a * b;
+    f = c * d;
+    h = e - f;
+    i = a * 3 + b;
+    j = c + d + e;
+    k = h - i + j;
+
+    g = a + c + e + h + j;
+    putint(g);
+    g = b + d + f + i + k;
+    putint(g);
+    putint(k);
+
+    return a + b + c + d + e + f + h + i + j + k;
+}
@@ -0,0 +1,28 @@
+int main()
+{
+    int a, b, i, j, s, t, u;
+
+    a = getint();
+    b = getint();
+    s = 0;
+    t = 0;
+    i = 0;
+    while (i < 10) {
+        u = a * b;
+        j = 0;
+        while (j < i) {
+            t = a * b + j;
+            s = s + u - t;
+            j = j + 1;
+        }
+        if (i > 100) {
+            s = s + a * b;
+        }
+        i = i + 1;
+    }
+
+    putint(s);
+    putint(t);
+
+    return s;
+}
@@ -0,0 +1,25 @@
+int g1, g2;
+
+int main()
+{
+    int a, b, c;
+
+    a = getint();
+    b = a * 9;
+    c = a * 15 - b / 8;
+    g1 = a % 16;
+    g2 = -a;
+
+    if (b > c) {
+        c = c + 1;
+    } else {
+        c = c - 1;
+    }
+
+    putint(b);
+    putint(c);
+    putint(g1);
+    putint(g2);
+
+    return c + 1000000;
+}
@@ -0,0 +1,31 @@
+int total;
+int calls;
+
+int add()
+{
+    calls = calls + 1;
+    total = total + calls * 1000003;
+    return total;
+}
+
+int main()
+{
+    int i, s;
+
+    i = getint();
+    s = 0;
+    while (i > 0) {
+        if (i % 2) {
+            s = s + add();
+        } else {
+            s = s - 305419896;
+        }
+        i = i - 1;
+    }
+
+    putint(total);
+    putint(calls);
+    putint(s);
+
+    return calls;
+}
@@ -0,0 +1,22 @@
+int g;
+
+int bump()
+{
+    g = g * 2 + 1;
+    return g;
+}
+
+int main()
+{
+    int a;
+
+    g = 0;
+    a = getint() - getint() * 2;
+    putint(a);
+    a = bump() - bump() * 10 + bump();
+    putint(a);
+    putint(bump() - g);
+    putint(g);
+
+    return a;
+}
@@ -0,0 +1,27 @@
+int count;
+
+int step()
+{
+    int unused;
+
+    count = count + 1;
+    unused = count * 4;
+    return count - 5;
+}
+
+int main()
+{
+    int s, r, k;
+
+    count = getint();
+    k = 2 * 3;
+    s = k;
+    r = step();
+    s = s + r * k;
+    r = step();
+    s = s - r;
+    r = step();
+    s = s * r + k;
+
+    return s;
+}
@@ -0,0 +1,27 @@
+int g;
+
+int main()
+{
+    int a, b, c, i;
+
+    a = getint();
+    b = a;
+    c = b;
+    g = c + 0;
+    c = g;
+    i = 0;
+    while (i < 3) {
+        if (c > 0) {
+            c = c - 1;
+        }
+        i = i + 1;
+    }
+    b = b * 1;
+    b = b + 0;
+    b = b - 0;
+
+    putint(c);
+    putint(g);
+
+    return b;
+}
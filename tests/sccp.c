@@ -0,0 +1,19 @@
+int main()
+{
+    int a, b, c, s, x;
+
+    a = 3;
+    b = a * 4 - 2;
+    c = b / a + b % a;
+    x = getint();
+    s = c * 10 - 36;
+    s = s + c;
+    s = s + c * (a - 2);
+
+    putint(s);
+    putint(-a * b);
+    putint(x / 1 + x * 0);
+    putint(x - x + c);
+
+    return s + c;
+}
@@ -0,0 +1,30 @@
+int main()
+{
+    int a, b, t, i, n, x, y;
+
+    n = getint();
+    a = 1;
+    b = 2;
+    x = 0;
+    y = 0;
+    i = 0;
+    while (i < n) {
+        t = a;
+        a = b;
+        b = t;
+        if (i % 2) {
+            x = x + a;
+        } else {
+            y = y + b;
+            x = x - 1;
+        }
+        i = i + 1;
+    }
+
+    putint(a);
+    putint(b);
+    putint(x);
+    putint(y);
+
+    return a * 10 + b;
+}
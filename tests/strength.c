@@ -0,0 +1,23 @@
+int main()
+{
+    int a, b;
+
+    a = getint();
+    b = getint();
+
+    putint(a * 8);
+    putint(a * 10);
+    putint(a * -7);
+    putint(a / 4);
+    putint(b / 4);
+    putint(a / 7);
+    putint(b / -7);
+    putint(b / 3);
+    putint(a % 8);
+    putint(b % 8);
+    putint(b % 10);
+    putint(b % -3);
+    putint(a / 1 + b % 1 + a * 1);
+
+    return a * 33 - b / 5;
+}
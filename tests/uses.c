@@ -0,0 +1,18 @@
+int main()
+{
+    int a, b, c, d, s;
+
+    a = getint();
+    b = a + a;
+    c = b * b + b - b / 2 + (b % 3) * b;
+    d = 5;
+    s = c + d * b + d * c + d;
+    if (d > 4) {
+        s = s + d * d + b;
+    }
+    s = s + (a + a) * (a + a);
+
+    putint(s);
+
+    return s % 256;
+}
@@ -0,0 +1,113 @@
+#!/bin/bash
+
+# tests目录下带有期望输出的用例的回归测试
+# 期望输出文件与用例同名，扩展名为.out，内容为程序的标准输出，换行后是main函数的返回值，与arm32-build-run.sh的输出格式相同。
+# 同名的.in文件存在时作为程序的标准输入。
+# 用例可以是MiniC源程序，也可以是DragonIR文件，在各优化级别下生成ARM32汇编，交叉编译后通过qemu运行，检查输出与返回值。
+#
+# 用法：tools/arm32-test.sh [用例名 ...]，不指定时运行所有带有期望输出的用例
+
+rundir="."
+minic="${rundir}/build/minic"
+
+# 生成的汇编、程序等都放在临时目录中，结束后删除
+workdir=$(mktemp -d)
+trap 'rm -rf "${workdir}"' EXIT
+
+passed=0
+failed=0
+
+# 比较运行结果与期望输出
+# $1 检查项的名称 $2 运行结果 $3 期望输出
+check() {
+	if cmp -s "$2" "$3"; then
+		passed=$((passed + 1))
+	else
+		failed=$((failed + 1))
+		echo "FAIL: $1"
+		diff "$3" "$2" | head -n 10
+	fi
+}
+
+# 交叉编译汇编或目标文件，通过qemu运行，输出与返回值写入结果文件
+# $1 汇编或目标文件 $2 标准输入 $3 运行结果
+run_arm32() {
+	if ! arm-linux-gnueabihf-gcc -static --include "${rundir}/tests/std.h" -o "$1.elf" "$1" "${rundir}/tests/std.c"; then
+		echo "link failed" > "$3"
+		return
+	fi
+
+	qemu-arm-static "$1.elf" < "$2" > "$3"
+	printf "\n%d\n" $? >> "$3"
+}
+
+# 通过minic生成汇编或目标文件，运行后检查结果
+# $1 检查项的名称 $2 输出文件，扩展名为.s或.o，其余参数为minic的选项以及输入文件
+test_arm32() {
+	local name=$1
+	local output=$2
+	shift 2
+
+	if "${minic}" -S "$@" -o "${output}"; then
+		run_arm32 "${output}" "${input}" "${output}.result"
+	else
+		echo "compile failed" > "${output}.result"
+	fi
+
+	check "${name}" "${output}.result" "${expected}"
+}
+
+if [ $# -gt 0 ]; then
+	cases="$*"
+else
+	cases=$(cd "${rundir}/tests" && ls *.out | sed 's/\.out$//')
+fi
+
+for casename in ${cases}; do
+
+	expected="${rundir}/tests/${casename}.out"
+
+	input="${rundir}/tests/${casename}.in"
+	if [ ! -f "${input}" ]; then
+		input=/dev/null
+	fi
+
+	# MiniC源程序采用Antlr4前端，DragonIR文件不需要前端
+	if [ -f "${rundir}/tests/${casename}.c" ]; then
+		source="${rundir}/tests/${casename}.c"
+		frontend="-A"
+	else
+		source="${rundir}/tests/${casename}.ir"
+		frontend=""
+	fi
+
+	for opt in -O0 -O1 -O2; do
+
+		output="${workdir}/${casename}${opt}"
+
+		# 生成汇编
+		test_arm32 "${casename} ${opt}" "${output}.s" ${frontend} ${opt} "${source}"
+
+		# 直接生成ELF目标文件
+		test_arm32 "${casename} ${opt} --object" "${output}.o" ${frontend} ${opt} --object "${source}"
+
+		# 解释执行优化后的IR
+		"${minic}" -S ${frontend} ${opt} --run "${source}" < "${input}" > "${output}.run"
+		printf "\n%d\n" $? >> "${output}.run"
+		check "${casename} ${opt} --run" "${output}.run" "${expected}"
+
+		# 输出的IR重新作为输入，文本IR与二进制IR都要与直接编译的结果一致
+		for ext in ir irb; do
+			if "${minic}" -S -I ${frontend} ${opt} -o "${output}.${ext}" "${source}"; then
+				test_arm32 "${casename} ${opt} .${ext}" "${output}-${ext}.s" ${opt} "${output}.${ext}"
+			else
+				failed=$((failed + 1))
+				echo "FAIL: ${casename} ${opt} -I .${ext}"
+			fi
+		done
+	done
+done
+
+echo "passed ${passed}, failed ${failed}"
+
+[ "${failed}" -eq 0 ]
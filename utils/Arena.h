@@ -0,0 +1,175 @@
+///
+/// @file Arena.h
+/// @brief 区域内存分配器，按块分配内存，对象随分配器一起整体释放
+/// @author agent (agent@local)
+/// @version 1.0
+/// @date 2026-10-15
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-15 <td>1.0     <td>agent   <td>新建，按块分配、整体释放的区域内存分配器
+/// </table>
+///
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///
+/// @brief 区域内存分配器
+///
+/// 从大块内存中顺序切分出对象，不单独释放对象，分配器析构时释放所有的块。
+/// 只能创建可平凡析构的对象，对象中的字符串等通过copyString复制到区域内。
+///
+class Arena final {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _blockSize 每次向系统申请的块大小
+    ///
+    explicit Arena(size_t _blockSize = 64 * 1024) : blockSize(_blockSize)
+    {}
+
+    ///
+    /// @brief 析构函数，释放所有的块
+    ///
+    ~Arena()
+    {
+        for (auto block: blocks) {
+            std::free(block);
+        }
+    }
+
+    Arena(const Arena &) = delete;
+    Arena & operator=(const Arena &) = delete;
+
+    ///
+    /// @brief 分配内存
+    /// @param size 字节数
+    /// @param align 对齐字节数，必须是2的幂次
+    /// @return void* 内存地址
+    ///
+    void * allocate(size_t size, size_t align = alignof(std::max_align_t))
+    {
+        uintptr_t addr = (reinterpret_cast<uintptr_t>(cur) + align - 1) & ~(uintptr_t) (align - 1);
+
+        if ((cur == nullptr) || (addr + size > reinterpret_cast<uintptr_t>(end))) {
+
+            // 超过块大小的请求单独申请一块
+            size_t newSize = (size + align > blockSize) ? (size + align) : blockSize;
+            char * block = static_cast<char *>(std::malloc(newSize));
+            if (block == nullptr) {
+                throw std::bad_alloc();
+            }
+            blocks.push_back(block);
+
+            cur = block;
+            end = block + newSize;
+            addr = (reinterpret_cast<uintptr_t>(cur) + align - 1) & ~(uintptr_t) (align - 1);
+        }
+
+        cur = reinterpret_cast<char *>(addr + size);
+        used += size;
+
+        return reinterpret_cast<void *>(addr);
+    }
+
+    ///
+    /// @brief 在区域内创建对象
+    /// @param args 构造函数的参数
+    /// @return T* 对象
+    ///
+    template <typename T, typename... Args>
+    T * create(Args &&... args)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "Arena只能创建可平凡析构的对象");
+
+        return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    ///
+    /// @brief 复制字符串到区域内
+    /// @param str 字符串
+    /// @return const char* 以'\0'结尾的字符串
+    ///
+    const char * copyString(const std::string & str)
+    {
+        return copyString(str.c_str(), str.size());
+    }
+
+    ///
+    /// @brief 复制字符串到区域内
+    /// @param str 字符串
+    /// @param len 字符串的长度
+    /// @return const char* 以'\0'结尾的字符串
+    ///
+    const char * copyString(const char * str, size_t len)
+    {
+        char * buf = static_cast<char *>(allocate(len + 1, 1));
+        std::memcpy(buf, str, len);
+        buf[len] = '\0';
+
+        return buf;
+    }
+
+    ///
+    /// @brief 释放所有的块，之前分配的对象全部失效，分配器可继续使用
+    ///
+    void reset()
+    {
+        for (auto block: blocks) {
+            std::free(block);
+        }
+        blocks.clear();
+
+        cur = nullptr;
+        end = nullptr;
+        used = 0;
+    }
+
+    ///
+    /// @brief 获取已分配的字节数
+    /// @return size_t 字节数
+    ///
+    size_t bytesUsed() const
+    {
+        return used;
+    }
+
+private:
+    ///
+    /// @brief 块大小
+    ///
+    size_t blockSize;
+
+    ///
+    /// @brief 所有申请的块
+    ///
+    std::vector<char *> blocks;
+
+    ///
+    /// @brief 当前块的空闲位置
+    ///
+    char * cur = nullptr;
+
+    ///
+    /// @brief 当前块的结束位置
+    ///
+    char * end = nullptr;
+
+    ///
+    /// @brief 已分配的字节数
+    ///
+    size_t used = 0;
+};
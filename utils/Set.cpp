@@ -11,6 +11,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-19 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-16 <td>1.1     <td>agent   <td>支持按从小到大的次序遍历集合元素
 /// </table>
 ///
 
@@ -233,4 +234,21 @@ std::string Set::toString()
 bool Set::empty()
 {
     return bitmap.empty();
-}
\ No newline at end of file
+}
+///
+/// @brief 集合元素的开始迭代器，按从小到大的次序遍历
+/// @return std::set<uint32_t>::const_iterator 迭代器
+///
+std::set<uint32_t>::const_iterator Set::begin() const
+{
+    return bitmap.begin();
+}
+
+///
+/// @brief 集合元素的结束迭代器
+/// @return std::set<uint32_t>::const_iterator 迭代器
+///
+std::set<uint32_t>::const_iterator Set::end() const
+{
+    return bitmap.end();
+}
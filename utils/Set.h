@@ -11,6 +11,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-19 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-16 <td>1.1     <td>agent   <td>支持按从小到大的次序遍历集合元素
 /// </table>
 ///
 #pragma once
@@ -173,4 +174,16 @@ public:
     /// @return false 不空
     ///
     bool empty();
+
+    ///
+    /// @brief 集合元素的开始迭代器，按从小到大的次序遍历
+    /// @return std::set<uint32_t>::const_iterator 迭代器
+    ///
+    [[nodiscard]] std::set<uint32_t>::const_iterator begin() const;
+
+    ///
+    /// @brief 集合元素的结束迭代器
+    /// @return std::set<uint32_t>::const_iterator 迭代器
+    ///
+    [[nodiscard]] std::set<uint32_t>::const_iterator end() const;
 };